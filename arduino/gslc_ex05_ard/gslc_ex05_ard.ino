@@ -204,9 +204,9 @@ void setup()
   // - NOTE: If we are using the ElemCreate*_P() macros then it is important to note
   //   the font pointer (array index) as it will be provided to certain
   //   ElemCreate*_P() functions (eg. ElemCreateTxt_P).
-  if (!gslc_FontAdd(&m_gui,E_FONT_BTN,"",1)) { return; }    // m_asFont[0]
-  if (!gslc_FontAdd(&m_gui,E_FONT_TXT,"",1)) { return; }    // m_asFont[1]
-  if (!gslc_FontAdd(&m_gui,E_FONT_TITLE,"",1)) { return; }  // m_asFont[2]
+  if (!gslc_FontAdd(&m_gui,E_FONT_BTN,GSLC_FONTREF_FNAME,"",1)) { return; }    // m_asFont[0]
+  if (!gslc_FontAdd(&m_gui,E_FONT_TXT,GSLC_FONTREF_FNAME,"",1)) { return; }    // m_asFont[1]
+  if (!gslc_FontAdd(&m_gui,E_FONT_TITLE,GSLC_FONTREF_FNAME,"",1)) { return; }  // m_asFont[2]
 
   // Create page elements
   InitOverlays();
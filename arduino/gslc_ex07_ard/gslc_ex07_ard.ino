@@ -232,8 +232,8 @@ void setup()
   // - NOTE: If we are using the ElemCreate*_P() macros then it is important to note
   //   the font pointer (array index) as it will be provided to certain
   //   ElemCreate*_P() functions (eg. ElemCreateTxt_P).
-  if (!gslc_FontAdd(&m_gui,E_FONT_TXT,"",1)) { return; }   // m_asFont[0]
-  if (!gslc_FontAdd(&m_gui,E_FONT_TITLE,"",3)) { return; } // m_asFont[1]
+  if (!gslc_FontAdd(&m_gui,E_FONT_TXT,GSLC_FONTREF_FNAME,"",1)) { return; }   // m_asFont[0]
+  if (!gslc_FontAdd(&m_gui,E_FONT_TITLE,GSLC_FONTREF_FNAME,"",3)) { return; } // m_asFont[1]
 
   // Create pages display
   InitOverlays();
@@ -106,6 +106,25 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   pGui->pfuncXEvent = NULL;
   
   pGui->sImgRefBkgnd = gslc_ResetImage();
+
+  // No regions have been invalidated yet
+  pGui->nInvalidRgnCnt  = 0;
+  pGui->nDrawCulledCnt  = 0;
+
+  // Drawing commands are sent directly to the driver until a redraw
+  pGui->nDispListCnt    = 0;
+  pGui->bDispListRec    = false;
+
+  // No elements are cached yet
+  pGui->nElemCacheCnt   = 0;
+  pGui->nElemCacheUsed  = 0;
+
+  // No images are registered yet
+  pGui->nImgCacheCnt    = 0;
+  pGui->nImgCacheBytes  = 0;
+  pGui->nImgCacheUseCnt = 0;
+  pGui->nImgCacheLoad   = 0;
+  pGui->nImgCacheHit    = 0;
     
   // Save a link to the driver
   pGui->pvDriver = pvDriver;
@@ -124,6 +143,14 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   if (bOk) { bOk &= gslc_DrvInit(pGui); }
   if (bOk) { bOk &= gslc_InitTouch(pGui,GSLC_DEV_TOUCH); }
 
+  // Default to no clipping within the display
+  // - Done after the driver init since it provides the dimensions
+  pGui->rClipRect = (gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH};
+
+  // Configure the default update scheduling
+  // - Done after the driver init since it provides the time base
+  gslc_SetUpdateRate(pGui,GSLC_SCHED_TOUCH_MS,GSLC_SCHED_TICK_MS,GSLC_SCHED_FPS_MAX);
+
   if (!bOk) { GSLC_DEBUG_PRINT("ERROR: Init(%s) failed\n",""); }
   return bOk;
 }
@@ -298,10 +325,13 @@ void gslc_Update(gslc_tsGui* pGui)
 {
   int16_t   nTouchX,nTouchY;
   uint16_t  nTouchPress;
-  bool      bTouchEvent;
+  bool      bTouchEvent = false;
+  uint32_t  nNow = gslc_DrvGetTicks();
   
   // Poll for touchscreen presses  
-  bTouchEvent = gslc_GetTouch(pGui,&nTouchX,&nTouchY,&nTouchPress);
+  if (gslc_SchedDue(nNow,&pGui->nSchedTouchLast,pGui->nSchedTouchMs)) {
+    bTouchEvent = gslc_GetTouch(pGui,&nTouchX,&nTouchY,&nTouchPress);
+  }
   
   if (bTouchEvent) {
     // Track and handle the touch events
@@ -316,16 +346,48 @@ void gslc_Update(gslc_tsGui* pGui)
   }
   
   // Issue a timer tick to all pages
-  uint8_t nPageInd;
-  gslc_tsPage* pPage = NULL;
-  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
-    pPage = &pGui->asPage[nPageInd];    
-    gslc_tsEvent sEvent = gslc_EventCreate(GSLC_EVT_TICK,0,(void*)pPage,NULL);
-    gslc_PageEvent(pGui,sEvent);
+  if (gslc_SchedDue(nNow,&pGui->nSchedTickLast,pGui->nSchedTickMs)) {
+    uint8_t nPageInd;
+    gslc_tsPage* pPage = NULL;
+    for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+      pPage = &pGui->asPage[nPageInd];    
+      gslc_tsEvent sEvent = gslc_EventCreate(GSLC_EVT_TICK,0,(void*)pPage,NULL);
+      gslc_PageEvent(pGui,sEvent);
+    }
   }
   
   // Perform any redraw required for current page
-  gslc_PageRedrawGo(pGui);
+  // - When the frame rate is limited, the redraw interval only
+  //   restarts when something is drawn so that a change after
+  //   an idle period is drawn immediately
+  if (pGui->nSchedRedrawMs == 0) {
+    gslc_PageRedrawGo(pGui);
+  } else if (gslc_PageRedrawPending(pGui)) {
+    if (gslc_SchedDue(nNow,&pGui->nSchedRedrawLast,pGui->nSchedRedrawMs)) {
+      gslc_PageRedrawGo(pGui);
+    }
+  }
+
+  // Determine how long the caller can sleep until the next
+  // scheduled update is due
+  // - Any activity that runs on every call can't sleep
+  // - A redraw is only scheduled if one is pending
+  nNow = gslc_DrvGetTicks();
+  uint16_t  nSleep = 0xFFFF;
+  uint16_t  nRemain;
+  if ((pGui->nSchedTouchMs == 0) || (pGui->nSchedTickMs == 0)) {
+    nSleep = 0;
+  } else {
+    nRemain = gslc_SchedRemain(nNow,pGui->nSchedTouchLast,pGui->nSchedTouchMs);
+    if (nRemain < nSleep) { nSleep = nRemain; }
+    nRemain = gslc_SchedRemain(nNow,pGui->nSchedTickLast,pGui->nSchedTickMs);
+    if (nRemain < nSleep) { nSleep = nRemain; }
+    if (gslc_PageRedrawPending(pGui)) {
+      nRemain = gslc_SchedRemain(nNow,pGui->nSchedRedrawLast,pGui->nSchedRedrawMs);
+      if (nRemain < nSleep) { nSleep = nRemain; }
+    }
+  }
+  pGui->nSchedSleepMs = nSleep;
   
   // Simple "frame" rate reporting
   // - Note that the rate is based on the number of calls to gslc_Update()
@@ -343,6 +405,29 @@ void gslc_Update(gslc_tsGui* pGui)
 
 }
 
+void gslc_SetUpdateRate(gslc_tsGui* pGui,uint16_t nTouchMs,uint16_t nTickMs,uint16_t nFpsMax)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: SetUpdateRate(%s) called with NULL ptr\n","");
+    return;
+  }
+  pGui->nSchedTouchMs   = nTouchMs;
+  pGui->nSchedTickMs    = nTickMs;
+  pGui->nSchedRedrawMs  = (nFpsMax == 0)? 0 : (1000 / nFpsMax);
+
+  // Make all scheduled updates due on the next call
+  uint32_t nNow = gslc_DrvGetTicks();
+  pGui->nSchedTouchLast   = nNow - pGui->nSchedTouchMs;
+  pGui->nSchedTickLast    = nNow - pGui->nSchedTickMs;
+  pGui->nSchedRedrawLast  = nNow - pGui->nSchedRedrawMs;
+  pGui->nSchedSleepMs     = 0;
+}
+
+uint16_t gslc_GetUpdateSleep(gslc_tsGui* pGui)
+{
+  return pGui->nSchedSleepMs;
+}
+
 gslc_tsEvent  gslc_EventCreate(gslc_teEventType eType,uint8_t nSubType,void* pvScope,void* pvData)
 {
   gslc_tsEvent      sEvent;
@@ -524,6 +609,44 @@ bool gslc_ClipRect(gslc_tsRect* pClipRect,gslc_tsRect* pRect)
 }
 
 
+bool gslc_IsRectOverlap(gslc_tsRect rRect1,gslc_tsRect rRect2)
+{
+  if ((rRect1.w == 0) || (rRect1.h == 0) || (rRect2.w == 0) || (rRect2.h == 0)) {
+    return false;
+  }
+  if ( (rRect1.x >= rRect2.x+rRect2.w) || (rRect2.x >= rRect1.x+rRect1.w) ) { return false; }
+  if ( (rRect1.y >= rRect2.y+rRect2.h) || (rRect2.y >= rRect1.y+rRect1.h) ) { return false; }
+  return true;
+}
+
+bool gslc_IsRectInRect(gslc_tsRect rInner,gslc_tsRect rOuter)
+{
+  if ( (rInner.x >= rOuter.x) && (rInner.x+rInner.w <= rOuter.x+rOuter.w) &&
+       (rInner.y >= rOuter.y) && (rInner.y+rInner.h <= rOuter.y+rOuter.h) ) {
+    return true;
+  } else {
+    return false;
+  }
+}
+
+gslc_tsRect gslc_UnionRect(gslc_tsRect rRect1,gslc_tsRect rRect2)
+{
+  if ((rRect1.w == 0) || (rRect1.h == 0)) { return rRect2; }
+  if ((rRect2.w == 0) || (rRect2.h == 0)) { return rRect1; }
+  int16_t nX0 = (rRect1.x < rRect2.x)? rRect1.x : rRect2.x;
+  int16_t nY0 = (rRect1.y < rRect2.y)? rRect1.y : rRect2.y;
+  int16_t nX1 = (rRect1.x+rRect1.w > rRect2.x+rRect2.w)? rRect1.x+rRect1.w : rRect2.x+rRect2.w;
+  int16_t nY1 = (rRect1.y+rRect1.h > rRect2.y+rRect2.h)? rRect1.y+rRect1.h : rRect2.y+rRect2.h;
+  gslc_tsRect rUnion = {nX0,nY0,(uint16_t)(nX1-nX0),(uint16_t)(nY1-nY0)};
+  return rUnion;
+}
+
+bool gslc_ColorEqual(gslc_tsColor nCol1,gslc_tsColor nCol2)
+{
+  return ((nCol1.r == nCol2.r) && (nCol1.g == nCol2.g) && (nCol1.b == nCol2.b));
+}
+
+
 
 gslc_tsImgRef gslc_ResetImage()
 {
@@ -589,6 +712,11 @@ gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFl
 
 void gslc_DrawSetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 {
+  if (pGui->bDispListRec) {
+    gslc_tsDispCmd sCmd = {GSLC_DISPCMD_POINT,{nX,nY,1,1},nCol};
+    gslc_DispListAdd(pGui,sCmd);
+    return;
+  }
    
 #if (DRV_HAS_DRAW_POINT) 
   // Call optimized driver point drawing
@@ -604,55 +732,39 @@ void gslc_DrawSetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 // - Algorithm reference: https://rosettacode.org/wiki/Bitmap/Bresenham's_line_algorithm#C
 void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
 {
+  if (pGui->bDispListRec) {
+    gslc_tsDispCmd sCmd = {GSLC_DISPCMD_LINE};
+    sCmd.rRect.x  = (nX0 < nX1)? nX0 : nX1;
+    sCmd.rRect.y  = (nY0 < nY1)? nY0 : nY1;
+    sCmd.rRect.w  = abs(nX1-nX0)+1;
+    sCmd.rRect.h  = abs(nY1-nY0)+1;
+    sCmd.nCol     = nCol;
+    sCmd.nX0      = nX0;
+    sCmd.nY0      = nY0;
+    sCmd.nX1      = nX1;
+    sCmd.nY1      = nY1;
+    gslc_DispListAdd(pGui,sCmd);
+    return;
+  }
   
 #if (DRV_HAS_DRAW_LINE) 
   // Call optimized driver line drawing
   gslc_DrvDrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
   
 #else
-  // Perform Bresenham's line algorithm
   int16_t nDX = abs(nX1-nX0);
   int16_t nDY = abs(nY1-nY0);
 
-  int16_t nSX = (nX0 < nX1)? 1 : -1;
-  int16_t nSY = (nY0 < nY1)? 1 : -1;
-  int16_t nErr = ( (nDX>nDY)? nDX : -nDY )/2;
-  int16_t nE2;
-  
   // Check for degenerate cases
-  // TODO: Need to test these optimizations
-  bool bDone = false;
+  // - Vertical and horizontal lines (including single points)
+  //   are drawn as spans, inclusive of both endpoints
   if (nDX == 0) {
-    if (nDY == 0) {
-      return;
-    } else if (nDY >= 0) {
-      gslc_DrawLineV(pGui,nX0,nY0,nDY,nCol);
-      bDone = true;
-    } else {
-      gslc_DrawLineV(pGui,nX1,nY1,-nDY,nCol);
-      bDone = true;
-    }
+    gslc_DrawLineV(pGui,nX0,(nY0 < nY1)? nY0 : nY1,nDY+1,nCol);
   } else if (nDY == 0) {
-    if (nDX >= 0) {
-      gslc_DrawLineH(pGui,nX0,nY0,nDX,nCol);
-      bDone = true;      
-    } else {
-      gslc_DrawLineH(pGui,nX1,nY1,-nDX,nCol);
-      bDone = true;      
-    }
-  }
-
-  if (!bDone) {
-    for (;;) {
-      // Set the pixel
-      gslc_DrvDrawPoint(pGui,nX0,nY0,nCol);
-
-      // Calculate next coordinates
-      if ( (nX0 == nX1) && (nY0 == nY1) ) break;
-      nE2 = nErr;
-      if (nE2 > -nDX) { nErr -= nDY; nX0 += nSX; }
-      if (nE2 <  nDY) { nErr += nDX; nY0 += nSY; }
-    }
+    gslc_DrawLineH(pGui,(nX0 < nX1)? nX0 : nX1,nY0,nDX+1,nCol);
+  } else {
+    // Perform Bresenham's line algorithm on the visible portion
+    gslc_DrawLineClipSpans(pGui,nX0,nY0,nX1,nY1,nCol);
   }
   gslc_PageFlipSet(pGui,true);   
 #endif
@@ -662,23 +774,25 @@ void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t
 
 void gslc_DrawLineH(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nW,gslc_tsColor nCol)
 {
-  
-  uint16_t nOffset;
-  for (nOffset=0;nOffset<nW;nOffset++) {
-    gslc_DrvDrawPoint(pGui,nX+nOffset,nY,nCol);    
-  }  
-  
-  gslc_PageFlipSet(pGui,true);  
+  // A horizontal line is recorded as a fill so that it can be
+  // merged with neighbouring fills
+  if (pGui->bDispListRec) {
+    gslc_DrawFillRect(pGui,(gslc_tsRect){nX,nY,nW,1},nCol);
+    return;
+  }
+  gslc_DrawSpanH(pGui,nX,nY,nW,nCol);
+  gslc_PageFlipSet(pGui,true);
 }
 
 void gslc_DrawLineV(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nH,gslc_tsColor nCol)
 {
-  
-  uint16_t nOffset;
-  for (nOffset=0;nOffset<nH;nOffset++) {
-    gslc_DrvDrawPoint(pGui,nX,nY+nOffset,nCol);    
+  // A vertical line is recorded as a fill so that it can be
+  // merged with neighbouring fills
+  if (pGui->bDispListRec) {
+    gslc_DrawFillRect(pGui,(gslc_tsRect){nX,nY,1,nH},nCol);
+    return;
   }
-  
+  gslc_DrawSpanV(pGui,nX,nY,nH,nCol);
   gslc_PageFlipSet(pGui,true);
 }
 
@@ -690,6 +804,12 @@ void gslc_DrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
     return;
   }
 
+  if (pGui->bDispListRec) {
+    gslc_tsDispCmd sCmd = {GSLC_DISPCMD_FRAME_RECT,rRect,nCol};
+    gslc_DispListAdd(pGui,sCmd);
+    return;
+  }
+
 #if (DRV_HAS_DRAW_RECT_FRAME)
   // Call optimized driver implementation
   gslc_DrvDrawFrameRect(pGui,rRect,nCol);
@@ -701,10 +821,10 @@ void gslc_DrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   nY = rRect.y;
   nW = rRect.w;
   nH = rRect.h;
-  gslc_DrawLineH(pGui,nX,nY,nW-1,nCol);                 // Top
-  gslc_DrawLineH(pGui,nX,(int16_t)(nY+nH-1),nW-1,nCol); // Bottom
-  gslc_DrawLineV(pGui,nX,nY,nH-1,nCol);                 // Left
-  gslc_DrawLineV(pGui,(int16_t)(nX+nW-1),nY,nH-1,nCol); // Right
+  gslc_DrawLineH(pGui,nX,nY,nW,nCol);                   // Top
+  gslc_DrawLineH(pGui,nX,(int16_t)(nY+nH-1),nW,nCol);   // Bottom
+  gslc_DrawLineV(pGui,nX,nY,nH,nCol);                   // Left
+  gslc_DrawLineV(pGui,(int16_t)(nX+nW-1),nY,nH,nCol);   // Right
 #endif
   
   gslc_PageFlipSet(pGui,true);  
@@ -716,13 +836,33 @@ void gslc_DrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   if ((rRect.w == 0) || (rRect.h == 0)) {
     return;
   }
+
+  // Semi-transparent fills are drawn immediately since the display
+  // list optimizations assume that a fill overwrites what it covers
+  if (nCol.transp != 0) {
+    if (nCol.transp == 255) {
+      return;
+    }
+    gslc_DispListFlush(pGui);
+    #if (DRV_HAS_DRAW_RECT_FILL_ALPHA)
+    if (gslc_DrvDrawFillRectAlpha(pGui,rRect,nCol)) {
+      gslc_PageFlipSet(pGui,true);
+      return;
+    }
+    #endif
+    // The driver can't blend, so fall back to an opaque fill
+  } else if (pGui->bDispListRec) {
+    gslc_tsDispCmd sCmd = {GSLC_DISPCMD_FILL_RECT,rRect,nCol};
+    gslc_DispListAdd(pGui,sCmd);
+    return;
+  }
   
 #if (DRV_HAS_DRAW_RECT_FILL)
   // Call optimized driver implementation
   gslc_DrvDrawFillRect(pGui,rRect,nCol);
 #else
   // Emulate it with individual line draws
-  // TODO: This should be avoided as it will generally be very inefficient
+  // - Each row is drawn as a span when the driver supports it
   int nRow;
   for (nRow=0;nRow<rRect.h;nRow++) {
     gslc_DrawLineH(pGui, rRect.x, rRect.y+nRow, rRect.w, nCol);
@@ -772,68 +912,341 @@ gslc_tsRect gslc_ExpandRect(gslc_tsRect rRect,int16_t nExpandW,int16_t nExpandH)
 void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
   uint16_t nRadius,gslc_tsColor nCol)
 {
+  // Circles aren't recorded in the display list, so submit
+  // any earlier commands to preserve the drawing order
+  gslc_DispListFlush(pGui);
   
   #if (DRV_HAS_DRAW_CIRCLE_FRAME)
     // Call optimized driver implementation
-    gslc_DrvDrawFrameCircle(pGui,nMidX,nMidY,nRadius,nCol);    
-  #else
-    // Emulate circle with point drawing
-    
-    int16_t nX    = nRadius;
-    int16_t nY    = 0;
-    int16_t nErr  = 0;
+    // - The driver may decline (eg. when clipping is required),
+    //   in which case the emulation below is used instead
+    if (gslc_DrvDrawFrameCircle(pGui,nMidX,nMidY,nRadius,nCol)) {
+      gslc_PageFlipSet(pGui,true);
+      return;
+    }
+  #endif
 
-    #if (DRV_HAS_DRAW_POINTS)
-      gslc_tsPt asPt[8];
-      while (nX >= nY)
-      {
-        asPt[0] = (gslc_tsPt){nMidX + nX, nMidY + nY};
-        asPt[1] = (gslc_tsPt){nMidX + nY, nMidY + nX};
-        asPt[2] = (gslc_tsPt){nMidX - nY, nMidY + nX};
-        asPt[3] = (gslc_tsPt){nMidX - nX, nMidY + nY};
-        asPt[4] = (gslc_tsPt){nMidX - nX, nMidY - nY};
-        asPt[5] = (gslc_tsPt){nMidX - nY, nMidY - nX};
-        asPt[6] = (gslc_tsPt){nMidX + nY, nMidY - nX};
-        asPt[7] = (gslc_tsPt){nMidX + nX, nMidY - nY};
-        gslc_DrvDrawPoints(pGui,asPt,8,nCol);
-
-        nY    += 1;
-        nErr  += 1 + 2*nY;
-        if (2*(nErr-nX) + 1 > 0)
-        {
-            nX -= 1;
-            nErr += 1 - 2*nX;
+  // Emulate circle with point drawing
+  gslc_DrawRoundFrame(pGui,(gslc_tsRect){nMidX,nMidY,1,1},nRadius,nCol);
+
+  gslc_PageFlipSet(pGui,true);
+}
+
+void gslc_DrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
+  uint16_t nRadius,gslc_tsColor nCol)
+{
+  // Circles aren't recorded in the display list, so submit
+  // any earlier commands to preserve the drawing order
+  gslc_DispListFlush(pGui);
+
+  #if (DRV_HAS_DRAW_CIRCLE_FILL)
+    // Call optimized driver implementation
+    if (gslc_DrvDrawFillCircle(pGui,nMidX,nMidY,nRadius,nCol)) {
+      gslc_PageFlipSet(pGui,true);
+      return;
+    }
+  #endif
+
+  // Emulate filled circle with horizontal spans
+  gslc_DrawRoundFill(pGui,(gslc_tsRect){nMidX,nMidY,1,1},nRadius,nCol);
+
+  gslc_PageFlipSet(pGui,true);
+}
+
+void gslc_DrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint16_t nRadius,gslc_tsColor nCol)
+{
+  // Ensure dimensions are valid
+  if ((rRect.w == 0) || (rRect.h == 0)) {
+    return;
+  }
+
+  // Limit the radius so that the corners don't overlap
+  uint16_t nRadiusMax = (((rRect.w < rRect.h)? rRect.w : rRect.h) - 1) / 2;
+  if (nRadius > nRadiusMax) {
+    nRadius = nRadiusMax;
+  }
+  if (nRadius == 0) {
+    gslc_DrawFrameRect(pGui,rRect,nCol);
+    return;
+  }
+
+  // Rounded rects aren't recorded in the display list, so submit
+  // any earlier commands to preserve the drawing order
+  gslc_DispListFlush(pGui);
+
+  #if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
+    // Call optimized driver implementation
+    if (gslc_DrvDrawFrameRoundRect(pGui,rRect,nRadius,nCol)) {
+      gslc_PageFlipSet(pGui,true);
+      return;
+    }
+  #endif
+
+  // Emulate with corner points and edge spans
+  gslc_tsRect rInner = {rRect.x+nRadius,rRect.y+nRadius,rRect.w-2*nRadius,rRect.h-2*nRadius};
+  gslc_DrawRoundFrame(pGui,rInner,nRadius,nCol);
+
+  gslc_PageFlipSet(pGui,true);
+}
+
+void gslc_DrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint16_t nRadius,gslc_tsColor nCol)
+{
+  // Ensure dimensions are valid
+  if ((rRect.w == 0) || (rRect.h == 0)) {
+    return;
+  }
+
+  // Limit the radius so that the corners don't overlap
+  uint16_t nRadiusMax = (((rRect.w < rRect.h)? rRect.w : rRect.h) - 1) / 2;
+  if (nRadius > nRadiusMax) {
+    nRadius = nRadiusMax;
+  }
+  if (nRadius == 0) {
+    gslc_DrawFillRect(pGui,rRect,nCol);
+    return;
+  }
+
+  // Rounded rects aren't recorded in the display list, so submit
+  // any earlier commands to preserve the drawing order
+  gslc_DispListFlush(pGui);
+
+  #if (DRV_HAS_DRAW_RECT_ROUND_FILL)
+    // Call optimized driver implementation
+    if (gslc_DrvDrawFillRoundRect(pGui,rRect,nRadius,nCol)) {
+      gslc_PageFlipSet(pGui,true);
+      return;
+    }
+  #endif
+
+  // Emulate with horizontal spans
+  gslc_tsRect rInner = {rRect.x+nRadius,rRect.y+nRadius,rRect.w-2*nRadius,rRect.h-2*nRadius};
+  gslc_DrawRoundFill(pGui,rInner,nRadius,nCol);
+
+  gslc_PageFlipSet(pGui,true);
+}
+
+// Fill a triangle by scanning each row between its top and bottom
+// vertex and drawing the span between the two edges that cross it
+void gslc_DrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+  int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol)
+{
+  // Triangles aren't recorded in the display list, so submit
+  // any earlier commands to preserve the drawing order
+  gslc_DispListFlush(pGui);
+
+  #if (DRV_HAS_DRAW_TRI_FILL)
+    // Call optimized driver implementation
+    if (gslc_DrvDrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol)) {
+      gslc_PageFlipSet(pGui,true);
+      return;
+    }
+  #endif
+
+  // Sort the vertices by Y coordinate
+  int16_t nTmp;
+  if (nY0 > nY1) {
+    nTmp = nX0; nX0 = nX1; nX1 = nTmp;
+    nTmp = nY0; nY0 = nY1; nY1 = nTmp;
+  }
+  if (nY1 > nY2) {
+    nTmp = nX1; nX1 = nX2; nX2 = nTmp;
+    nTmp = nY1; nY1 = nY2; nY2 = nTmp;
+  }
+  if (nY0 > nY1) {
+    nTmp = nX0; nX0 = nX1; nX1 = nTmp;
+    nTmp = nY0; nY0 = nY1; nY1 = nTmp;
+  }
+
+  int16_t nXMin,nXMax;
+  if (nY0 == nY2) {
+    // All vertices on one row
+    nXMin = nX0; nXMax = nX0;
+    if (nX1 < nXMin) { nXMin = nX1; }
+    if (nX1 > nXMax) { nXMax = nX1; }
+    if (nX2 < nXMin) { nXMin = nX2; }
+    if (nX2 > nXMax) { nXMax = nX2; }
+    gslc_DrawSpanH(pGui,nXMin,nY0,nXMax-nXMin+1,nCol);
+    gslc_PageFlipSet(pGui,true);
+    return;
+  }
+
+  // Only scan the rows within the clipping region
+  int32_t nRowMin = nY0;
+  int32_t nRowMax = nY2;
+  if (nRowMin < pGui->rClipRect.y) {
+    nRowMin = pGui->rClipRect.y;
+  }
+  if (nRowMax > pGui->rClipRect.y + pGui->rClipRect.h - 1) {
+    nRowMax = pGui->rClipRect.y + pGui->rClipRect.h - 1;
+  }
+
+  // Each edge crossing is rounded to the nearest pixel
+  int32_t nRow,nXLong,nXShort;
+  for (nRow=nRowMin;nRow<=nRowMax;nRow++) {
+    nXLong = nX0 + gslc_DivFloor(2*(int32_t)(nX2-nX0)*(nRow-nY0) + (nY2-nY0),2*(int32_t)(nY2-nY0));
+    if ((nRow < nY1) || (nY1 == nY2)) {
+      if (nY1 == nY0) {
+        nXShort = nX1;
+      } else {
+        nXShort = nX0 + gslc_DivFloor(2*(int32_t)(nX1-nX0)*(nRow-nY0) + (nY1-nY0),2*(int32_t)(nY1-nY0));
+      }
+    } else {
+      nXShort = nX1 + gslc_DivFloor(2*(int32_t)(nX2-nX1)*(nRow-nY1) + (nY2-nY1),2*(int32_t)(nY2-nY1));
+    }
+    nXMin = (nXLong < nXShort)? nXLong : nXShort;
+    nXMax = (nXLong < nXShort)? nXShort : nXLong;
+    gslc_DrawSpanH(pGui,nXMin,nRow,nXMax-nXMin+1,nCol);
+  }
+
+  gslc_PageFlipSet(pGui,true);
+}
+
+// Draw a sector of a ring
+// - A pixel belongs to the ring when gslc_DrawFillCircle() of radius
+//   R2 covers it but the interior of the one of radius R1 doesn't.
+//   The interior excludes the pixels drawn by gslc_DrawFrameCircle(),
+//   so the edges of the ring line up with circles of the same radii
+//   and equal radii draw the same pixels as the circle outline.
+// - A pixel belongs to the sector when it lies clockwise of the start
+//   direction and anticlockwise of the end direction. For a sector
+//   wider than a half circle, either condition is sufficient.
+void gslc_DrawArc(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius1,uint16_t nRadius2,
+  int16_t nAngStart,int16_t nAngEnd,gslc_tsColor nCol)
+{
+  if (nRadius1 > nRadius2) {
+    return;
+  }
+  // Determine the clockwise sweep from the start to the end angle
+  int32_t nSweep = (int32_t)nAngEnd - nAngStart;
+  bool    bFull  = ((nSweep >= 360) || (nSweep <= -360));
+  nSweep = ((nSweep % 360) + 360) % 360;
+  if ((nSweep == 0) && (!bFull)) {
+    return;
+  }
+
+  // Arcs aren't recorded in the display list, so submit
+  // any earlier commands to preserve the drawing order
+  gslc_DispListFlush(pGui);
+
+  // Determine the start and end directions in screen coordinates
+  // (Y increases downwards)
+  int32_t nV0X =  gslc_SinDeg(nAngStart);
+  int32_t nV0Y = -gslc_SinDeg(nAngStart+90);
+  int32_t nV1X =  gslc_SinDeg(nAngEnd);
+  int32_t nV1Y = -gslc_SinDeg(nAngEnd+90);
+  bool    bWide = (nSweep > 180);
+
+  // Only scan the rows and columns within the clipping region
+  int32_t nDYMin = -(int32_t)nRadius2;
+  int32_t nDYMax = nRadius2;
+  if (nMidY + nDYMin < pGui->rClipRect.y) {
+    nDYMin = pGui->rClipRect.y - nMidY;
+  }
+  if (nMidY + nDYMax > pGui->rClipRect.y + pGui->rClipRect.h - 1) {
+    nDYMax = pGui->rClipRect.y + pGui->rClipRect.h - 1 - nMidY;
+  }
+  int32_t nDXMin = pGui->rClipRect.x - nMidX;
+  int32_t nDXMax = pGui->rClipRect.x + pGui->rClipRect.w - 1 - nMidX;
+
+  int32_t nDY,nDX,nRow,nDXOuter,nDXInner,nDXNext,nSeg,nSegStart,nSegEnd,nRunStart;
+  bool    bIn,bIn0,bIn1;
+  for (nDY=nDYMin;nDY<=nDYMax;nDY++) {
+    // Locate the ring on this row: one segment, or two
+    // segments either side of the hole in the middle
+    // - The hole excludes the pixels at the end of the inner circle's
+    //   row and those below the next row further from the center
+    nRow     = (nDY < 0)? -nDY : nDY;
+    nDXOuter = gslc_DrawRoundRowW(nRadius2,nRow);
+    nDXInner = -1;
+    if (nRow <= nRadius1) {
+      nDXInner = gslc_DrawRoundRowW(nRadius1,nRow) - 1;
+      nDXNext  = gslc_DrawRoundRowW(nRadius1,nRow+1);
+      if (nDXNext < nDXInner) {
+        nDXInner = nDXNext;
+      }
+    }
+    for (nSeg=0;nSeg<2;nSeg++) {
+      if (nDXInner < 0) {
+        if (nSeg > 0) { break; }
+        nSegStart = -nDXOuter;
+        nSegEnd   = nDXOuter;
+      } else if (nSeg == 0) {
+        nSegStart = -nDXOuter;
+        nSegEnd   = -nDXInner-1;
+      } else {
+        nSegStart = nDXInner+1;
+        nSegEnd   = nDXOuter;
+      }
+      if (nSegStart < nDXMin) {
+        nSegStart = nDXMin;
+      }
+      if (nSegEnd > nDXMax) {
+        nSegEnd = nDXMax;
+      }
+      if (nSegStart > nSegEnd) {
+        continue;
+      }
+      if (bFull) {
+        gslc_DrawSpanH(pGui,nMidX+nSegStart,nMidY+nDY,nSegEnd-nSegStart+1,nCol);
+        continue;
+      }
+      // Draw each run of pixels that lie within the sector
+      nRunStart = nSegStart;
+      for (nDX=nSegStart;nDX<=nSegEnd+1;nDX++) {
+        bIn = false;
+        if (nDX <= nSegEnd) {
+          bIn0 = (nV0X*nDY - nV0Y*nDX >= 0);
+          bIn1 = (nV1X*nDY - nV1Y*nDX <= 0);
+          bIn  = (bWide)? (bIn0 || bIn1) : (bIn0 && bIn1);
         }
-      } // while
-    
-    #elif (DRV_HAS_DRAW_POINT)
-      while (nX >= nY)
-      {
-        gslc_DrvDrawPoint(pGui,nMidX + nX, nMidY + nY,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX + nY, nMidY + nX,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX - nY, nMidY + nX,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX - nX, nMidY + nY,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX - nX, nMidY - nY,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX - nY, nMidY - nX,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX + nY, nMidY - nX,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX + nX, nMidY - nY,nCol);
-
-        nY    += 1;
-        nErr  += 1 + 2*nY;
-        if (2*(nErr-nX) + 1 > 0)
-        {
-            nX -= 1;
-            nErr += 1 - 2*nX;
+        if (!bIn) {
+          if (nDX > nRunStart) {
+            gslc_DrawSpanH(pGui,nMidX+nRunStart,nMidY+nDY,nDX-nRunStart,nCol);
+          }
+          nRunStart = nDX+1;
         }
-      } // while
+      }
+    }
+  }
 
-    #else
-      // ERROR
-    #endif
+  gslc_PageFlipSet(pGui,true);
+}
 
+void gslc_DrawLineAA(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  #if (DRV_HAS_DRAW_LINE_AA)
+    // Blended lines aren't recorded in the display list, so submit
+    // any earlier commands to preserve the drawing order
+    gslc_DispListFlush(pGui);
+
+    // The driver declines if it can't blend with the destination
+    if (gslc_DrvDrawLineAA(pGui,nX0,nY0,nX1,nY1,nCol)) {
+      gslc_PageFlipSet(pGui,true);
+      return;
+    }
   #endif
-  
-  gslc_PageFlipSet(pGui,true);
+
+  // Fall back to an aliased line
+  gslc_DrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
+}
+
+void gslc_DrawFrameCircleAA(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
+  uint16_t nRadius,gslc_tsColor nCol)
+{
+  #if (DRV_HAS_DRAW_CIRCLE_AA)
+    // Blended circles aren't recorded in the display list, so submit
+    // any earlier commands to preserve the drawing order
+    gslc_DispListFlush(pGui);
+
+    // The driver declines if it can't blend with the destination
+    if (gslc_DrvDrawFrameCircleAA(pGui,nMidX,nMidY,nRadius,nCol)) {
+      gslc_PageFlipSet(pGui,true);
+      return;
+    }
+  #endif
+
+  // Fall back to an aliased circle
+  gslc_DrawFrameCircle(pGui,nMidX,nMidY,nRadius,nCol);
 }
 
 
@@ -842,21 +1255,49 @@ void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
 // Font Functions
 // -----------------------------------------------------------------------
 
-bool gslc_FontAdd(gslc_tsGui* pGui,int16_t nFontId,const char* acFontName,uint16_t nFontSz)
+bool gslc_FontAdd(gslc_tsGui* pGui,int16_t nFontId,gslc_teFontRefType eFontRefType,
+  const void* pvFontRef,uint16_t nFontSz)
 {
   if (pGui->nFontCnt+1 > (pGui->nFontMax)) {
     GSLC_DEBUG_PRINT("ERROR: FontAdd(%s) added too many fonts\n","");
     return false;
-  } else { 
+  }
+  gslc_tsFont* pFont = &pGui->asFont[pGui->nFontCnt];
+  gslc_ResetFont(pFont);
+  pFont->nId          = nFontId;
+  pFont->nSize        = nFontSz;
+  pFont->eFontRefType = eFontRefType;
+
+  if (eFontRefType == GSLC_FONTREF_FNAME) {
     // Fetch a font resource from the driver
-    void* pvFont = gslc_DrvFontAdd(acFontName,nFontSz);
- 
-    pGui->asFont[pGui->nFontCnt].pvFont = pvFont;
-    pGui->asFont[pGui->nFontCnt].nId    = nFontId;
-    pGui->asFont[pGui->nFontCnt].nSize  = nFontSz;
-    pGui->nFontCnt++;  
-    return true;
+    pFont->pvFont = gslc_DrvFontAdd((const char*)pvFontRef,nFontSz);
+  } else {
+    if (pvFontRef == NULL) {
+      GSLC_DEBUG_PRINT("ERROR: FontAdd(%s) called with NULL font\n","");
+      return false;
+    }
+    pFont->pvFont = (void*)pvFontRef;
+
+    // Find the extent of the glyphs around the baseline so that
+    // text can be positioned by its top-left corner
+    gslc_tsFontBmp      sFontBmp;
+    gslc_tsFontBmpGlyph sGlyph;
+    uint32_t            nChar;
+    gslc_FontBmpGetDesc(pFont,&sFontBmp);
+    for (nChar=sFontBmp.nFirst;nChar<=sFontBmp.nLast;nChar++) {
+      if ((!gslc_FontBmpGetGlyph(pFont,&sFontBmp,nChar,&sGlyph)) || (sGlyph.nHeight == 0)) {
+        continue;
+      }
+      if (-sGlyph.nOffsetY > pFont->nAscent) {
+        pFont->nAscent  = -sGlyph.nOffsetY;
+      }
+      if (sGlyph.nOffsetY + sGlyph.nHeight > pFont->nDescent) {
+        pFont->nDescent = sGlyph.nOffsetY + sGlyph.nHeight;
+      }
+    }
   }
+  pGui->nFontCnt++;
+  return true;
 }
 
 
@@ -996,21 +1437,58 @@ bool gslc_PageRedrawGet(gslc_tsGui* pGui)
   return pGui->pCurPage->bPageNeedRedraw;
 }
 
+uint16_t gslc_PageRedrawCulledGet(gslc_tsGui* pGui)
+{
+  return pGui->nDrawCulledCnt;
+}
+
+uint32_t gslc_GetCacheUsed(gslc_tsGui* pGui)
+{
+  return pGui->nElemCacheUsed;
+}
+
+void gslc_GetImgCacheStats(gslc_tsGui* pGui,uint32_t* pnLoad,uint32_t* pnHit,uint32_t* pnBytes)
+{
+  *pnLoad   = pGui->nImgCacheLoad;
+  *pnHit    = pGui->nImgCacheHit;
+  *pnBytes  = pGui->nImgCacheBytes;
+}
+
+bool gslc_PageRedrawPending(gslc_tsGui* pGui)
+{
+  gslc_tsPage* pPage = pGui->pCurPage;
+  if (pPage == NULL) {
+    return false;
+  }
+  if ((pPage->bPageNeedRedraw) || (pPage->bPageNeedFlip) || (pGui->nInvalidRgnCnt > 0)) {
+    return true;
+  }
+  return gslc_CollectGetRedraw(&pPage->sCollect);
+}
+
 // Check the redraw flag on all elements on the current page and update
 // the redraw status if additional redraws are required (or the
 // entire page should be marked as requiring redraw).
 // - The typical case for this being required is when an element
-//   requires redraw but it is marked as being transparent. Therefore,
-//   the lower level elements should be redrawn.
-// - For now, just mark the entire page as requiring redraw.
-// TODO: Determine which elements underneath should be redrawn based
-//       on the region exposed by the transparent element.
+//   requires redraw but it is unfilled or its fill is semi-transparent
+//   (see gslc_ElemFillOpaque()). Therefore,
+//   the region underneath it (background and lower elements) is
+//   invalidated so that it can be redrawn along with the element.
+// - Elements that have moved or been resized since they were last
+//   drawn also invalidate the region they previously occupied.
+// - If the driver doesn't support partial redraw, the entire page
+//   is marked as requiring redraw.
 void gslc_PageRedrawCalc(gslc_tsGui* pGui)
 {
   int               nInd;
   gslc_tsElem*      pElem = NULL;
   gslc_tsCollect*   pCollect = NULL;
   
+  // Nothing further to determine if a full page redraw is pending
+  if (gslc_PageRedrawGet(pGui)) {
+    return;
+  }
+  
   // Only work on current page
   pCollect = pGui->pCurPageCollect;
   
@@ -1022,39 +1500,62 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
     }
     pElem = pCollect->asElemRef[nInd].pElem;
 
-    if (pElem->bNeedRedraw) {
-      
-      // Determine if entire page requires redraw
-      bool  bRedrawFullPage = false;
+    if (!pElem->bNeedRedraw) {
+      continue;
+    }
       
-      // If partial redraw is supported, then we
-      // look out for transparent elements which may
-      // still warrant full page redraw.
-      if (pGui->bRedrawPartialEn) {
-        // Is the element transparent?
-        if (!pElem->bFillEn) {
-          bRedrawFullPage = true;
-        }
-      } else {
-        bRedrawFullPage = true;
+    // Without partial redraw support, any change
+    // requires the entire page to be redrawn
+    if (!pGui->bRedrawPartialEn) {
+      gslc_PageRedrawSet(pGui,true);
+      break;
+    }
+    
+    // Has the element moved or been resized since it was drawn?
+    // If so, the region it previously covered has been exposed.
+    gslc_tsRect rDrawn = pElem->rElemDrawn;
+    if ((rDrawn.w > 0) && (rDrawn.h > 0)) {
+      if ( (rDrawn.x != pElem->rElem.x) || (rDrawn.y != pElem->rElem.y) ||
+           (rDrawn.w != pElem->rElem.w) || (rDrawn.h != pElem->rElem.h) ) {
+        gslc_InvalidateRgnAdd(pGui,rDrawn);
       }
-      
-      if (bRedrawFullPage) {
-        // Mark the entire page as requiring redraw
-        gslc_PageRedrawSet(pGui,true);
-        // No need to check any more elements 
-        break;
-      }
-      
+    }
+    
+    // Is the element transparent? If so, the region
+    // underneath it must be redrawn as well.
+    if (!gslc_ElemFillOpaque(pElem)) {
+      gslc_InvalidateRgnAdd(pGui,pElem->rElem);
+    }
+
+    // Region tracking may have escalated to a full page redraw
+    if (gslc_PageRedrawGet(pGui)) {
+      break;
+    }
+  }
+
+  #if (GSLC_INVALID_RGN_MAX > 0)
+  // Once the invalidated regions cover most of the display,
+  // redrawing the full page is cheaper than redrawing each
+  // region separately
+  if ((!gslc_PageRedrawGet(pGui)) && (pGui->nInvalidRgnCnt > 0)) {
+    uint32_t  nRgnArea  = 0;
+    uint32_t  nDispArea = (uint32_t)pGui->nDispW * pGui->nDispH;
+    for (nInd=0;nInd<pGui->nInvalidRgnCnt;nInd++) {
+      nRgnArea += (uint32_t)pGui->asInvalidRgn[nInd].w * pGui->asInvalidRgn[nInd].h;
+    }
+    if (nRgnArea >= (nDispArea/4)*3) {
+      gslc_PageRedrawSet(pGui,true);
     }
   }
+  #endif
 }
 
 // Redraw the active page
 // - If the page has been marked as needing redraw, then all
 //   elements are rendered
 // - If the page has not been marked as needing redraw then only
-//   the elements that have been marked as needing redraw
+//   the invalidated regions (background plus intersecting elements)
+//   and the elements that have been marked as needing redraw
 //   are rendered.
 void gslc_PageRedrawGo(gslc_tsGui* pGui)
 { 
@@ -1067,20 +1568,61 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
   // Determine final state of full-page redraw
   bool  bPageRedraw = gslc_PageRedrawGet(pGui);
 
+  // Record the drawing commands for this frame so that they
+  // can be optimized before they are sent to the driver
+  gslc_DispListStart(pGui);
+
+  #if (GSLC_INVALID_RGN_MAX > 0)
+  // Redraw any invalidated regions
+  // - Each region is clipped so that the elements that
+  //   intersect it are only redrawn within it
+  // - Only the region of the background is restored
+  // - If the driver can't clip, the regions can't be restored
+  //   in isolation so fall back to a full page redraw
+  if ((!bPageRedraw) && (pGui->nInvalidRgnCnt > 0)) {
+    uint8_t nRgnInd;
+    for (nRgnInd=0;nRgnInd<pGui->nInvalidRgnCnt;nRgnInd++) {
+      gslc_tsRect rRgn = pGui->asInvalidRgn[nRgnInd];
+      if (!gslc_SetClipRect(pGui,&rRgn)) {
+        bPageRedraw = true;
+        gslc_PageRedrawSet(pGui,true);
+        break;
+      }
+      if (pGui->bDispListRec) {
+        gslc_tsDispCmd sCmd = {GSLC_DISPCMD_BKGND_RECT};
+        sCmd.rRect = rRgn;
+        gslc_DispListAdd(pGui,sCmd);
+      } else {
+        gslc_DrvDrawBkgndRect(pGui,rRgn);
+      }
+      gslc_CollectRedrawRgn(pGui,pGui->pCurPageCollect,rRgn);
+    }
+    gslc_SetClipRect(pGui,NULL);
+    gslc_PageFlipSet(pGui,true);
+  }
+  #endif
+  gslc_InvalidateRgnReset(pGui);
+
   // If a full page redraw is required, then start by
   // redrawing the background.
   // NOTE:
   // - It would be cleaner if we could treat the background
   //   layer like any other element (and hence check for its
   //   need-redraw status).
-  // - For now, assume background doesn't need update except
-  //   if the entire page is to be redrawn
-  //   TODO: Fix this assumption (either add specific flag
-  //         for bBkgndNeedRedraw or make the background just
-  //         another element).
+  // - For now, the background is only redrawn in full if the
+  //   entire page is to be redrawn. Otherwise it is only redrawn
+  //   within the invalidated regions (above).
   if (bPageRedraw) {
-    gslc_DrvDrawBkgnd(pGui);
+    if (pGui->bDispListRec) {
+      gslc_tsDispCmd sCmd = {GSLC_DISPCMD_BKGND};
+      sCmd.rRect = (gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH};
+      gslc_DispListAdd(pGui,sCmd);
+    } else {
+      gslc_DrvDrawBkgnd(pGui);
+    }
     gslc_PageFlipSet(pGui,true);
+    // Restart the count of elements culled during the redraw
+    pGui->nDrawCulledCnt = 0;
   }
     
   // Draw other elements (as needed, unless forced page redraw)
@@ -1090,6 +1632,15 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
   gslc_PageEvent(pGui,sEvent);
   
  
+  #ifdef DBG_LOG
+  if (bPageRedraw) {
+    GSLC_DEBUG_PRINT("PageRedrawGo: culled %u elements\n",pGui->nDrawCulledCnt);
+  }
+  #endif
+
+  // Submit the recorded drawing commands
+  gslc_DispListStop(pGui);
+
   // Clear the page redraw flag
   gslc_PageRedrawSet(pGui,false);
   
@@ -1101,6 +1652,250 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
 }
 
 
+void gslc_InvalidateRgnAdd(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  if ((pGui == NULL) || (pGui->pCurPage == NULL)) {
+    GSLC_DEBUG_PRINT("ERROR: InvalidateRgnAdd(%s) called with NULL ptr\n","");
+    return;
+  }
+  
+  // Limit the region to the display
+  gslc_tsRect rDisp = {0,0,pGui->nDispW,pGui->nDispH};
+  if ((rRect.w == 0) || (rRect.h == 0)) { return; }
+  if (!gslc_ClipRect(&rDisp,&rRect)) { return; }
+
+  #if (GSLC_INVALID_RGN_MAX > 0)
+  uint8_t   nInd;
+  bool      bMerged = true;
+
+  // Absorb any regions that overlap the new one. The merged
+  // region may now overlap others, so rescan after each merge.
+  while (bMerged) {
+    bMerged = false;
+    for (nInd=0;nInd<pGui->nInvalidRgnCnt;nInd++) {
+      if (gslc_IsRectOverlap(rRect,pGui->asInvalidRgn[nInd])) {
+        rRect = gslc_UnionRect(rRect,pGui->asInvalidRgn[nInd]);
+        // Remove the absorbed region by moving the last one into its slot
+        pGui->nInvalidRgnCnt--;
+        pGui->asInvalidRgn[nInd] = pGui->asInvalidRgn[pGui->nInvalidRgnCnt];
+        bMerged = true;
+        break;
+      }
+    }
+  }
+  
+  if (pGui->nInvalidRgnCnt < GSLC_INVALID_RGN_MAX) {
+    pGui->asInvalidRgn[pGui->nInvalidRgnCnt] = rRect;
+    pGui->nInvalidRgnCnt++;
+    return;
+  }
+  
+  // The list is full, so combine the new region with the
+  // existing region whose bounding area grows the least
+  uint8_t   nIndBest  = 0;
+  uint32_t  nGrowBest = 0xFFFFFFFF;
+  for (nInd=0;nInd<pGui->nInvalidRgnCnt;nInd++) {
+    gslc_tsRect rOld    = pGui->asInvalidRgn[nInd];
+    gslc_tsRect rUnion  = gslc_UnionRect(rRect,rOld);
+    uint32_t    nGrow   = (uint32_t)rUnion.w*rUnion.h - (uint32_t)rOld.w*rOld.h;
+    if (nGrow < nGrowBest) {
+      nGrowBest = nGrow;
+      nIndBest  = nInd;
+    }
+  }
+  rRect = gslc_UnionRect(rRect,pGui->asInvalidRgn[nIndBest]);
+  pGui->nInvalidRgnCnt--;
+  pGui->asInvalidRgn[nIndBest] = pGui->asInvalidRgn[pGui->nInvalidRgnCnt];
+  // Re-add the combined region since it may overlap others
+  gslc_InvalidateRgnAdd(pGui,rRect);
+  #else
+  // No region tracking, so redraw the entire page instead
+  gslc_PageRedrawSet(pGui,true);
+  #endif
+}
+
+void gslc_InvalidateRgnReset(gslc_tsGui* pGui)
+{
+  pGui->nInvalidRgnCnt = 0;
+}
+
+
+void gslc_DispListStart(gslc_tsGui* pGui)
+{
+  #if (GSLC_DISPLIST_MAX > 0)
+  pGui->nDispListCnt = 0;
+  pGui->bDispListRec = true;
+  #endif
+}
+
+void gslc_DispListStop(gslc_tsGui* pGui)
+{
+  gslc_DispListFlush(pGui);
+  pGui->bDispListRec = false;
+}
+
+bool gslc_DispListAdd(gslc_tsGui* pGui,gslc_tsDispCmd sCmd)
+{
+  #if (GSLC_DISPLIST_MAX > 0)
+  if (!pGui->bDispListRec) {
+    return false;
+  }
+  // If the list is full, submit what we have so far
+  if (pGui->nDispListCnt >= GSLC_DISPLIST_MAX) {
+    gslc_DispListFlush(pGui);
+  }
+  pGui->asDispList[pGui->nDispListCnt] = sCmd;
+  pGui->nDispListCnt++;
+  return true;
+  #else
+  return false;
+  #endif
+}
+
+void gslc_DispListFlush(gslc_tsGui* pGui)
+{
+  #if (GSLC_DISPLIST_MAX > 0)
+  if ((!pGui->bDispListRec) || (pGui->nDispListCnt == 0)) {
+    return;
+  }
+  gslc_DispListOptimize(pGui);
+
+  // Disable recording while submitting so that the drawing
+  // primitives are passed through to the driver
+  uint16_t  nInd;
+  pGui->bDispListRec = false;
+  for (nInd=0;nInd<pGui->nDispListCnt;nInd++) {
+    gslc_DispCmdExec(pGui,&pGui->asDispList[nInd]);
+  }
+  pGui->bDispListRec = true;
+  pGui->nDispListCnt = 0;
+  #endif
+}
+
+void gslc_DispListOptimize(gslc_tsGui* pGui)
+{
+  #if (GSLC_DISPLIST_MAX > 0)
+  gslc_tsDispCmd* asCmd = pGui->asDispList;
+  uint16_t        nCnt  = pGui->nDispListCnt;
+  uint16_t        nInd,nIndLater;
+  gslc_tsDispCmd  sCmd;
+
+  // Drop any command that is completely overdrawn by a later fill
+  // - Everything that the command draws ends up covered, regardless
+  //   of what is drawn in between
+  for (nInd=0;nInd<nCnt;nInd++) {
+    if ((asCmd[nInd].eCmd == GSLC_DISPCMD_NONE) || (asCmd[nInd].rRect.w == 0)) {
+      continue;
+    }
+    for (nIndLater=nInd+1;nIndLater<nCnt;nIndLater++) {
+      if ((asCmd[nIndLater].eCmd == GSLC_DISPCMD_FILL_RECT) &&
+          (gslc_IsRectInRect(asCmd[nInd].rRect,asCmd[nIndLater].rRect))) {
+        asCmd[nInd].eCmd = GSLC_DISPCMD_NONE;
+        break;
+      }
+    }
+  }
+
+  // Group primitives of the same type and color together
+  // - A command can move earlier as long as it doesn't overlap
+  //   any command that it moves ahead of
+  for (nIndLater=1;nIndLater<nCnt;nIndLater++) {
+    sCmd = asCmd[nIndLater];
+    if ((sCmd.eCmd != GSLC_DISPCMD_POINT) && (sCmd.eCmd != GSLC_DISPCMD_LINE) &&
+        (sCmd.eCmd != GSLC_DISPCMD_FRAME_RECT) && (sCmd.eCmd != GSLC_DISPCMD_FILL_RECT)) {
+      continue;
+    }
+    // Search backwards for a matching command
+    for (nInd=nIndLater;nInd>0;nInd--) {
+      gslc_tsDispCmd* pCmdPrev = &asCmd[nInd-1];
+      if (pCmdPrev->eCmd == GSLC_DISPCMD_NONE) {
+        continue;
+      }
+      if ((pCmdPrev->eCmd == sCmd.eCmd) && (gslc_ColorEqual(pCmdPrev->nCol,sCmd.nCol))) {
+        break;
+      }
+      if ((pCmdPrev->rRect.w == 0) || (gslc_IsRectOverlap(pCmdPrev->rRect,sCmd.rRect))) {
+        // Can't move ahead of this command
+        nInd = nIndLater;
+        break;
+      }
+    }
+    if ((nInd == 0) || (nInd == nIndLater)) {
+      continue;
+    }
+    // Shift the commands in between and insert after the match
+    memmove(&asCmd[nInd+1],&asCmd[nInd],(nIndLater-nInd)*sizeof(gslc_tsDispCmd));
+    asCmd[nInd] = sCmd;
+  }
+
+  // Merge fills of the same color that together form a rectangle
+  // - Only consecutive commands are merged so that the drawing
+  //   order is unaffected
+  uint16_t  nIndPrev = nCnt;
+  for (nInd=0;nInd<nCnt;nInd++) {
+    gslc_tsDispCmd* pCmd = &asCmd[nInd];
+    if (pCmd->eCmd == GSLC_DISPCMD_NONE) {
+      continue;
+    }
+    if ((nIndPrev < nCnt) && (pCmd->eCmd == GSLC_DISPCMD_FILL_RECT) &&
+        (asCmd[nIndPrev].eCmd == GSLC_DISPCMD_FILL_RECT) &&
+        (gslc_ColorEqual(asCmd[nIndPrev].nCol,pCmd->nCol))) {
+      gslc_tsRect rPrev   = asCmd[nIndPrev].rRect;
+      gslc_tsRect rCur    = pCmd->rRect;
+      gslc_tsRect rTouchH = gslc_ExpandRect(rPrev,1,0);
+      gslc_tsRect rTouchV = gslc_ExpandRect(rPrev,0,1);
+      bool        bMerge  = false;
+      if ((rPrev.y == rCur.y) && (rPrev.h == rCur.h) && (gslc_IsRectOverlap(rTouchH,rCur))) {
+        bMerge = true;
+      } else if ((rPrev.x == rCur.x) && (rPrev.w == rCur.w) && (gslc_IsRectOverlap(rTouchV,rCur))) {
+        bMerge = true;
+      } else if ((gslc_IsRectInRect(rCur,rPrev)) || (gslc_IsRectInRect(rPrev,rCur))) {
+        bMerge = true;
+      }
+      if (bMerge) {
+        asCmd[nIndPrev].rRect = gslc_UnionRect(rPrev,rCur);
+        pCmd->eCmd = GSLC_DISPCMD_NONE;
+        continue;
+      }
+    }
+    nIndPrev = nInd;
+  }
+  #endif
+}
+
+void gslc_DispCmdExec(gslc_tsGui* pGui,gslc_tsDispCmd* pCmd)
+{
+  switch (pCmd->eCmd) {
+    case GSLC_DISPCMD_POINT:
+      gslc_DrawSetPixel(pGui,pCmd->rRect.x,pCmd->rRect.y,pCmd->nCol);
+      break;
+    case GSLC_DISPCMD_LINE:
+      gslc_DrawLine(pGui,pCmd->nX0,pCmd->nY0,pCmd->nX1,pCmd->nY1,pCmd->nCol);
+      break;
+    case GSLC_DISPCMD_FRAME_RECT:
+      gslc_DrawFrameRect(pGui,pCmd->rRect,pCmd->nCol);
+      break;
+    case GSLC_DISPCMD_FILL_RECT:
+      gslc_DrawFillRect(pGui,pCmd->rRect,pCmd->nCol);
+      break;
+    case GSLC_DISPCMD_TXT:
+      gslc_FontDrawTxt(pGui,pCmd->nX0,pCmd->nY0,pCmd->pTxtFont,pCmd->pStr,pCmd->eTxtFlags,pCmd->nCol);
+      break;
+    case GSLC_DISPCMD_IMAGE:
+      gslc_DrvDrawImage(pGui,pCmd->nX0,pCmd->nY0,pCmd->sImgRef);
+      break;
+    case GSLC_DISPCMD_BKGND:
+      gslc_DrvDrawBkgnd(pGui);
+      break;
+    case GSLC_DISPCMD_BKGND_RECT:
+      gslc_DrvDrawBkgndRect(pGui,pCmd->rRect);
+      break;
+    default:
+      break;
+  }
+}
+
+
 void gslc_PageFlipSet(gslc_tsGui* pGui,bool bNeeded)
 {
   pGui->pCurPage->bPageNeedFlip = bNeeded;
@@ -1408,6 +2203,235 @@ void gslc_ElemDraw(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId)
   gslc_ElemEvent(pGui,sEvent);
 }
 
+bool gslc_ElemFillOpaque(gslc_tsElem* pElem)
+{
+  if (!pElem->bFillEn) {
+    return false;
+  }
+  return (pElem->colElemFill.transp == 0) && (pElem->colElemFillGlow.transp == 0);
+}
+
+int16_t gslc_ElemCacheFind(gslc_tsGui* pGui,gslc_tsElem* pElem)
+{
+  #if (GSLC_ELEM_CACHE_MAX > 0)
+  uint8_t nInd;
+  for (nInd=0;nInd<pGui->nElemCacheCnt;nInd++) {
+    if (pGui->asElemCache[nInd].pElem == pElem) {
+      return nInd;
+    }
+  }
+  #endif
+  return -1;
+}
+
+void gslc_ElemCacheRelease(gslc_tsGui* pGui,int16_t nInd)
+{
+  #if (GSLC_ELEM_CACHE_MAX > 0)
+  uint32_t  nSize   = pGui->asElemCache[nInd].nSize;
+  uint32_t  nOffset = pGui->asElemCache[nInd].nOffset;
+  uint8_t   nIndNext;
+
+  // Move the pixels of the later caches down over the released space
+  memmove(&pGui->anElemCachePool[nOffset],&pGui->anElemCachePool[nOffset+nSize],
+    pGui->nElemCacheUsed - nOffset - nSize);
+  pGui->nElemCacheUsed -= nSize;
+  pGui->nElemCacheCnt--;
+  for (nIndNext=nInd;nIndNext<pGui->nElemCacheCnt;nIndNext++) {
+    pGui->asElemCache[nIndNext] = pGui->asElemCache[nIndNext+1];
+    pGui->asElemCache[nIndNext].nOffset -= nSize;
+  }
+  #endif
+}
+
+void* gslc_ImgCacheAcquire(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  if (sImgRef.eImgFlags == GSLC_IMGREF_NONE) {
+    return NULL;
+  }
+#if (GSLC_IMG_CACHE_MAX > 0)
+  gslc_tsImgCache*  pEntry;
+  uint8_t           nInd;
+  size_t            nFnameLen = 0;
+  bool              bFile = ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) ||
+                            ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_SD);
+
+  if (bFile) {
+    if (sImgRef.pFname == NULL) {
+      return NULL;
+    }
+    nFnameLen = strlen(sImgRef.pFname);
+  }
+
+  // Share the image if the same source has already been loaded
+  // - File entries hold their own copy of the path since the
+  //   caller's buffer may be freed or reused for another path
+  pGui->nImgCacheUseCnt++;
+  for (nInd=0;nInd<pGui->nImgCacheCnt;nInd++) {
+    pEntry = &pGui->asImgCache[nInd];
+    if (pEntry->sImgRef.eImgFlags != sImgRef.eImgFlags) {
+      continue;
+    }
+    if ((bFile) ? (strcmp(pEntry->acFname,sImgRef.pFname) != 0) :
+                  (pEntry->sImgRef.pImgBuf != sImgRef.pImgBuf)) {
+      continue;
+    }
+    pEntry->nRefCnt++;
+    pEntry->nLastUse = pGui->nImgCacheUseCnt;
+    pGui->nImgCacheHit++;
+    return pEntry->sImgRef.pvImgRaw;
+  }
+
+  void*     pvImg   = gslc_DrvLoadImage(pGui,sImgRef);
+  uint32_t  nBytes;
+  pGui->nImgCacheLoad++;
+  if (pvImg == NULL) {
+    // Nothing was preloaded (eg. image decoded during render)
+    return NULL;
+  }
+
+  // Register the image if there is room for it and its path.
+  // Otherwise it is used unshared and destroyed upon release.
+  nBytes = gslc_DrvGetImageBytes(pGui,pvImg);
+  if (nFnameLen >= GSLC_IMG_CACHE_PATH_MAX) {
+    return pvImg;
+  }
+  if (!gslc_ImgCacheTrim(pGui,nBytes)) {
+    return pvImg;
+  }
+  pEntry = &pGui->asImgCache[pGui->nImgCacheCnt];
+  pEntry->sImgRef           = sImgRef;
+  pEntry->sImgRef.pFname    = NULL;
+  pEntry->sImgRef.pvImgRaw  = pvImg;
+  pEntry->acFname[0]        = '\0';
+  if (bFile) {
+    memcpy(pEntry->acFname,sImgRef.pFname,nFnameLen+1);
+  }
+  pEntry->nBytes            = nBytes;
+  pEntry->nRefCnt           = 1;
+  pEntry->nLastUse          = pGui->nImgCacheUseCnt;
+  pGui->nImgCacheCnt++;
+  pGui->nImgCacheBytes     += nBytes;
+  return pvImg;
+#else
+  pGui->nImgCacheLoad++;
+  return gslc_DrvLoadImage(pGui,sImgRef);
+#endif
+}
+
+void gslc_ImgCacheRelease(gslc_tsGui* pGui,void* pvImg)
+{
+  if (pvImg == NULL) {
+    return;
+  }
+#if (GSLC_IMG_CACHE_MAX > 0)
+  uint8_t nInd;
+  for (nInd=0;nInd<pGui->nImgCacheCnt;nInd++) {
+    if (pGui->asImgCache[nInd].sImgRef.pvImgRaw == pvImg) {
+      if (pGui->asImgCache[nInd].nRefCnt > 0) {
+        pGui->asImgCache[nInd].nRefCnt--;
+      }
+      // Retain the image for reuse unless over budget
+      gslc_ImgCacheTrim(pGui,0);
+      return;
+    }
+  }
+#endif
+  // Image wasn't registered
+  gslc_DrvImageDestruct(pvImg);
+}
+
+bool gslc_ImgCacheTrim(gslc_tsGui* pGui,uint32_t nBytes)
+{
+#if (GSLC_IMG_CACHE_MAX > 0)
+  int16_t   nInd;
+  int16_t   nIndEvict;
+  uint32_t  nBytesUsed = 0;
+  uint8_t   nCntUsed   = 0;
+
+  // Only unreferenced images can be evicted, so check first that
+  // the new image can fit alongside the images still in use
+  for (nInd=0;nInd<pGui->nImgCacheCnt;nInd++) {
+    if (pGui->asImgCache[nInd].nRefCnt > 0) {
+      nBytesUsed += pGui->asImgCache[nInd].nBytes;
+      nCntUsed++;
+    }
+  }
+  if ((nBytes > 0) && ((nBytesUsed + nBytes > GSLC_IMG_CACHE_BYTES) || (nCntUsed >= GSLC_IMG_CACHE_MAX))) {
+    return false;
+  }
+  while (((pGui->nImgCacheCnt >= GSLC_IMG_CACHE_MAX) && (nBytes > 0)) ||
+         (pGui->nImgCacheBytes + nBytes > GSLC_IMG_CACHE_BYTES)) {
+    // Find the least recently used image that isn't referenced
+    nIndEvict = -1;
+    for (nInd=0;nInd<pGui->nImgCacheCnt;nInd++) {
+      if (pGui->asImgCache[nInd].nRefCnt > 0) {
+        continue;
+      }
+      if ((nIndEvict < 0) || (pGui->asImgCache[nInd].nLastUse < pGui->asImgCache[nIndEvict].nLastUse)) {
+        nIndEvict = nInd;
+      }
+    }
+    if (nIndEvict < 0) {
+      // Only images in use remain
+      return false;
+    }
+    gslc_DrvImageDestruct(pGui->asImgCache[nIndEvict].sImgRef.pvImgRaw);
+    pGui->nImgCacheBytes -= pGui->asImgCache[nIndEvict].nBytes;
+    pGui->nImgCacheCnt--;
+    for (nInd=nIndEvict;nInd<pGui->nImgCacheCnt;nInd++) {
+      pGui->asImgCache[nInd] = pGui->asImgCache[nInd+1];
+    }
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+void gslc_ElemCacheDraw(gslc_tsGui* pGui,gslc_tsElem* pElem)
+{
+  #if (GSLC_ELEM_CACHE_MAX > 0) && (DRV_HAS_COPY_RECT)
+  int16_t nInd = gslc_ElemCacheFind(pGui,pElem);
+  if (nInd >= 0) {
+    gslc_tsElemCache* pCache = &pGui->asElemCache[nInd];
+    gslc_tsRect       rElem  = pElem->rElem;
+    bool              bSame  = (pCache->rRect.x == rElem.x) && (pCache->rRect.y == rElem.y) &&
+                               (pCache->rRect.w == rElem.w) && (pCache->rRect.h == rElem.h);
+
+    // Copy the retained pixels back unless the element has changed
+    // - The copy is clipped by the driver
+    if ((pCache->bValid) && (bSame) && (!pElem->bNeedRedraw)) {
+      gslc_DispListFlush(pGui);
+      if (gslc_DrvCopyRectIn(pGui,rElem,&pGui->anElemCachePool[pCache->nOffset])) {
+        gslc_PageFlipSet(pGui,true);
+        return;
+      }
+    }
+    pCache->bValid = false;
+
+    // A resized element needs a cache of a different size
+    if ((pCache->rRect.w != rElem.w) || (pCache->rRect.h != rElem.h)) {
+      if (!gslc_ElemSetCacheEn(pGui,pElem,true)) {
+        (*pElem->pfuncXDraw)((void*)(pGui),(void*)(pElem));
+        return;
+      }
+      pCache = &pGui->asElemCache[gslc_ElemCacheFind(pGui,pElem)];
+    }
+
+    (*pElem->pfuncXDraw)((void*)(pGui),(void*)(pElem));
+
+    // Capture the result, but only if the whole element was drawn
+    if (gslc_IsRectInRect(rElem,pGui->rClipRect)) {
+      gslc_DispListFlush(pGui);
+      pCache->rRect  = rElem;
+      pCache->bValid = gslc_DrvCopyRectOut(pGui,rElem,&pGui->anElemCachePool[pCache->nOffset]);
+    }
+    return;
+  }
+  #endif
+  (*pElem->pfuncXDraw)((void*)(pGui),(void*)(pElem));
+}
+
 // Draw an element to the active display
 // - Element is referenced by an element pointer
 // - TODO: Handle GSLC_TYPE_BKGND
@@ -1418,6 +2442,15 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElem* pElem)
     return false;
   }    
   
+  // A resize changes the position of aligned text within the element
+  if ((pElem->rElemDrawn.w != pElem->rElem.w) || (pElem->rElemDrawn.h != pElem->rElem.h)) {
+    pElem->bTxtMetricsOk = false;
+  }
+
+  // Record the region being drawn so that a later move or
+  // resize can invalidate the region left behind
+  pElem->rElemDrawn = pElem->rElem;
+  
   // --------------------------------------------------------------------------
   // Custom drawing
   // --------------------------------------------------------------------------
@@ -1427,8 +2460,9 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElem* pElem)
   //   function supersede all default handling here
   // - Note that the end of the callback function is expected
   //   to clear the redraw flag
+  // - If the element is cached, the callback may be skipped
   if (pElem->pfuncXDraw != NULL) {
-    (*pElem->pfuncXDraw)((void*)(pGui),(void*)(pElem));
+    gslc_ElemCacheDraw(pGui,pElem);
     return true;
   }  
   
@@ -1469,8 +2503,8 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElem* pElem)
       gslc_DrawFillRect(pGui,rElemInner,pElem->colElemFill);
     }
   } else {
-    // TODO: If unfilled, then we might need
-    // to redraw the background layer(s)
+    // The background and lower elements beneath an unfilled
+    // element are redrawn by gslc_PageRedrawGo() beforehand
   }
 
   // --------------------------------------------------------------------------
@@ -1494,10 +2528,20 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElem* pElem)
   
   // Draw any images associated with element  
   if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_tsImgRef sImgRef = pElem->sImgRefNorm;
     if ((bGlowEn && bGlowing) && (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE)) { 
-      gslc_DrvDrawImage(pGui,nElemX,nElemY,pElem->sImgRefGlow);
+      sImgRef = pElem->sImgRefGlow;
+    }
+    if (pGui->bDispListRec) {
+      // The image dimensions aren't known here, so the
+      // command is left with an unknown region
+      gslc_tsDispCmd sCmd = {GSLC_DISPCMD_IMAGE};
+      sCmd.nX0      = nElemX;
+      sCmd.nY0      = nElemY;
+      sCmd.sImgRef  = sImgRef;
+      gslc_DispListAdd(pGui,sCmd);
     } else {
-      gslc_DrvDrawImage(pGui,nElemX,nElemY,pElem->sImgRefNorm);
+      gslc_DrvDrawImage(pGui,nElemX,nElemY,sImgRef);
     }
   }
 
@@ -1514,35 +2558,53 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElem* pElem)
   
   // Do we still want to render?
   if (bRenderTxt) {
-#if (DRV_HAS_DRAW_TEXT)    
     int16_t       nMargin   = pElem->nTxtMargin;
 
     // Determine the text color
     gslc_tsColor  colTxt    = (bGlowNow)? pElem->colElemTextGlow : pElem->colElemText;
   
-    // Fetch the size of the text to allow for justification
-    uint16_t      nTxtSzW,nTxtSzH;
-    gslc_DrvGetTxtSize(pGui,pElem->pTxtFont,pElem->pStrBuf,pElem->eTxtFlags,&nTxtSzW,&nTxtSzH);
-    
-    // Calculate the text alignment
-    int16_t       nTxtX,nTxtY;
-    
-    // Check for ALIGNH_LEFT & ALIGNH_RIGHT. Default to ALIGNH_MID
-    if      (pElem->eTxtAlign & GSLC_ALIGNH_LEFT)     { nTxtX = nElemX+nMargin; }
-    else if (pElem->eTxtAlign & GSLC_ALIGNH_RIGHT)    { nTxtX = nElemX+nElemW-nMargin-nTxtSzW; }
-    else                                              { nTxtX = nElemX+(nElemW/2)-(nTxtSzW/2); }
-
-    // Check for ALIGNV_TOP & ALIGNV_BOT. Default to ALIGNV_MID
-    if      (pElem->eTxtAlign & GSLC_ALIGNV_TOP)      { nTxtY = nElemY+nMargin; }
-    else if (pElem->eTxtAlign & GSLC_ALIGNV_BOT)      { nTxtY = nElemY+nElemH-nMargin-nTxtSzH; }
-    else                                              { nTxtY = nElemY+(nElemH/2)-(nTxtSzH/2); }    
+    // Measure the text and calculate its alignment, unless the
+    // results from a previous draw are still valid
+    if (!pElem->bTxtMetricsOk) {
+      uint16_t    nTxtSzW,nTxtSzH;
+      gslc_FontGetTxtSize(pGui,pElem->pTxtFont,pElem->pStrBuf,pElem->eTxtFlags,&nTxtSzW,&nTxtSzH);
+      pElem->nTxtSzW  = nTxtSzW;
+      pElem->nTxtSzH  = nTxtSzH;
+
+      // Check for ALIGNH_LEFT & ALIGNH_RIGHT. Default to ALIGNH_MID
+      if      (pElem->eTxtAlign & GSLC_ALIGNH_LEFT)   { pElem->nTxtOffX = nMargin; }
+      else if (pElem->eTxtAlign & GSLC_ALIGNH_RIGHT)  { pElem->nTxtOffX = nElemW-nMargin-nTxtSzW; }
+      else                                            { pElem->nTxtOffX = (nElemW/2)-(nTxtSzW/2); }
+
+      // Check for ALIGNV_TOP & ALIGNV_BOT. Default to ALIGNV_MID
+      if      (pElem->eTxtAlign & GSLC_ALIGNV_TOP)    { pElem->nTxtOffY = nMargin; }
+      else if (pElem->eTxtAlign & GSLC_ALIGNV_BOT)    { pElem->nTxtOffY = nElemH-nMargin-nTxtSzH; }
+      else                                            { pElem->nTxtOffY = (nElemH/2)-(nTxtSzH/2); }
+
+      pElem->bTxtMetricsOk = true;
+    }
+    uint16_t      nTxtSzW   = pElem->nTxtSzW;
+    uint16_t      nTxtSzH   = pElem->nTxtSzH;
+    int16_t       nTxtX     = nElemX + pElem->nTxtOffX;
+    int16_t       nTxtY     = nElemY + pElem->nTxtOffY;
 
     // Call the driver text rendering routine
-    gslc_DrvDrawTxt(pGui,nTxtX,nTxtY,pElem->pTxtFont,pElem->pStrBuf,pElem->eTxtFlags,colTxt);
-    
-#else
-    // No text support in driver, so skip
-#endif
+    // - The string in the temporary element is only valid during
+    //   this call, so it can't be recorded in the display list
+    if ((pGui->bDispListRec) && (pElem != &pGui->sElemTmp)) {
+      gslc_tsDispCmd sCmd = {GSLC_DISPCMD_TXT};
+      sCmd.rRect      = (gslc_tsRect){nTxtX,nTxtY,nTxtSzW,nTxtSzH};
+      sCmd.nCol       = colTxt;
+      sCmd.nX0        = nTxtX;
+      sCmd.nY0        = nTxtY;
+      sCmd.pTxtFont   = pElem->pTxtFont;
+      sCmd.pStr       = pElem->pStrBuf;
+      sCmd.eTxtFlags  = pElem->eTxtFlags;
+      gslc_DispListAdd(pGui,sCmd);
+    } else {
+      gslc_DispListFlush(pGui);
+      gslc_FontDrawTxt(pGui,nTxtX,nTxtY,pElem->pTxtFont,pElem->pStrBuf,pElem->eTxtFlags,colTxt);
+    }
   }
 
   // Mark the element as no longer requiring redraw
@@ -1602,6 +2664,17 @@ void gslc_ElemSetGlowCol(gslc_tsElem* pElem,gslc_tsColor colFrameGlow,gslc_tsCol
   gslc_ElemSetRedraw(pElem,true); 
 }
 
+void gslc_ElemSetFillAlpha(gslc_tsElem* pElem,uint8_t nAlpha)
+{
+  if (pElem == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: ElemSetFillAlpha(%s) called with NULL ptr\n","");
+    return;
+  }
+  pElem->colElemFill.transp     = 255 - nAlpha;
+  pElem->colElemFillGlow.transp = 255 - nAlpha;
+  gslc_ElemSetRedraw(pElem,true);
+}
+
 void gslc_ElemSetGroup(gslc_tsElem* pElem,int nGroupId)
 {
   if (pElem == NULL) {
@@ -1628,6 +2701,7 @@ void gslc_ElemSetTxtAlign(gslc_tsElem* pElem,unsigned nAlign)
     return;
   }    
   pElem->eTxtAlign        = nAlign;
+  pElem->bTxtMetricsOk    = false;
   gslc_ElemSetRedraw(pElem,true);  
 }
 
@@ -1638,6 +2712,7 @@ void gslc_ElemSetTxtMargin(gslc_tsElem* pElem,unsigned nMargin)
     return;
   }    
   pElem->nTxtMargin        = nMargin;
+  pElem->bTxtMetricsOk    = false;
   gslc_ElemSetRedraw(pElem,true);  
 }
 
@@ -1660,6 +2735,7 @@ void gslc_ElemSetTxtStr(gslc_tsElem* pElem,const char* pStr)
   if (strncmp(pElem->pStrBuf,pStr,pElem->nStrBufMax-1)) {
     strncpy(pElem->pStrBuf,pStr,pElem->nStrBufMax-1);
     pElem->pStrBuf[pElem->nStrBufMax-1] = '\0';  // Force termination
+    pElem->bTxtMetricsOk    = false;
     gslc_ElemSetRedraw(pElem,true);
   }
 }
@@ -1692,6 +2768,7 @@ void gslc_ElemSetTxtMem(gslc_tsElem* pElem,gslc_teTxtFlags eFlags)
   }
   gslc_teTxtFlags eFlagsCur = pElem->eTxtFlags;  
   pElem->eTxtFlags = (eFlagsCur & ~GSLC_TXT_MEM) | (eFlags & GSLC_TXT_MEM); 
+  pElem->bTxtMetricsOk    = false;
 }
 
 void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElem* pElem,int nFontId)
@@ -1701,6 +2778,7 @@ void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElem* pElem,int nFontId)
     return;
   }
   pElem->pTxtFont = gslc_FontGet(pGui,nFontId);
+  pElem->bTxtMetricsOk    = false;
   gslc_ElemSetRedraw(pElem,true);
 }
 
@@ -1811,6 +2889,7 @@ void gslc_ElemSetStyleFrom(gslc_tsElem* pElemSrc,gslc_tsElem* pElemDest)
   pElemDest->eTxtAlign        = pElemSrc->eTxtAlign;
   pElemDest->nTxtMargin       = pElemSrc->nTxtMargin;
   pElemDest->pTxtFont         = pElemSrc->pTxtFont;
+  pElemDest->bTxtMetricsOk    = false;
 
   // pXData
   
@@ -1842,6 +2921,67 @@ void gslc_ElemSetDrawFunc(gslc_tsElem* pElem,GSLC_CB_DRAW funcCb)
   gslc_ElemSetRedraw(pElem,true);   
 }
 
+bool gslc_ElemSetCacheEn(gslc_tsGui* pGui,gslc_tsElem* pElem,bool bCacheEn)
+{
+  if ((pGui == NULL) || (pElem == NULL)) {
+    GSLC_DEBUG_PRINT("ERROR: ElemSetCacheEn(%s) called with NULL ptr\n","");
+    return false;
+  }
+  int16_t nInd = gslc_ElemCacheFind(pGui,pElem);
+  if (!bCacheEn) {
+    if (nInd >= 0) {
+      gslc_ElemCacheRelease(pGui,nInd);
+    }
+    return true;
+  }
+
+  #if (GSLC_ELEM_CACHE_MAX > 0) && (DRV_HAS_COPY_RECT)
+  uint32_t nSize = gslc_DrvCopyRectSize(pGui,pElem->rElem.w,pElem->rElem.h);
+  if (nInd >= 0) {
+    if (pGui->asElemCache[nInd].nSize == nSize) {
+      return true;
+    }
+    // The element has been resized, so reallocate the cache
+    gslc_ElemCacheRelease(pGui,nInd);
+  }
+  if (nSize == 0) {
+    return false;
+  }
+  if (pGui->nElemCacheCnt >= GSLC_ELEM_CACHE_MAX) {
+    GSLC_DEBUG_PRINT("ERROR: ElemSetCacheEn(%s) exceeded GSLC_ELEM_CACHE_MAX\n","");
+    return false;
+  }
+  if (pGui->nElemCacheUsed + nSize > GSLC_ELEM_CACHE_BYTES) {
+    GSLC_DEBUG_PRINT("ERROR: ElemSetCacheEn(%s) exceeded GSLC_ELEM_CACHE_BYTES\n","");
+    return false;
+  }
+  // Caches are packed in the order they are allocated
+  gslc_tsElemCache* pCache = &pGui->asElemCache[pGui->nElemCacheCnt];
+  pCache->pElem   = pElem;
+  pCache->rRect   = pElem->rElem;
+  pCache->nOffset = pGui->nElemCacheUsed;
+  pCache->nSize   = nSize;
+  pCache->bValid  = false;
+  pGui->nElemCacheCnt++;
+  pGui->nElemCacheUsed += nSize;
+  return true;
+  #else
+  // Caching is disabled or the driver can't copy display regions
+  return false;
+  #endif
+}
+
+uint32_t gslc_ElemGetCacheSize(gslc_tsGui* pGui,gslc_tsElem* pElem)
+{
+  #if (GSLC_ELEM_CACHE_MAX > 0)
+  int16_t nInd = gslc_ElemCacheFind(pGui,pElem);
+  if (nInd >= 0) {
+    return pGui->asElemCache[nInd].nSize;
+  }
+  #endif
+  return 0;
+}
+
 void gslc_ElemSetTickFunc(gslc_tsElem* pElem,GSLC_CB_TICK funcCb)
 {
   if ((pElem == NULL) || (funcCb == NULL)) {
@@ -2246,9 +3386,28 @@ bool gslc_CollectEvent(void* pvGui,gslc_tsEvent sEvent)
       // Fetch the element pointer from the reference array
       pElem = pCollect->asElemRef[nInd].pElem; 
       
-      // Copy event so we can modify it in the loop
-      gslc_tsEvent sEventNew = sEvent;
-      
+      #if (GSLC_DRAW_CULL_EN)
+      // During a forced redraw, skip any element that will be
+      // completely overdrawn by an opaque element drawn later
+      if ((sEvent.eType == GSLC_EVT_DRAW) && (sEvent.nSubType == GSLC_EVTSUB_DRAW_FORCE)) {
+        if (gslc_CollectElemOccluded(pGui,pCollect,nInd)) {
+          pGui->nDrawCulledCnt++;
+          if ((eFlags & GSLC_ELEMREF_SRC) != GSLC_ELEMREF_SRC_PROG) {
+            // Treat the element as drawn so that it doesn't get
+            // redrawn over the occluding element on the next update
+            // - As it isn't visible, it doesn't leave anything
+            //   behind if it is later moved
+            pElem->bNeedRedraw = false;
+            pElem->rElemDrawn = (gslc_tsRect){0,0,0,0};
+          }
+          continue;
+        }
+      }
+      #endif
+
+      // Copy event so we can modify it in the loop
+      gslc_tsEvent sEventNew = sEvent;
+      
       // If it is an external reference (eg. flash), copy to temp element
       if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_PROG) {
         #if (GSLC_USE_PROGMEM)        
@@ -2341,6 +3500,106 @@ gslc_tsElem* gslc_CollectElemAdd(gslc_tsCollect* pCollect,const gslc_tsElem* pEl
 }
 
 
+void gslc_CollectRedrawRgn(gslc_tsGui* pGui,gslc_tsCollect* pCollect,gslc_tsRect rRgn)
+{
+  if ((pGui == NULL) || (pCollect == NULL)) {
+    GSLC_DEBUG_PRINT("ERROR: CollectRedrawRgn(%s) called with NULL ptr\n","");
+    return;
+  }
+  uint16_t      nInd;
+  gslc_tsElem*  pElem = NULL;
+  
+  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    pElem = pCollect->asElemRef[nInd].pElem;
+    
+    #if (GSLC_USE_PROGMEM)
+    // If it is an external reference (eg. flash), copy to temp element
+    gslc_teElemRefFlags eFlags = pCollect->asElemRef[nInd].eElemFlags;
+    if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_PROG) {
+      memcpy_P(&pGui->sElemTmp,pElem,sizeof(gslc_tsElem));
+      pElem = &pGui->sElemTmp;
+    }
+    #endif
+    
+    if (!gslc_IsRectOverlap(pElem->rElem,rRgn)) {
+      continue;
+    }
+    
+    // An element that extends beyond the region is only partially
+    // drawn here, so it must retain any pending redraw request
+    bool bNeedRedraw = pElem->bNeedRedraw;
+    gslc_ElemDrawByRef(pGui,pElem);
+    if (!gslc_IsRectInRect(pElem->rElem,rRgn)) {
+      pElem->bNeedRedraw = bNeedRedraw;
+    }
+  }
+}
+
+
+bool gslc_CollectElemOccluded(gslc_tsGui* pGui,gslc_tsCollect* pCollect,uint16_t nElemInd)
+{
+  if ((pGui == NULL) || (pCollect == NULL)) {
+    GSLC_DEBUG_PRINT("ERROR: CollectElemOccluded(%s) called with NULL ptr\n","");
+    return false;
+  }
+  uint16_t      nInd;
+  gslc_tsElem*  pElem = NULL;
+  gslc_tsRect   rElem = {0,0,0,0};
+
+  for (nInd=nElemInd;nInd<pCollect->nElemRefCnt;nInd++) {
+    pElem = pCollect->asElemRef[nInd].pElem;
+
+    #if (GSLC_USE_PROGMEM)
+    // If it is an external reference (eg. flash), copy to temp element
+    gslc_teElemRefFlags eFlags = pCollect->asElemRef[nInd].eElemFlags;
+    if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_PROG) {
+      memcpy_P(&pGui->sElemTmp,pElem,sizeof(gslc_tsElem));
+      pElem = &pGui->sElemTmp;
+    }
+    #endif
+
+    if (nInd == nElemInd) {
+      // Save the region of the element being checked
+      rElem = pElem->rElem;
+      continue;
+    }
+
+    // Only the default drawing guarantees that the whole
+    // element rect is overwritten
+    if ((!gslc_ElemFillOpaque(pElem)) || (pElem->pfuncXDraw != NULL)) {
+      continue;
+    }
+    if (gslc_IsRectInRect(rElem,pElem->rElem)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+bool gslc_SchedDue(uint32_t nNow,uint32_t* pnLast,uint16_t nInterval)
+{
+  if (nInterval == 0) {
+    return true;
+  }
+  // Unsigned arithmetic handles wrap of the time base
+  if ((uint32_t)(nNow - *pnLast) < nInterval) {
+    return false;
+  }
+  *pnLast = nNow;
+  return true;
+}
+
+uint16_t gslc_SchedRemain(uint32_t nNow,uint32_t nLast,uint16_t nInterval)
+{
+  uint32_t nElapsed = nNow - nLast;
+  if (nElapsed >= nInterval) {
+    return 0;
+  }
+  return (uint16_t)(nInterval - nElapsed);
+}
+
+
 bool gslc_CollectGetRedraw(gslc_tsCollect* pCollect)
 {
   if (pCollect == NULL) {
@@ -2402,6 +3661,23 @@ gslc_tsElem* gslc_ElemAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* pElem,gs
 
 bool gslc_SetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
+  // The recorded drawing commands must be submitted with the
+  // clipping rect that was active when they were issued
+  gslc_DispListFlush(pGui);
+
+  // Track the clip rectangle in the core so that primitives
+  // emulated in software can be clipped before rasterizing
+  pGui->rClipRect = (gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH};
+  if (pRect != NULL) {
+    gslc_tsRect rClip = *pRect;
+    if (!gslc_ClipRect(&pGui->rClipRect,&rClip)) {
+      // Region is entirely off-screen
+      rClip.w = 0;
+      rClip.h = 0;
+    }
+    pGui->rClipRect = rClip;
+  }
+
   // Update the drawing clip rectangle
   if (pRect == NULL) {
     // Set to full size of screen
@@ -2504,6 +3780,13 @@ void gslc_ResetElem(gslc_tsElem* pElem)
   pElem->pfuncXTick       = NULL;
   
   pElem->pElemParent      = NULL;
+  
+  pElem->rElemDrawn       = (gslc_tsRect){0,0,0,0};
+  pElem->bTxtMetricsOk    = false;
+  pElem->nTxtSzW          = 0;
+  pElem->nTxtSzH          = 0;
+  pElem->nTxtOffX         = 0;
+  pElem->nTxtOffY         = 0;
 
 }
 
@@ -2517,22 +3800,844 @@ void gslc_ResetFont(gslc_tsFont* pFont)
   pFont->nId    = GSLC_FONT_NONE;
   pFont->pvFont = NULL;
   pFont->nSize  = 0;
+  pFont->eFontRefType = GSLC_FONTREF_FNAME;
+  pFont->nAscent  = 0;
+  pFont->nDescent = 0;
+}
+
+
+int32_t gslc_DivFloor(int32_t nNum,int32_t nDen)
+{
+  if (nNum >= 0) {
+    return nNum / nDen;
+  }
+  return -((nDen - 1 - nNum) / nDen);
+}
+
+
+// Draw the visible portion of a line with Bresenham's algorithm
+// - The line is described by its major axis (the axis with the larger
+//   extent, which advances on every step) and its minor axis.
+// - After nStep major steps the error term of the reference algorithm
+//   in gslc_DrawLine() is (nMajor/2 - nStep*nMinor) mod nMajor, so the
+//   number of minor steps taken can be computed directly. This allows
+//   the start and end of the visible range to be located without
+//   walking the hidden pixels.
+void gslc_DrawLineClipSpans(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  gslc_tsRect* pClip = &pGui->rClipRect;
+  if ((pClip->w == 0) || (pClip->h == 0)) {
+    return;
+  }
+  int16_t nDX    = abs(nX1-nX0);
+  int16_t nDY    = abs(nY1-nY0);
+  bool    bXMaj  = (nDX > nDY);
+
+  // Express the line and clip region in major / minor axis terms
+  int32_t nMajor = (bXMaj)? nDX : nDY;
+  int32_t nMinor = (bXMaj)? nDY : nDX;
+  int32_t nMaj0  = (bXMaj)? nX0 : nY0;
+  int32_t nMin0  = (bXMaj)? nY0 : nX0;
+  int32_t nSMaj  = (bXMaj)? ((nX0 < nX1)? 1 : -1) : ((nY0 < nY1)? 1 : -1);
+  int32_t nSMin  = (bXMaj)? ((nY0 < nY1)? 1 : -1) : ((nX0 < nX1)? 1 : -1);
+  int32_t nCMaj0 = (bXMaj)? pClip->x : pClip->y;
+  int32_t nCMaj1 = nCMaj0 + ((bXMaj)? pClip->w : pClip->h) - 1;
+  int32_t nCMin0 = (bXMaj)? pClip->y : pClip->x;
+  int32_t nCMin1 = nCMin0 + ((bXMaj)? pClip->h : pClip->w) - 1;
+  int32_t nHalf  = nMajor/2;
+
+  // Determine the range of steps inside the clip on the major axis
+  int32_t nStepLo = (nSMaj > 0)? nCMaj0 - nMaj0 : nMaj0 - nCMaj1;
+  int32_t nStepHi = (nSMaj > 0)? nCMaj1 - nMaj0 : nMaj0 - nCMaj0;
+
+  // Narrow the range to the steps inside the clip on the minor axis
+  // - The number of minor steps taken by step i is
+  //   -floor((nHalf - i*nMinor) / nMajor), which never decreases
+  int32_t nMinStepLo = (nSMin > 0)? nCMin0 - nMin0 : nMin0 - nCMin1;
+  int32_t nMinStepHi = (nSMin > 0)? nCMin1 - nMin0 : nMin0 - nCMin0;
+  int32_t nStepMin;
+  nStepMin = gslc_DivFloor((nMinStepLo-1)*nMajor + nHalf,nMinor) + 1;
+  if (nStepMin > nStepLo) { nStepLo = nStepMin; }
+  nStepMin = gslc_DivFloor(nMinStepHi*nMajor + nHalf,nMinor);
+  if (nStepMin < nStepHi) { nStepHi = nStepMin; }
+
+  // Restrict to the extent of the line itself
+  if (nStepLo < 0)      { nStepLo = 0; }
+  if (nStepHi > nMajor) { nStepHi = nMajor; }
+  if (nStepLo > nStepHi) {
+    return;
+  }
+
+  // Resume the algorithm at the first visible step
+  int32_t nMinSteps = -gslc_DivFloor(nHalf - nStepLo*nMinor,nMajor);
+  int32_t nErr      = nHalf - nStepLo*nMinor + nMinSteps*nMajor;
+  int32_t nMaj      = nMaj0 + nSMaj*nStepLo;
+  int32_t nMin      = nMin0 + nSMin*nMinSteps;
+  int32_t nRunMaj   = nMaj;
+  int32_t nStep;
+  bool    bMinStep;
+
+  // Pixels that share a minor coordinate are drawn as one span
+  for (nStep=nStepLo;nStep<=nStepHi;nStep++) {
+    bMinStep = (nErr < nMinor);
+    nErr -= nMinor;
+    if (bMinStep) { nErr += nMajor; }
+    if ((bMinStep) || (nStep == nStepHi)) {
+      int16_t  nSpanMaj = (nSMaj > 0)? nRunMaj : nMaj;
+      uint16_t nSpanLen = (nSMaj > 0)? nMaj-nRunMaj+1 : nRunMaj-nMaj+1;
+      if (bXMaj) {
+        gslc_DrawSpanH(pGui,nSpanMaj,nMin,nSpanLen,nCol);
+      } else {
+        gslc_DrawSpanV(pGui,nMin,nSpanMaj,nSpanLen,nCol);
+      }
+      nMin    += nSMin;
+      nRunMaj  = nMaj + nSMaj;
+    }
+    nMaj += nSMaj;
+  }
+}
+
+// Approximate sine with Bhaskara I's formula, which avoids
+// floating point and is accurate to within 0.002
+int16_t gslc_SinDeg(int32_t nAng)
+{
+  int32_t nSign = 1;
+  nAng = ((nAng % 360) + 360) % 360;
+  if (nAng >= 180) {
+    nAng -= 180;
+    nSign = -1;
+  }
+  int32_t nProd = nAng * (180 - nAng);
+  return (int16_t)(nSign * (4096 * nProd) / (40500 - nProd));
+}
+
+uint16_t gslc_SqrtInt(uint32_t nVal)
+{
+  // Bitwise integer square root
+  uint32_t nRoot = 0;
+  uint32_t nBit  = (uint32_t)1 << 30;
+  while (nBit > nVal) {
+    nBit >>= 2;
+  }
+  while (nBit != 0) {
+    if (nVal >= nRoot + nBit) {
+      nVal  -= nRoot + nBit;
+      nRoot  = (nRoot >> 1) + nBit;
+    } else {
+      nRoot >>= 1;
+    }
+    nBit >>= 2;
+  }
+  return (uint16_t)nRoot;
+}
+
+
+bool gslc_FontGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,
+  gslc_teTxtFlags eTxtFlags,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH)
+{
+  if ((pFont != NULL) && (pFont->eFontRefType != GSLC_FONTREF_FNAME)) {
+    return gslc_FontBmpGetTxtSize(pGui,pFont,pStr,eTxtFlags,pnTxtSzW,pnTxtSzH);
+  }
+#if (DRV_HAS_DRAW_TEXT)
+  return gslc_DrvGetTxtSize(pGui,pFont,pStr,eTxtFlags,pnTxtSzW,pnTxtSzH);
+#else
+  // No text support in driver
+  *pnTxtSzW = 0;
+  *pnTxtSzH = 0;
+  return false;
+#endif
+}
+
+bool gslc_FontDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,
+  const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt)
+{
+  if ((pFont != NULL) && (pFont->eFontRefType != GSLC_FONTREF_FNAME)) {
+    return gslc_FontBmpDrawTxt(pGui,nTxtX,nTxtY,pFont,pStr,eTxtFlags,colTxt);
+  }
+#if (DRV_HAS_DRAW_TEXT)
+  return gslc_DrvDrawTxt(pGui,nTxtX,nTxtY,pFont,pStr,eTxtFlags,colTxt);
+#else
+  // No text support in driver, so skip
+  return false;
+#endif
+}
+
+void gslc_FontBmpGetDesc(gslc_tsFont* pFont,gslc_tsFontBmp* pFontBmp)
+{
+#if (GSLC_USE_PROGMEM)
+  if (pFont->eFontRefType == GSLC_FONTREF_PTR_PROG) {
+    memcpy_P(pFontBmp,pFont->pvFont,sizeof(gslc_tsFontBmp));
+    return;
+  }
+#endif
+  *pFontBmp = *(const gslc_tsFontBmp*)(pFont->pvFont);
+}
+
+bool gslc_FontBmpGetGlyph(gslc_tsFont* pFont,const gslc_tsFontBmp* pFontBmp,uint16_t nChar,gslc_tsFontBmpGlyph* pGlyph)
+{
+  if ((nChar < pFontBmp->nFirst) || (nChar > pFontBmp->nLast)) {
+    return false;
+  }
+  const gslc_tsFontBmpGlyph* pSrc = &pFontBmp->pGlyph[nChar - pFontBmp->nFirst];
+#if (GSLC_USE_PROGMEM)
+  if (pFont->eFontRefType == GSLC_FONTREF_PTR_PROG) {
+    memcpy_P(pGlyph,pSrc,sizeof(gslc_tsFontBmpGlyph));
+    return true;
+  }
+#endif
+  *pGlyph = *pSrc;
+  return true;
+}
+
+bool gslc_FontBmpGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,
+  gslc_teTxtFlags eTxtFlags,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH)
+{
+  gslc_tsFontBmp      sFontBmp;
+  gslc_tsFontBmpGlyph sGlyph;
+  uint16_t            nScale  = (pFont->nSize > 0)? pFont->nSize : 1;
+  uint16_t            nTxtW   = 0;
+  char                ch;
+
+  gslc_FontBmpGetDesc(pFont,&sFontBmp);
+  while (pStr != NULL) {
+    #if (GSLC_USE_PROGMEM)
+    ch = ((eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_PROG)? pgm_read_byte(pStr) : *pStr;
+    #else
+    ch = *pStr;
+    #endif
+    if (ch == '\0') {
+      break;
+    }
+    pStr++;
+    if (gslc_FontBmpGetGlyph(pFont,&sFontBmp,(uint8_t)ch,&sGlyph)) {
+      nTxtW += sGlyph.nAdvanceX;
+    }
+  }
+  *pnTxtSzW = nTxtW * nScale;
+  *pnTxtSzH = (pFont->nAscent + pFont->nDescent) * nScale;
+  return true;
+}
+
+bool gslc_FontBmpDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,
+  const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt)
+{
+  gslc_tsFontBmp      sFontBmp;
+  gslc_tsFontBmpGlyph sGlyph;
+  uint16_t            nScale    = (pFont->nSize > 0)? pFont->nSize : 1;
+  int16_t             nCursorX  = nTxtX;
+  int16_t             nBaseY    = nTxtY + pFont->nAscent*nScale;
+  const uint8_t*      pBits;
+  uint8_t             nBits     = 0;
+  uint8_t             nBitCnt;
+  uint8_t             nRow;
+  uint16_t            nCol,nLine;
+  int16_t             nRunStart;
+  bool                bSet;
+  char                ch;
+
+  if (pStr == NULL) {
+    return true;
+  }
+  gslc_FontBmpGetDesc(pFont,&sFontBmp);
+  while (1) {
+    #if (GSLC_USE_PROGMEM)
+    ch = ((eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_PROG)? pgm_read_byte(pStr) : *pStr;
+    #else
+    ch = *pStr;
+    #endif
+    if (ch == '\0') {
+      break;
+    }
+    pStr++;
+    if (!gslc_FontBmpGetGlyph(pFont,&sFontBmp,(uint8_t)ch,&sGlyph)) {
+      continue;
+    }
+
+    // Skip glyphs that are entirely clipped
+    gslc_tsRect rGlyph = {nCursorX + sGlyph.nOffsetX*nScale,nBaseY + sGlyph.nOffsetY*nScale,
+      sGlyph.nWidth*nScale,sGlyph.nHeight*nScale};
+    if ((rGlyph.w == 0) || (rGlyph.h == 0) || (!gslc_IsRectOverlap(rGlyph,pGui->rClipRect))) {
+      nCursorX += sGlyph.nAdvanceX*nScale;
+      continue;
+    }
+
+    // Draw each run of set pixels in a row as a single span
+    // - The glyph bits continue from one row to the next
+    // - The column loop runs one past the glyph width to end the
+    //   last run, so its counter is wider than the width
+    pBits   = sFontBmp.pBitmap + sGlyph.nBitmapOffset;
+    nBitCnt = 0;
+    for (nRow=0;nRow<sGlyph.nHeight;nRow++) {
+      nRunStart = -1;
+      for (nCol=0;nCol<=sGlyph.nWidth;nCol++) {
+        bSet = false;
+        if (nCol < sGlyph.nWidth) {
+          if (nBitCnt == 0) {
+            #if (GSLC_USE_PROGMEM)
+            nBits = (pFont->eFontRefType == GSLC_FONTREF_PTR_PROG)? pgm_read_byte(pBits) : *pBits;
+            #else
+            nBits = *pBits;
+            #endif
+            pBits++;
+            nBitCnt = 8;
+          }
+          bSet = (nBits & 0x80);
+          nBits <<= 1;
+          nBitCnt--;
+        }
+        if ((bSet) && (nRunStart < 0)) {
+          nRunStart = nCol;
+        } else if ((!bSet) && (nRunStart >= 0)) {
+          for (nLine=0;nLine<nScale;nLine++) {
+            gslc_DrawSpanH(pGui,rGlyph.x + nRunStart*nScale,rGlyph.y + nRow*nScale + nLine,
+              (nCol-nRunStart)*nScale,colTxt);
+          }
+          nRunStart = -1;
+        }
+      }
+    }
+    nCursorX += sGlyph.nAdvanceX*nScale;
+  }
+  gslc_PageFlipSet(pGui,true);
+  return true;
+}
+
+void gslc_DrawSpanH(gslc_tsGui* pGui,int32_t nX,int32_t nY,int32_t nW,gslc_tsColor nCol)
+{
+  // Clip before drawing so that the fallbacks below
+  // only cover the visible pixels
+  // - Clipping is done in 32 bits so that the spans of shapes
+  //   much larger than the display don't wrap
+  gslc_tsRect* pClip = &pGui->rClipRect;
+  int32_t      nX1   = nX + nW - 1;
+  if ((nW <= 0) || (nY < pClip->y) || (nY > pClip->y + pClip->h - 1)) {
+    return;
+  }
+  if (nX < pClip->x) {
+    nX = pClip->x;
+  }
+  if (nX1 > pClip->x + pClip->w - 1) {
+    nX1 = pClip->x + pClip->w - 1;
+  }
+  if (nX > nX1) {
+    return;
+  }
+  nW = nX1 - nX + 1;
+
+#if (DRV_HAS_DRAW_LINE_H)
+  // Call optimized driver span drawing
+  gslc_DrvDrawLineH(pGui,nX,nY,nW,nCol);
+#elif (DRV_HAS_DRAW_RECT_FILL)
+  // Emulate the span with a one-pixel high fill
+  gslc_DrvDrawFillRect(pGui,(gslc_tsRect){nX,nY,nW,1},nCol);
+#else
+  uint16_t nOffset;
+  for (nOffset=0;nOffset<nW;nOffset++) {
+    gslc_DrvDrawPoint(pGui,nX+nOffset,nY,nCol);    
+  }  
+#endif
+}
+
+void gslc_DrawSpanV(gslc_tsGui* pGui,int32_t nX,int32_t nY,int32_t nH,gslc_tsColor nCol)
+{
+  // Clip before drawing so that the fallbacks below
+  // only cover the visible pixels
+  // - Clipping is done in 32 bits as in gslc_DrawSpanH()
+  gslc_tsRect* pClip = &pGui->rClipRect;
+  int32_t      nY1   = nY + nH - 1;
+  if ((nH <= 0) || (nX < pClip->x) || (nX > pClip->x + pClip->w - 1)) {
+    return;
+  }
+  if (nY < pClip->y) {
+    nY = pClip->y;
+  }
+  if (nY1 > pClip->y + pClip->h - 1) {
+    nY1 = pClip->y + pClip->h - 1;
+  }
+  if (nY > nY1) {
+    return;
+  }
+  nH = nY1 - nY + 1;
+
+#if (DRV_HAS_DRAW_LINE_V)
+  // Call optimized driver span drawing
+  gslc_DrvDrawLineV(pGui,nX,nY,nH,nCol);
+#elif (DRV_HAS_DRAW_RECT_FILL)
+  // Emulate the span with a one-pixel wide fill
+  gslc_DrvDrawFillRect(pGui,(gslc_tsRect){nX,nY,1,nH},nCol);
+#else
+  uint16_t nOffset;
+  for (nOffset=0;nOffset<nH;nOffset++) {
+    gslc_DrvDrawPoint(pGui,nX,nY+nOffset,nCol);    
+  }
+#endif
+}
+
+// Draw the outline of a rounded rectangle using the midpoint circle
+// algorithm for the corners
+// - Each octant point is offset to the center of its corner, so a
+//   single pixel rInner produces a circle
+void gslc_DrawRoundFrame(gslc_tsGui* pGui,gslc_tsRect rInner,uint16_t nRadius,gslc_tsColor nCol)
+{
+  int32_t nXL   = rInner.x;
+  int32_t nXR   = rInner.x + rInner.w - 1;
+  int32_t nYT   = rInner.y;
+  int32_t nYB   = rInner.y + rInner.h - 1;
+  int32_t nX    = nRadius;
+  int32_t nY    = 0;
+  int32_t nErr  = 0;
+  int32_t nClipT = pGui->rClipRect.y;
+  int32_t nClipB = pGui->rClipRect.y + pGui->rClipRect.h - 1;
+
+  // Nothing to draw if the outline is entirely above or below the
+  // clipping region
+  if ((nYT - nX > nClipB) || (nYB + nX < nClipT)) {
+    return;
+  }
+
+  // The eight octant points of each step are clipped here in 32 bits
+  // since the points of large corners don't fit in gslc_tsPt
+  int32_t nClipL = pGui->rClipRect.x;
+  int32_t nClipR = pGui->rClipRect.x + pGui->rClipRect.w - 1;
+  int32_t anPtX[8];
+  int32_t anPtY[8];
+  uint8_t nInd;
+  #if (DRV_HAS_DRAW_POINTS)
+    // Points from two consecutive steps are submitted together
+    // so that the driver can merge neighbouring points into spans
+    gslc_tsPt asPt[16];
+    uint8_t   nNumPt = 0;
+  #endif
+  while ((nX >= nY) && ((nYT - nY >= nClipT) || (nYB + nY <= nClipB)))
+  {
+    anPtX[0] = nXR + nX; anPtY[0] = nYB + nY;
+    anPtX[1] = nXR + nY; anPtY[1] = nYB + nX;
+    anPtX[2] = nXL - nY; anPtY[2] = nYB + nX;
+    anPtX[3] = nXL - nX; anPtY[3] = nYB + nY;
+    anPtX[4] = nXL - nX; anPtY[4] = nYT - nY;
+    anPtX[5] = nXL - nY; anPtY[5] = nYT - nX;
+    anPtX[6] = nXR + nY; anPtY[6] = nYT - nX;
+    anPtX[7] = nXR + nX; anPtY[7] = nYT - nY;
+    for (nInd=0;nInd<8;nInd++) {
+      if ((anPtX[nInd] < nClipL) || (anPtX[nInd] > nClipR) ||
+          (anPtY[nInd] < nClipT) || (anPtY[nInd] > nClipB)) {
+        continue;
+      }
+      #if (DRV_HAS_DRAW_POINTS)
+        asPt[nNumPt++] = (gslc_tsPt){anPtX[nInd],anPtY[nInd]};
+      #elif (DRV_HAS_DRAW_POINT)
+        gslc_DrvDrawPoint(pGui,anPtX[nInd],anPtY[nInd],nCol);
+      #else
+        // ERROR
+      #endif
+    }
+    #if (DRV_HAS_DRAW_POINTS)
+      if (nNumPt > 8) {
+        gslc_DrvDrawPoints(pGui,asPt,nNumPt,nCol);
+        nNumPt = 0;
+      }
+    #endif
+
+    nY    += 1;
+    nErr  += 1 + 2*nY;
+    if (2*(nErr-nX) + 1 > 0)
+    {
+        nX -= 1;
+        nErr += 1 - 2*nX;
+    }
+  } // while
+  #if (DRV_HAS_DRAW_POINTS)
+    if (nNumPt > 0) {
+      gslc_DrvDrawPoints(pGui,asPt,nNumPt,nCol);
+    }
+  #endif
+
+  // Join the corners with straight edges
+  if (rInner.w > 2) {
+    gslc_DrawSpanH(pGui,nXL+1,nYT-nRadius,rInner.w-2,nCol);   // Top
+    gslc_DrawSpanH(pGui,nXL+1,nYB+nRadius,rInner.w-2,nCol);   // Bottom
+  }
+  if (rInner.h > 2) {
+    gslc_DrawSpanV(pGui,nXL-nRadius,nYT+1,rInner.h-2,nCol);   // Left
+    gslc_DrawSpanV(pGui,nXR+nRadius,nYT+1,rInner.h-2,nCol);   // Right
+  }
+}
+
+// Fill a rounded rectangle with horizontal spans
+// - The midpoint circle algorithm is used to determine the extent of
+//   each row so that the fill matches gslc_DrawRoundFrame() exactly
+// - Rows in the octants near the horizontal axis are drawn on every
+//   step. Rows in the octants near the vertical axis are visited
+//   several times, so they are only drawn at their widest.
+void gslc_DrawRoundFill(gslc_tsGui* pGui,gslc_tsRect rInner,uint16_t nRadius,gslc_tsColor nCol)
+{
+  int32_t   nXL   = rInner.x;
+  int32_t   nYT   = rInner.y;
+  int32_t   nYB   = rInner.y + rInner.h - 1;
+  int32_t   nX    = nRadius;
+  int32_t   nY    = 0;
+  int32_t   nYPrev;
+  int32_t   nErr  = 0;
+  int32_t   nClipT = pGui->rClipRect.y;
+  int32_t   nClipB = pGui->rClipRect.y + pGui->rClipRect.h - 1;
+  bool      bStepX;
+
+  // Nothing to draw if the shape is entirely above or below the
+  // clipping region
+  if ((nYT - nX > nClipB) || (nYB + nX < nClipT)) {
+    return;
+  }
+
+  // Fill the band between the corner centers
+  // - The band is clipped in 32 bits before it is stored in a
+  //   gslc_tsRect since it may be much wider than the display
+  int32_t nBandL = nXL - nRadius;
+  int32_t nBandR = nXL + rInner.w - 1 + nRadius;
+  int32_t nBandT = (nYT < nClipT)? nClipT : nYT;
+  int32_t nBandB = (nYB > nClipB)? nClipB : nYB;
+  if (nBandL < pGui->rClipRect.x) {
+    nBandL = pGui->rClipRect.x;
+  }
+  if (nBandR > pGui->rClipRect.x + pGui->rClipRect.w - 1) {
+    nBandR = pGui->rClipRect.x + pGui->rClipRect.w - 1;
+  }
+  if ((nBandL <= nBandR) && (nBandT <= nBandB)) {
+    #if (DRV_HAS_DRAW_RECT_FILL)
+      gslc_tsRect rBand = {nBandL,nBandT,nBandR-nBandL+1,nBandB-nBandT+1};
+      gslc_DrvDrawFillRect(pGui,rBand,nCol);
+    #else
+      int32_t nRow;
+      for (nRow=nBandT;nRow<=nBandB;nRow++) {
+        gslc_DrawSpanH(pGui,nBandL,nRow,nBandR-nBandL+1,nCol);
+      }
+    #endif
+  }
+
+  // Rows further from the band are visited later (nY) or are at
+  // least as far away (nX), so stop once both are past the clip
+  while ((nX >= nY) && ((nYT - nY >= nClipT) || (nYB + nY <= nClipB)))
+  {
+    if (nY > 0) {
+      gslc_DrawSpanH(pGui,nXL-nX,nYT-nY,rInner.w+2*nX,nCol);
+      gslc_DrawSpanH(pGui,nXL-nX,nYB+nY,rInner.w+2*nX,nCol);
+    }
+
+    nYPrev = nY;
+    nY    += 1;
+    nErr  += 1 + 2*nY;
+    bStepX = (2*(nErr-nX) + 1 > 0);
+    if ((bStepX) || (nX < nY)) {
+      // Last visit to row nX, so draw it at its widest
+      if (nX > nYPrev) {
+        gslc_DrawSpanH(pGui,nXL-nYPrev,nYT-nX,rInner.w+2*nYPrev,nCol);
+        gslc_DrawSpanH(pGui,nXL-nYPrev,nYB+nX,rInner.w+2*nYPrev,nCol);
+      }
+    }
+    if (bStepX)
+    {
+        nX -= 1;
+        nErr += 1 - 2*nX;
+    }
+  } // while
+}
+
+int32_t gslc_DrawRoundRowW(uint16_t nRadius,int32_t nRow)
+{
+  int32_t   nX    = nRadius;
+  int32_t   nY    = 0;
+  int32_t   nYPrev;
+  int32_t   nErr  = 0;
+  int32_t   nW    = -1;
+  bool      bStepX;
+
+  if ((nRow < 0) || (nRow > nRadius)) {
+    return -1;
+  }
+  if (nRow == 0) {
+    return nRadius;
+  }
+  // Follow gslc_DrawRoundFill() until the row can't be drawn again
+  while ((nX >= nY) && (nX >= nRow) && (nY <= nRow))
+  {
+    if ((nY == nRow) && (nX > nW)) {
+      nW = nX;
+    }
+    nYPrev = nY;
+    nY    += 1;
+    nErr  += 1 + 2*nY;
+    bStepX = (2*(nErr-nX) + 1 > 0);
+    if (((bStepX) || (nX < nY)) && (nX == nRow) && (nX > nYPrev) && (nYPrev > nW)) {
+      nW = nYPrev;
+    }
+    if (bStepX)
+    {
+        nX -= 1;
+        nErr += 1 - 2*nX;
+    }
+  } // while
+  return nW;
+}
+
+
+void gslc_ImgRleInit(gslc_tsGui* pGui,gslc_tsImgRleDec* pDec,int16_t nDstX,int16_t nDstY,bool bPal)
+{
+  gslc_tsColor nColTrans = (gslc_tsColor){GSLC_BMP_TRANS_RGB};
+  (void)pGui;
+  pDec->nDstX     = nDstX;
+  pDec->nDstY     = nDstY;
+  pDec->bPal      = bPal;
+  pDec->eState    = GSLC_IMGRLE_HDR;
+  pDec->nW        = 0;
+  pDec->nH        = 0;
+  pDec->nX        = 0;
+  pDec->nY        = 0;
+  pDec->nByteCnt  = 0;
+  pDec->nVal      = 0;
+  pDec->nCnt      = 0;
+  pDec->bRun      = false;
+  pDec->nPalCnt   = 0;
+  pDec->nColTrans = ((nColTrans.r & 0xF8) << 8) | ((nColTrans.g & 0xFC) << 3) | (nColTrans.b >> 3);
+  pDec->nBufCnt   = 0;
+}
+
+uint32_t gslc_ImgRleDecode(gslc_tsGui* pGui,gslc_tsImgRleDec* pDec,const uint8_t* pBuf,uint32_t nLen,bool bProg)
+{
+  uint32_t  nInd;
+  uint8_t   nByte;
+  uint16_t  nCol565;
+
+  (void)bProg;
+  for (nInd=0;nInd<nLen;nInd++) {
+    if ((pDec->eState == GSLC_IMGRLE_DONE) || (pDec->eState == GSLC_IMGRLE_ERR)) {
+      break;
+    }
+    #if (GSLC_USE_PROGMEM)
+    nByte = (bProg)? pgm_read_byte(&pBuf[nInd]) : pBuf[nInd];
+    #else
+    nByte = pBuf[nInd];
+    #endif
+
+    switch (pDec->eState) {
+      case GSLC_IMGRLE_HDR:
+        pDec->nVal = (pDec->nVal << 8) | nByte;
+        pDec->nByteCnt++;
+        if (pDec->nByteCnt == 2) {
+          pDec->nW    = pDec->nVal;
+          pDec->nVal  = 0;
+        } else if (pDec->nByteCnt == 4) {
+          pDec->nH        = pDec->nVal;
+          pDec->nVal      = 0;
+          pDec->nByteCnt  = 0;
+          if ((pDec->nW == 0) || (pDec->nH == 0)) {
+            pDec->eState = GSLC_IMGRLE_DONE;
+          } else {
+            pDec->eState = (pDec->bPal)? GSLC_IMGRLE_PAL_CNT : GSLC_IMGRLE_CTRL;
+          }
+        }
+        break;
+
+      case GSLC_IMGRLE_PAL_CNT:
+        pDec->nPalCnt = (nByte == 0)? 256 : nByte;
+        if (pDec->nPalCnt > GSLC_IMG_RLE_PAL_MAX) {
+          GSLC_DEBUG_PRINT("ERROR: ImgRleDecode() palette size %u exceeds GSLC_IMG_RLE_PAL_MAX\n",pDec->nPalCnt);
+          pDec->eState = GSLC_IMGRLE_ERR;
+          break;
+        }
+        pDec->nCnt    = 0;
+        pDec->eState  = GSLC_IMGRLE_PAL;
+        break;
+
+      case GSLC_IMGRLE_PAL:
+        pDec->nVal = (pDec->nVal << 8) | nByte;
+        if (++pDec->nByteCnt < 2) {
+          break;
+        }
+        pDec->anPal[pDec->nCnt++] = pDec->nVal;
+        pDec->nVal      = 0;
+        pDec->nByteCnt  = 0;
+        if (pDec->nCnt >= pDec->nPalCnt) {
+          pDec->eState = GSLC_IMGRLE_CTRL;
+        }
+        break;
+
+      case GSLC_IMGRLE_CTRL:
+        pDec->bRun    = (nByte & 0x80)? true : false;
+        pDec->nCnt    = (nByte & 0x7F) + 1;
+        pDec->eState  = GSLC_IMGRLE_PIXEL;
+        break;
+
+      case GSLC_IMGRLE_PIXEL:
+        // Fetch the pixel value
+        if (pDec->bPal) {
+          if (nByte >= pDec->nPalCnt) {
+            GSLC_DEBUG_PRINT("ERROR: ImgRleDecode() palette index %u out of range\n",nByte);
+            pDec->eState = GSLC_IMGRLE_ERR;
+            break;
+          }
+          nCol565 = pDec->anPal[nByte];
+        } else {
+          pDec->nVal = (pDec->nVal << 8) | nByte;
+          if (++pDec->nByteCnt < 2) {
+            break;
+          }
+          nCol565         = pDec->nVal;
+          pDec->nVal      = 0;
+          pDec->nByteCnt  = 0;
+        }
+
+        // A run draws all of its pixels at once
+        if (pDec->bRun) {
+          gslc_ImgRleFlush(pGui,pDec);
+          gslc_ImgRleEmit(pGui,pDec,nCol565,pDec->nCnt);
+          pDec->nCnt = 0;
+        } else {
+          // Gather literal pixels so that they can be sent as a block
+          // - A transparent pixel ends the block
+          if ((GSLC_BMP_TRANS_EN) && (nCol565 == pDec->nColTrans)) {
+            gslc_ImgRleFlush(pGui,pDec);
+          } else {
+            pDec->anBuf[pDec->nBufCnt++] = nCol565;
+          }
+          pDec->nX++;
+          if ((pDec->nX >= pDec->nW) || (pDec->nBufCnt >= GSLC_IMG_RLE_BUF_MAX)) {
+            gslc_ImgRleFlush(pGui,pDec);
+          }
+          if (pDec->nX >= pDec->nW) {
+            pDec->nX = 0;
+            pDec->nY++;
+          }
+          pDec->nCnt--;
+        }
+        if (pDec->nY >= pDec->nH) {
+          pDec->eState = GSLC_IMGRLE_DONE;
+        } else if (pDec->nCnt == 0) {
+          pDec->eState = GSLC_IMGRLE_CTRL;
+        }
+        break;
+
+      default:
+        break;
+    } // eState
+  }
+  return nInd;
+}
+
+void gslc_ImgRleEmit(gslc_tsGui* pGui,gslc_tsImgRleDec* pDec,uint16_t nCol565,uint16_t nCnt)
+{
+  uint16_t      nSpan;
+  uint16_t      nRows;
+  bool          bDraw = true;
+  gslc_tsColor  nCol  = gslc_ImgRleColor(nCol565);
+
+  if (GSLC_BMP_TRANS_EN) {
+    bDraw = (nCol565 != pDec->nColTrans);
+  }
+
+  while ((nCnt > 0) && (pDec->nY < pDec->nH)) {
+    // Runs that cover whole rows are drawn as a single fill
+    if ((pDec->nX == 0) && (nCnt >= 2*pDec->nW)) {
+      nRows = nCnt / pDec->nW;
+      if (nRows > pDec->nH - pDec->nY) {
+        nRows = pDec->nH - pDec->nY;
+      }
+      if (bDraw) {
+        gslc_tsRect rFill = {pDec->nDstX,pDec->nDstY+pDec->nY,pDec->nW,nRows};
+        #if (DRV_HAS_DRAW_RECT_FILL)
+        if (gslc_ClipRect(&pGui->rClipRect,&rFill)) {
+          gslc_DrvDrawFillRect(pGui,rFill,nCol);
+        }
+        #else
+        uint16_t nRow;
+        for (nRow=0;nRow<nRows;nRow++) {
+          gslc_DrawSpanH(pGui,rFill.x,rFill.y+nRow,rFill.w,nCol);
+        }
+        #endif
+      }
+      pDec->nY += nRows;
+      nCnt -= nRows * pDec->nW;
+      continue;
+    }
+    nSpan = pDec->nW - pDec->nX;
+    if (nSpan > nCnt) {
+      nSpan = nCnt;
+    }
+    if (bDraw) {
+      gslc_DrawSpanH(pGui,pDec->nDstX+pDec->nX,pDec->nDstY+pDec->nY,nSpan,nCol);
+    }
+    pDec->nX += nSpan;
+    nCnt -= nSpan;
+    if (pDec->nX >= pDec->nW) {
+      pDec->nX = 0;
+      pDec->nY++;
+    }
+  }
+}
+
+void gslc_ImgRleFlush(gslc_tsGui* pGui,gslc_tsImgRleDec* pDec)
+{
+  uint16_t  nCnt = pDec->nBufCnt;
+  if (nCnt == 0) {
+    return;
+  }
+  pDec->nBufCnt = 0;
+
+  // The gathered pixels end at the current column
+  int16_t   nX = pDec->nDstX + pDec->nX - nCnt;
+  int16_t   nY = pDec->nDstY + pDec->nY;
+
+#if (DRV_HAS_DRAW_ROW565)
+  gslc_tsRect rRow = {nX,nY,nCnt,1};
+  if (gslc_ClipRect(&pGui->rClipRect,&rRow)) {
+    gslc_DrvDrawRow565(pGui,rRow.x,rRow.y,&pDec->anBuf[rRow.x-nX],rRow.w);
+  }
+#else
+  // Draw each group of matching pixels as a span
+  uint16_t  nInd;
+  uint16_t  nStart = 0;
+  for (nInd=1;nInd<=nCnt;nInd++) {
+    if ((nInd == nCnt) || (pDec->anBuf[nInd] != pDec->anBuf[nStart])) {
+      gslc_DrawSpanH(pGui,nX+nStart,nY,nInd-nStart,gslc_ImgRleColor(pDec->anBuf[nStart]));
+      nStart = nInd;
+    }
+  }
+#endif
+}
+
+gslc_tsColor gslc_ImgRleColor(uint16_t nCol565)
+{
+  gslc_tsColor  nCol;
+  nCol.r = ((nCol565 >> 8) & 0xF8) | (nCol565 >> 13);
+  nCol.g = ((nCol565 >> 3) & 0xFC) | ((nCol565 >> 9) & 0x03);
+  nCol.b = ((nCol565 << 3) & 0xF8) | ((nCol565 >> 2) & 0x07);
+  return nCol;
+}
+
+bool gslc_ImgRleDraw(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,const uint8_t* pImgBuf,bool bProg,bool bPal)
+{
+  gslc_tsImgRleDec  sDec;
+  if (pImgBuf == NULL) {
+    return false;
+  }
+  gslc_ImgRleInit(pGui,&sDec,nDstX,nDstY,bPal);
+  // The image marks its own end, so the whole image is fed at once
+  gslc_ImgRleDecode(pGui,&sDec,pImgBuf,0xFFFFFFFF,bProg);
+  return (sDec.eState == GSLC_IMGRLE_DONE);
 }
 
 
 // Close down an element
-void gslc_ElemDestruct(gslc_tsElem* pElem)
+void gslc_ElemDestruct(gslc_tsGui* pGui,gslc_tsElem* pElem)
 {
   if (pElem == NULL) {
     GSLC_DEBUG_PRINT("ERROR: ElemDestruct(%s) called with NULL ptr\n","");
     return;
   }    
   if (pElem->sImgRefNorm.pvImgRaw != NULL) {
-    gslc_DrvImageDestruct(pElem->sImgRefNorm.pvImgRaw);
+    gslc_ImgCacheRelease(pGui,pElem->sImgRefNorm.pvImgRaw);
     pElem->sImgRefNorm = gslc_ResetImage();
   }
   if (pElem->sImgRefGlow.pvImgRaw != NULL) {
-    gslc_DrvImageDestruct(pElem->sImgRefGlow.pvImgRaw);
+    gslc_ImgCacheRelease(pGui,pElem->sImgRefGlow.pvImgRaw);
     pElem->sImgRefGlow = gslc_ResetImage();  
   }
   
@@ -2544,7 +4649,7 @@ void gslc_ElemDestruct(gslc_tsElem* pElem)
 
 
 // Close down a collection
-void gslc_CollectDestruct(gslc_tsCollect* pCollect)
+void gslc_CollectDestruct(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
 {
   if (pCollect == NULL) {
     GSLC_DEBUG_PRINT("ERROR: CollectDestruct(%s) called with NULL ptr\n","");
@@ -2561,20 +4666,20 @@ void gslc_CollectDestruct(gslc_tsCollect* pCollect)
     }
     // Fetch the element pointer from the reference array
     pElem = pCollect->asElemRef[nInd].pElem;   
-    gslc_ElemDestruct(pElem);
+    gslc_ElemDestruct(pGui,pElem);
   }  
     
 }
 
 // Close down all in page
-void gslc_PageDestruct(gslc_tsPage* pPage)
+void gslc_PageDestruct(gslc_tsGui* pGui,gslc_tsPage* pPage)
 {
   if (pPage == NULL) {
     GSLC_DEBUG_PRINT("ERROR: PageDestruct(%s) called with NULL ptr\n","");
     return;
   }      
   gslc_tsCollect* pCollect = &pPage->sCollect;
-  gslc_CollectDestruct(pCollect);
+  gslc_CollectDestruct(pGui,pCollect);
 }
 
 // Close down all GUI members, including pages and fonts
@@ -2589,14 +4694,24 @@ void gslc_GuiDestruct(gslc_tsGui* pGui)
   gslc_tsPage*  pPage = NULL;
   for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
     pPage = &pGui->asPage[nPageInd];
-    gslc_PageDestruct(pPage);
+    gslc_PageDestruct(pGui,pPage);
   }
   
   // TODO: Consider moving into main element array
   if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
-    gslc_DrvImageDestruct(pGui->sImgRefBkgnd.pvImgRaw);
+    gslc_ImgCacheRelease(pGui,pGui->sImgRefBkgnd.pvImgRaw);
     pGui->sImgRefBkgnd = gslc_ResetImage();
   }
+
+#if (GSLC_IMG_CACHE_MAX > 0)
+  // Release the images retained by the registry
+  uint8_t nImgInd;
+  for (nImgInd=0;nImgInd<pGui->nImgCacheCnt;nImgInd++) {
+    gslc_DrvImageDestruct(pGui->asImgCache[nImgInd].sImgRef.pvImgRaw);
+  }
+  pGui->nImgCacheCnt    = 0;
+  pGui->nImgCacheBytes  = 0;
+#endif
   
   // Close all fonts
   gslc_DrvFontsDestruct(pGui);
@@ -280,6 +280,10 @@ typedef enum {
   GSLC_IMGREF_FMT_BMP24   = (1<<4),   ///< Image format is BMP (24-bit)
   GSLC_IMGREF_FMT_BMP16   = (2<<4),   ///< Image format is BMP (16-bit RGB565)
   GSLC_IMGREF_FMT_RAW1    = (3<<4),   ///< Image format is raw monochrome (1-bit)
+  GSLC_IMGREF_FMT_RAW16   = (4<<4),   ///< Image format is raw RGB565 pixel array (16-bit)
+  GSLC_IMGREF_FMT_RLE16   = (5<<4),   ///< Image format is run-length encoded RGB565
+  GSLC_IMGREF_FMT_RLE8    = (6<<4),   ///< Image format is run-length encoded palette indices
+  GSLC_IMGREF_FMT_RAW24   = (7<<4),   ///< Image format is raw RGB888 pixel array (24-bit)
           
   // Mask values for bitfield comparisons
   GSLC_IMGREF_SRC         = (7<<0),   ///< Mask for Source flags
@@ -308,6 +312,19 @@ typedef enum {
   GSLC_TXT_DEFAULT        = GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_NONE,
 } gslc_teTxtFlags;
 
+/// Display list command types (see GSLC_DISPLIST_MAX)
+typedef enum {
+  GSLC_DISPCMD_NONE,                  ///< No command (or command dropped)
+  GSLC_DISPCMD_POINT,                 ///< Draw a point
+  GSLC_DISPCMD_LINE,                  ///< Draw a line
+  GSLC_DISPCMD_FRAME_RECT,            ///< Draw a framed rectangle
+  GSLC_DISPCMD_FILL_RECT,             ///< Draw a filled rectangle
+  GSLC_DISPCMD_TXT,                   ///< Draw a text string
+  GSLC_DISPCMD_IMAGE,                 ///< Draw an image
+  GSLC_DISPCMD_BKGND,                 ///< Draw the background
+  GSLC_DISPCMD_BKGND_RECT,            ///< Restore a region of the background
+} gslc_teDispCmd;
+
 //xxx
 typedef enum {
   GSLC_DEBUG_PRINT_NORM,
@@ -363,11 +380,14 @@ typedef struct gslc_tsPt {
 } gslc_tsPt;
 
 /// Color structure. Defines RGB triplet.
+/// - The transparency defaults to zero (opaque) so that colors
+///   initialized with only an RGB triplet are drawn as before.
+///   It is honored by gslc_DrawFillRect() (see gslc_ElemSetFillAlpha()).
 typedef struct gslc_tsColor {
   uint8_t r;      ///< RGB red value
   uint8_t g;      ///< RGB green value
   uint8_t b;      ///< RGB blue value
-  uint8_t unused; ///< Unused value to pad structure
+  uint8_t transp; ///< Transparency (0 = opaque, 255 = invisible)
 } gslc_tsColor;
 
 /// Event structure
@@ -388,11 +408,46 @@ typedef struct gslc_tsEventTouch {
   int16_t           nY;               ///< Touch Y coordinate (absolute)
 } gslc_tsEventTouch;
 
+/// Font reference types: Describes how a font was provided
+typedef enum {
+  GSLC_FONTREF_FNAME,                 ///< Font loaded by the driver from a filename
+  GSLC_FONTREF_PTR,                   ///< Bitmap font drawn by the core (tables in RAM)
+  GSLC_FONTREF_PTR_PROG,              ///< Bitmap font drawn by the core (tables in PROGMEM)
+} gslc_teFontRefType;
+
+/// Bitmap font glyph
+/// - The layout matches the glyph tables of Adafruit-GFX (GFXglyph)
+///   so that their fonts can be used without conversion
+/// - The glyph bitmap is stored row by row, MSB first, with no
+///   padding between rows
+typedef struct {
+  uint16_t  nBitmapOffset;  ///< Offset of the glyph bitmap in the font bitmap table
+  uint8_t   nWidth;         ///< Width of the glyph bitmap
+  uint8_t   nHeight;        ///< Height of the glyph bitmap
+  uint8_t   nAdvanceX;      ///< Distance to advance the cursor after the glyph
+  int8_t    nOffsetX;       ///< X offset of the glyph bitmap from the cursor
+  int8_t    nOffsetY;       ///< Y offset of the glyph bitmap from the baseline
+} gslc_tsFontBmpGlyph;
+
+/// Bitmap font
+/// - An Adafruit-GFX font can be described by its bitmap and glyph
+///   tables, eg. {FreeSans9pt7bBitmaps,(const gslc_tsFontBmpGlyph*)FreeSans9pt7bGlyphs,0x20,0x7E,22}
+typedef struct {
+  const uint8_t*              pBitmap;    ///< Concatenated glyph bitmaps
+  const gslc_tsFontBmpGlyph*  pGlyph;     ///< Glyph table, indexed from nFirst
+  uint16_t                    nFirst;     ///< First character in the glyph table
+  uint16_t                    nLast;      ///< Last character in the glyph table
+  uint8_t                     nAdvanceY;  ///< Line spacing
+} gslc_tsFontBmp;
+
 /// Font reference structure
 typedef struct {
   int16_t   nId;      ///< Font ID specified by user
-  void*     pvFont;   ///< Void ptr to the Font (type defined by driver)
-  uint16_t  nSize;    ///< Font size
+  void*     pvFont;   ///< Void ptr to the Font (type defined by driver, or gslc_tsFontBmp)
+  uint16_t  nSize;    ///< Font size (scale factor for bitmap fonts)
+  gslc_teFontRefType eFontRefType; ///< Font reference type
+  int16_t   nAscent;  ///< Height of bitmap font glyphs above the baseline (unscaled)
+  int16_t   nDescent; ///< Depth of bitmap font glyphs below the baseline (unscaled)
 } gslc_tsFont;
 
 
@@ -404,6 +459,67 @@ typedef struct {
   void*                 pvImgRaw;   ///< Ptr to raw output image data (for pre-loaded images)
 } gslc_tsImgRef;
 
+
+/// Raw image formats:
+/// - GSLC_IMGREF_FMT_RAW16: array of 16-bit words in host byte order
+///   (declare the image as a uint16_t array to keep it aligned):
+///   Width, Height, then RGB565 pixels row by row
+/// - GSLC_IMGREF_FMT_RAW24: Width[15:8], Width[7:0], Height[15:8],
+///   Height[7:0], then R, G, B bytes for each pixel row by row
+/// - Drivers whose display uses the same pixel format copy the pixels
+///   without conversion. Pixels matching GSLC_BMP_TRANS_RGB are
+///   transparent if GSLC_BMP_TRANS_EN is set.
+/// - These arrays (and GSLC_IMGREF_FMT_RAW1 / RLE16 / RLE8) can be
+///   generated from BMP files with tools/gslc-imgconv
+
+/// Run-length encoded image decoder states
+typedef enum {
+  GSLC_IMGRLE_HDR,          ///< Reading the image dimensions
+  GSLC_IMGRLE_PAL_CNT,      ///< Reading the palette size
+  GSLC_IMGRLE_PAL,          ///< Reading the palette entries
+  GSLC_IMGRLE_CTRL,         ///< Reading a packet control byte
+  GSLC_IMGRLE_PIXEL,        ///< Reading the pixels of a packet
+  GSLC_IMGRLE_DONE,         ///< All pixels have been drawn
+  GSLC_IMGRLE_ERR,          ///< The image is malformed
+} gslc_teImgRleState;
+
+/// Run-length encoded image format (GSLC_IMGREF_FMT_RLE16, GSLC_IMGREF_FMT_RLE8):
+/// - Width[15:8], Width[7:0], Height[15:8], Height[7:0]
+/// - RLE8 only: palette size (0 for 256), then each entry as
+///   RGB565[15:8], RGB565[7:0]
+/// - Packets follow until Width*Height pixels have been drawn,
+///   each a control byte and pixel values. A pixel value is either
+///   RGB565[15:8], RGB565[7:0] (RLE16) or a palette index (RLE8).
+///   - Control 0x80 | (N-1): run of N pixels of the one value that follows
+///   - Control 0x00 | (N-1): N pixels, each with its own value
+/// - Pixels are ordered left to right and then top to bottom.
+///   A packet may continue across the end of a row.
+/// - Pixels matching GSLC_BMP_TRANS_RGB are transparent if
+///   GSLC_BMP_TRANS_EN is set
+///
+/// Streaming decoder state for a run-length encoded image
+/// - The image can be fed in chunks of any size, such as the
+///   blocks read from a file
+typedef struct {
+  int16_t             nDstX;      ///< X coordinate of the image destination
+  int16_t             nDstY;      ///< Y coordinate of the image destination
+  bool                bPal;       ///< Image is palettized (RLE8)
+  gslc_teImgRleState  eState;     ///< Decoder state
+  uint16_t            nW;         ///< Image width
+  uint16_t            nH;         ///< Image height
+  uint16_t            nX;         ///< Column of the next pixel
+  uint16_t            nY;         ///< Row of the next pixel
+  uint8_t             nByteCnt;   ///< Number of bytes gathered in nVal
+  uint16_t            nVal;       ///< Multi-byte value being gathered
+  uint16_t            nCnt;       ///< Pixels remaining in packet (or palette entries read)
+  bool                bRun;       ///< Current packet is a run
+  uint16_t            nPalCnt;    ///< Number of palette entries
+  uint16_t            anPal[GSLC_IMG_RLE_PAL_MAX]; ///< Palette (RGB565)
+  uint16_t            nColTrans;  ///< Transparent color (RGB565)
+  uint16_t            nBufCnt;    ///< Number of literal pixels in anBuf (ending at nX)
+  uint16_t            anBuf[GSLC_IMG_RLE_BUF_MAX]; ///< Literal pixels of the current row (RGB565)
+} gslc_tsImgRleDec;
+
 ///
 /// Element Struct
 /// - Represents a single graphic element in the GUIslice environment
@@ -479,6 +595,21 @@ typedef struct gslc_tsElem {
   bool                bNeedRedraw;      ///< Element needs to be redrawn
   bool                bGlowing;         ///< Element is currently glowing
 
+  // Redraw tracking
+  // - Maintained at the end of the struct so that the read-only
+  //   element macros (gslc_ElemCreate*_P) can leave it zeroed
+  gslc_tsRect         rElemDrawn;       ///< Region occupied when the element was last drawn.
+                                        ///< A change versus rElem exposes the old region.
+
+  // Text metrics cache
+  // - Avoids measuring the text on every redraw. It is invalidated
+  //   by changes to the string, font, alignment, margin or size.
+  bool                bTxtMetricsOk;    ///< Cached text size and position are valid
+  uint16_t            nTxtSzW;          ///< Cached width of overlay text
+  uint16_t            nTxtSzH;          ///< Cached height of overlay text
+  int16_t             nTxtOffX;         ///< Cached X offset of overlay text within rect region
+  int16_t             nTxtOffY;         ///< Cached Y offset of overlay text within rect region
+
 } gslc_tsElem;
 
 /// Element reference structure
@@ -532,6 +663,47 @@ typedef struct {
 } gslc_tsPage;
 
 
+/// Display list command
+/// - Records a drawing primitive so that it can be optimized
+///   with the rest of the frame before being sent to the driver
+typedef struct {
+  gslc_teDispCmd      eCmd;         ///< Command type
+  gslc_tsRect         rRect;        ///< Region drawn by the command (w=0 if unknown)
+  gslc_tsColor        nCol;         ///< Drawing color
+  int16_t             nX0;          ///< Start X coordinate (LINE, TXT, IMAGE)
+  int16_t             nY0;          ///< Start Y coordinate (LINE, TXT, IMAGE)
+  int16_t             nX1;          ///< End X coordinate (LINE)
+  int16_t             nY1;          ///< End Y coordinate (LINE)
+  gslc_tsImgRef       sImgRef;      ///< Image reference (IMAGE)
+  gslc_tsFont*        pTxtFont;     ///< Text font (TXT)
+  const char*         pStr;         ///< Text string (TXT)
+  gslc_teTxtFlags     eTxtFlags;    ///< Text string flags (TXT)
+} gslc_tsDispCmd;
+
+
+/// Retained cache of a custom-drawn element
+/// - Holds the pixels last rendered by the element's draw function
+///   (see gslc_ElemSetCacheEn)
+typedef struct {
+  gslc_tsElem*        pElem;        ///< Element that owns the cache
+  gslc_tsRect         rRect;        ///< Region held in the cache
+  uint32_t            nOffset;      ///< Start of the pixels within the cache pool
+  uint32_t            nSize;        ///< Bytes reserved for the pixels
+  bool                bValid;       ///< Pixels match the current content of the element
+} gslc_tsElemCache;
+
+/// Registered image
+/// - Shared by all elements that reference the same image source
+///   (see GSLC_IMG_CACHE_MAX)
+typedef struct {
+  gslc_tsImgRef       sImgRef;      ///< Image source and the image loaded by the driver
+  char                acFname[GSLC_IMG_CACHE_PATH_MAX]; ///< Copy of the path for file sources (pFname isn't kept)
+  uint32_t            nBytes;       ///< Size of the loaded image
+  uint16_t            nRefCnt;      ///< Number of references held to the image
+  uint32_t            nLastUse;     ///< Use counter value at last acquire (for eviction)
+} gslc_tsImgCache;
+
+
 /// GUI structure
 /// - Contains all GUI state and content
 /// - Maintains list of one or more pages
@@ -561,7 +733,51 @@ typedef struct {
   
   // Primary surface definitions
   gslc_tsImgRef       sImgRefBkgnd;     ///< Image reference for background
+
+  gslc_tsRect         rClipRect;        ///< Active clipping region (within the display)
+
+  // Invalidated regions pending redraw (see gslc_InvalidateRgnAdd)
+#if (GSLC_INVALID_RGN_MAX > 0)
+  gslc_tsRect         asInvalidRgn[GSLC_INVALID_RGN_MAX]; ///< Regions requiring redraw
+#endif
+  uint8_t             nInvalidRgnCnt;   ///< Number of regions requiring redraw
+
+  uint16_t            nDrawCulledCnt;   ///< Number of elements culled during last full page redraw
+
+  // Display list of drawing commands (see gslc_DispListAdd)
+#if (GSLC_DISPLIST_MAX > 0)
+  gslc_tsDispCmd      asDispList[GSLC_DISPLIST_MAX]; ///< Drawing commands pending submission
+#endif
+  uint16_t            nDispListCnt;     ///< Number of drawing commands pending submission
+  bool                bDispListRec;     ///< Drawing commands are being recorded
+
+  // Retained caches of custom-drawn elements (see gslc_ElemSetCacheEn)
+#if (GSLC_ELEM_CACHE_MAX > 0)
+  gslc_tsElemCache    asElemCache[GSLC_ELEM_CACHE_MAX];     ///< Cached elements
+  uint8_t             anElemCachePool[GSLC_ELEM_CACHE_BYTES]; ///< Storage for the cached pixels
+#endif
+  uint8_t             nElemCacheCnt;    ///< Number of cached elements
+  uint32_t            nElemCacheUsed;   ///< Bytes of the cache pool in use
+
+  // Registry of loaded images (see GSLC_IMG_CACHE_MAX)
+#if (GSLC_IMG_CACHE_MAX > 0)
+  gslc_tsImgCache     asImgCache[GSLC_IMG_CACHE_MAX]; ///< Registered images
+#endif
+  uint8_t             nImgCacheCnt;     ///< Number of registered images
+  uint32_t            nImgCacheBytes;   ///< Total size of registered images
+  uint32_t            nImgCacheUseCnt;  ///< Counter of image acquires (for eviction)
+  uint32_t            nImgCacheLoad;    ///< Number of images loaded by the driver
+  uint32_t            nImgCacheHit;     ///< Number of images shared from the registry
   
+  // Update scheduling (see gslc_SetUpdateRate)
+  uint16_t            nSchedTouchMs;    ///< Minimum interval between touch polls (ms)
+  uint16_t            nSchedTickMs;     ///< Minimum interval between tick events (ms)
+  uint16_t            nSchedRedrawMs;   ///< Minimum interval between page redraws (ms)
+  uint32_t            nSchedTouchLast;  ///< Time of last touch poll (ms)
+  uint32_t            nSchedTickLast;   ///< Time of last tick event (ms)
+  uint32_t            nSchedRedrawLast; ///< Time of last page redraw (ms)
+  uint16_t            nSchedSleepMs;    ///< Time until next scheduled update (ms)
+
   uint8_t             nFrameRateCnt;    ///< Diagnostic frame rate count
   uint8_t             nFrameRateStart;  ///< Diagnostic frame rate timestamp
   
@@ -655,6 +871,8 @@ void gslc_Quit(gslc_tsGui* pGui);
 /// Perform main GUIslice handling functions
 /// - Handles any touch events
 /// - Performs any necessary screen redraw
+/// - Each of these is only performed when it is next due according
+///   to the update rates (see gslc_SetUpdateRate)
 ///
 /// \param[in]  pGui:    Pointer to GUI
 ///
@@ -663,6 +881,36 @@ void gslc_Quit(gslc_tsGui* pGui);
 void gslc_Update(gslc_tsGui* pGui);
 
 
+///
+/// Configure the scheduling of gslc_Update()
+/// - Polling touch less often and limiting the redraw rate allows
+///   the main loop to sleep between updates (see gslc_GetUpdateSleep)
+/// - A pending redraw is performed as soon as the frame rate allows,
+///   so the display still responds promptly to touch input
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  nTouchMs:  Minimum interval between touch polls (ms), or 0 for every call
+/// \param[in]  nTickMs:   Minimum interval between tick events (ms), or 0 for every call
+/// \param[in]  nFpsMax:   Maximum page redraw rate (frames/sec), or 0 for unlimited
+///
+/// \return None
+///
+void gslc_SetUpdateRate(gslc_tsGui* pGui,uint16_t nTouchMs,uint16_t nTickMs,uint16_t nFpsMax);
+
+
+///
+/// Get the time that the caller can sleep until the next scheduled
+/// update, as determined by the last call to gslc_Update()
+/// - Typical usage in the main loop:
+///   gslc_Update(&m_gui); SDL_Delay(gslc_GetUpdateSleep(&m_gui));
+///
+/// \param[in]  pGui:    Pointer to GUI
+///
+/// \return Time until the next update is due (ms), 0 if it is due now
+///
+uint16_t gslc_GetUpdateSleep(gslc_tsGui* pGui);
+
+
 ///
 /// Create an event structure
 ///
@@ -766,6 +1014,49 @@ bool gslc_ClipLine(gslc_tsRect* pClipRect,int16_t* pnX0,int16_t* pnY0,int16_t* p
 ///
 bool gslc_ClipRect(gslc_tsRect* pClipRect,gslc_tsRect* pRect);
 
+///
+/// Determine if two rectangular regions overlap
+/// - Empty rectangles (zero width or height) never overlap
+///
+/// \param[in]  rRect1:      First rectangular region
+/// \param[in]  rRect2:      Second rectangular region
+///
+/// \return true if the regions share at least one pixel, false otherwise
+///
+bool gslc_IsRectOverlap(gslc_tsRect rRect1,gslc_tsRect rRect2);
+
+///
+/// Determine if a rectangular region is completely contained
+/// within another rectangular region
+///
+/// \param[in]  rInner:      Rectangular region to test
+/// \param[in]  rOuter:      Rectangular region to compare against
+///
+/// \return true if rInner lies entirely within rOuter, false otherwise
+///
+bool gslc_IsRectInRect(gslc_tsRect rInner,gslc_tsRect rOuter);
+
+///
+/// Calculate the smallest rectangle that bounds two rectangles
+/// - An empty rectangle (zero width or height) is ignored
+///
+/// \param[in]  rRect1:      First rectangular region
+/// \param[in]  rRect2:      Second rectangular region
+///
+/// \return Bounding rectangle of both regions
+///
+gslc_tsRect gslc_UnionRect(gslc_tsRect rRect1,gslc_tsRect rRect2);
+
+///
+/// Determine if two colors are the same
+///
+/// \param[in]  nCol1:       First color
+/// \param[in]  nCol2:       Second color
+///
+/// \return true if the colors match, false otherwise
+///
+bool gslc_ColorEqual(gslc_tsColor nCol1,gslc_tsColor nCol2);
+
 ///
 /// Create a blank image reference structure
 ///
@@ -842,6 +1133,9 @@ void gslc_DrawSetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 
 ///
 /// Draw an arbitrary line using Bresenham's algorithm
+/// - If the driver doesn't provide line drawing, the line is
+///   clipped to the active clipping region before it is
+///   rasterized and is then drawn as a series of spans
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  nX0:         X coordinate of line startpoint
@@ -899,6 +1193,9 @@ void gslc_DrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 
 ///
 /// Draw a filled rectangle
+/// - If the color has a non-zero transparency, the fill is blended
+///   with the existing display content. Drivers that can't blend
+///   draw the fill opaque instead.
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  rRect:       Rectangular region to fill
@@ -922,6 +1219,118 @@ void gslc_DrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
   uint16_t nRadius,gslc_tsColor nCol);
 
+///
+/// Draw a filled circle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMidX:       Center X coordinate
+/// \param[in]  nMidY:       Center Y coordinate
+/// \param[in]  nRadius:     Radius of circle
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return none
+///
+void gslc_DrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
+  uint16_t nRadius,gslc_tsColor nCol);
+
+///
+/// Draw a framed rectangle with rounded corners
+/// - The radius is reduced if it doesn't fit within the rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to frame
+/// \param[in]  nRadius:     Radius of the corners
+/// \param[in]  nCol:        Color RGB value for the frame
+///
+/// \return none
+///
+void gslc_DrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint16_t nRadius,gslc_tsColor nCol);
+
+///
+/// Draw a filled rectangle with rounded corners
+/// - The radius is reduced if it doesn't fit within the rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nRadius:     Radius of the corners
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return none
+///
+void gslc_DrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint16_t nRadius,gslc_tsColor nCol);
+
+///
+/// Draw a filled triangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         X coordinate of first vertex
+/// \param[in]  nY0:         Y coordinate of first vertex
+/// \param[in]  nX1:         X coordinate of second vertex
+/// \param[in]  nY1:         Y coordinate of second vertex
+/// \param[in]  nX2:         X coordinate of third vertex
+/// \param[in]  nY2:         Y coordinate of third vertex
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return none
+///
+void gslc_DrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+  int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol);
+
+///
+/// Draw a filled arc (a sector of a ring)
+/// - Angles are in degrees, measured clockwise from the top (12 o'clock)
+/// - The arc is drawn clockwise from the start angle to the end angle
+/// - An inner radius of 0 draws a pie slice. Setting both radii to
+///   the same value draws a one pixel wide arc.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMidX:       Center X coordinate
+/// \param[in]  nMidY:       Center Y coordinate
+/// \param[in]  nRadius1:    Inner radius
+/// \param[in]  nRadius2:    Outer radius
+/// \param[in]  nAngStart:   Start angle (degrees)
+/// \param[in]  nAngEnd:     End angle (degrees)
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return none
+///
+void gslc_DrawArc(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius1,uint16_t nRadius2,
+  int16_t nAngStart,int16_t nAngEnd,gslc_tsColor nCol);
+
+///
+/// Draw an anti-aliased line
+/// - The line is blended with the existing pixels, so drivers that
+///   can't read pixels back (DRV_HAS_DRAW_LINE_AA=0) draw it with
+///   gslc_DrawLine() instead
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         X coordinate of line startpoint
+/// \param[in]  nY0:         Y coordinate of line startpoint
+/// \param[in]  nX1:         X coordinate of line endpoint
+/// \param[in]  nY1:         Y coordinate of line endpoint
+/// \param[in]  nCol:        Color RGB value for the line
+///
+/// \return none
+///
+void gslc_DrawLineAA(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
+
+///
+/// Draw an anti-aliased framed circle
+/// - The circle is blended with the existing pixels, so drivers that
+///   can't read pixels back (DRV_HAS_DRAW_CIRCLE_AA=0) draw it with
+///   gslc_DrawFrameCircle() instead
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMidX:       Center X coordinate
+/// \param[in]  nMidY:       Center Y coordinate
+/// \param[in]  nRadius:     Radius of circle
+/// \param[in]  nCol:        Color RGB value for the frame
+///
+/// \return none
+///
+void gslc_DrawFrameCircleAA(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
+  uint16_t nRadius,gslc_tsColor nCol);
+
 
 
 // -----------------------------------------------------------------------
@@ -931,15 +1340,25 @@ void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
 ///
 /// Load a font into the local font cache and assign
 /// font ID (nFontId).
+/// - Fonts referenced by filename are loaded by the driver
+/// - Bitmap fonts are drawn by the core library with horizontal
+///   spans, so they are available with every driver and render
+///   identically on each
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  nFontId:     ID to use when referencing this font
-/// \param[in]  acFontName:  Filename path to the font
-/// \param[in]  nFontSz:     Typeface size to use
+/// \param[in]  eFontRefType: Font reference type:
+///                           - GSLC_FONTREF_FNAME: pvFontRef is the font filename
+///                           - GSLC_FONTREF_PTR: pvFontRef points to a gslc_tsFontBmp in RAM
+///                           - GSLC_FONTREF_PTR_PROG: pvFontRef points to a gslc_tsFontBmp
+///                             whose tables are all in PROGMEM
+/// \param[in]  pvFontRef:   Reference to the font
+/// \param[in]  nFontSz:     Typeface size to use (scale factor for bitmap fonts)
 ///
 /// \return true if load was successful, false otherwise
 ///
-bool gslc_FontAdd(gslc_tsGui* pGui,int16_t nFontId, const char* acFontName, uint16_t nFontSz);
+bool gslc_FontAdd(gslc_tsGui* pGui,int16_t nFontId,gslc_teFontRefType eFontRefType,
+  const void* pvFontRef,uint16_t nFontSz);
 
 
 ///
@@ -1023,6 +1442,55 @@ void gslc_PageRedrawSet(gslc_tsGui* pGui,bool bRedraw);
 bool gslc_PageRedrawGet(gslc_tsGui* pGui);
 
 
+///
+/// Determine if any drawing is pending for the current page
+/// - Includes a full page redraw, invalidated regions, elements
+///   requiring redraw and a pending page flip
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return True if a call to gslc_PageRedrawGo() would draw anything
+///
+bool gslc_PageRedrawPending(gslc_tsGui* pGui);
+
+
+///
+/// Get the number of elements that were skipped during the
+/// last full page redraw because they were completely
+/// covered by opaque elements (see GSLC_DRAW_CULL_EN)
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return Number of culled elements
+///
+uint16_t gslc_PageRedrawCulledGet(gslc_tsGui* pGui);
+
+
+///
+/// Get the RAM in use by the retained caches of custom-drawn
+/// elements (see gslc_ElemSetCacheEn)
+/// - The total can't exceed GSLC_ELEM_CACHE_BYTES
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return Number of bytes
+///
+uint32_t gslc_GetCacheUsed(gslc_tsGui* pGui);
+
+
+///
+/// Get the statistics of the image registry (see GSLC_IMG_CACHE_MAX)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnLoad:      Ptr to number of images loaded by the driver
+/// \param[out] pnHit:       Ptr to number of images shared from the registry
+/// \param[out] pnBytes:     Ptr to total size of registered images
+///
+/// \return none
+///
+void gslc_GetImgCacheStats(gslc_tsGui* pGui,uint32_t* pnLoad,uint32_t* pnHit,uint32_t* pnBytes);
+
+
 ///
 /// Redraw all elements on the active page. Only the
 /// elements that have been marked as needing redraw are
@@ -1117,9 +1585,11 @@ gslc_tsElem* gslc_PageFindElemById(gslc_tsGui* pGui,int16_t nPageId,int16_t nEle
 
 /// Perform a redraw calculation on the page to determine if additional
 /// elements should also be redrawn. This routine checks to see if any
-/// transparent elements have been marked as needing redraw. If so, the
-/// whole page may be marked as needing redraw (or at least the other
-/// elements that have been exposed underneath).
+/// transparent elements (or elements that have moved) have been marked
+/// as needing redraw. If so, the region that has been exposed underneath
+/// is invalidated (see gslc_InvalidateRgnAdd). The whole page is only
+/// marked as needing redraw if the driver doesn't support partial redraw
+/// or the invalidated regions cover most of the display.
 ///
 /// \param[in]  pGui:         Pointer to GUI
 ///
@@ -1128,6 +1598,36 @@ gslc_tsElem* gslc_PageFindElemById(gslc_tsGui* pGui,int16_t nPageId,int16_t nEle
 void gslc_PageRedrawCalc(gslc_tsGui* pGui);
 
 
+///
+/// Mark a region of the current page as requiring redraw
+/// - During the next page redraw, the background and any
+///   elements that intersect the region are redrawn (clipped
+///   to the region) without forcing a redraw of the full page.
+/// - Overlapping regions are merged together. If the list of
+///   regions is full, the new region is merged with whichever
+///   existing region grows the least.
+/// - This is called automatically for transparent elements and
+///   for elements that have moved since they were last drawn,
+///   but it can also be used after custom drawing on the page.
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  rRect:        Rectangular region to invalidate
+///
+/// \return none
+///
+void gslc_InvalidateRgnAdd(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+
+///
+/// Discard all regions that have been marked as requiring redraw
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+void gslc_InvalidateRgnReset(gslc_tsGui* pGui);
+
+
 // ------------------------------------------------------------------------
 // Element Creation Functions
 // ------------------------------------------------------------------------
@@ -1281,6 +1781,21 @@ void gslc_ElemSetCol(gslc_tsElem* pElem,gslc_tsColor colFrame,gslc_tsColor colFi
 ///
 void gslc_ElemSetGlowCol(gslc_tsElem* pElem,gslc_tsColor colFrameGlow,gslc_tsColor colFillGlow,gslc_tsColor colTxtGlow);
 
+///
+/// Set the opacity of an Element's fill
+/// - The opacity is stored as the transparency of the fill colors
+///   (normal and glowing), so it should be set after the colors
+/// - Whenever an element with a semi-transparent fill is redrawn,
+///   the background and any lower elements beneath it are redrawn
+///   first (clipped to the element's region)
+///
+/// \param[in]  pElem:       Pointer to Element
+/// \param[in]  nAlpha:      Opacity of the fill (0 = invisible, 255 = opaque)
+///
+/// \return none
+///
+void gslc_ElemSetFillAlpha(gslc_tsElem* pElem,uint8_t nAlpha);
+
 
 ///
 /// Set the group ID for an element
@@ -1333,6 +1848,8 @@ void gslc_ElemSetTxtMargin(gslc_tsElem* pElem,unsigned nMargin);
 
 ///
 /// Update the text string associated with an Element ID
+/// - Strings should only be changed through this call so that
+///   the cached text size and position are refreshed
 ///
 /// \param[in]  pElem:       Pointer to Element
 /// \param[in]  pStr:        String to copy into element
@@ -1466,6 +1983,39 @@ void gslc_ElemSetEventFunc(gslc_tsElem* pElem,GSLC_CB_EVENT funcCb);
 ///
 void gslc_ElemSetDrawFunc(gslc_tsElem* pElem,GSLC_CB_DRAW funcCb);
 
+///
+/// Enable or disable the retained cache for a custom-drawn element
+/// - While enabled, the pixels rendered by the drawing callback are
+///   kept in RAM. Redraws of the element that aren't requested via
+///   gslc_ElemSetRedraw() (eg. page switch, restoring the region
+///   beneath a transparent element) copy the pixels back to the
+///   display instead of calling the drawing callback.
+/// - Any change to the element's content must be followed by
+///   gslc_ElemSetRedraw(), which invalidates the cache
+/// - The cache holds the element's entire region, so the drawing
+///   callback should draw every pixel of it
+/// - The RAM for all caches comes from a budget of
+///   GSLC_ELEM_CACHE_BYTES (see gslc_GetCacheUsed)
+/// - Requires driver support for copying display regions
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element
+/// \param[in]  bCacheEn:    True to enable the cache, false to release it
+///
+/// \return true if success, false if the cache couldn't be allocated
+///
+bool gslc_ElemSetCacheEn(gslc_tsGui* pGui,gslc_tsElem* pElem,bool bCacheEn);
+
+///
+/// Get the RAM reserved for an element's retained cache
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element
+///
+/// \return Number of bytes (0 if the element isn't cached)
+///
+uint32_t gslc_ElemGetCacheSize(gslc_tsGui* pGui,gslc_tsElem* pElem);
+
 ///
 /// Assign the tick callback function for an element
 /// - This allows the user to provide background updates to
@@ -1651,6 +2201,133 @@ void gslc_CollectSetElemTracked(gslc_tsCollect* pCollect,gslc_tsElem* pElem);
 void gslc_CollectSetParent(gslc_tsCollect* pCollect,gslc_tsElem* pElemParent);
 
 
+/// Redraw the elements within a collection that intersect a region
+/// - Elements are drawn in display order and are expected to be
+///   clipped to the region by the caller (gslc_SetClipRect)
+/// - Elements that extend beyond the region retain their
+///   need-redraw status since only part of them was drawn
+///
+/// \param[in]  pGui:         Pointer to the GUI
+/// \param[in]  pCollect:     Pointer to the collection
+/// \param[in]  rRgn:         Region being redrawn
+///
+/// \return none
+///
+void gslc_CollectRedrawRgn(gslc_tsGui* pGui,gslc_tsCollect* pCollect,gslc_tsRect rRgn);
+
+
+/// Determine if an element in a collection is completely covered
+/// by an opaque element later in the display order
+/// - An element is treated as opaque if it has an opaque fill and
+///   uses the default drawing (the fill lies beneath any image or text)
+/// - Note that this may overwrite the temporary element (sElemTmp)
+///
+/// \param[in]  pGui:         Pointer to the GUI
+/// \param[in]  pCollect:     Pointer to the collection
+/// \param[in]  nElemInd:     Index of the element reference to check
+///
+/// \return true if the element is hidden, false otherwise
+///
+bool gslc_CollectElemOccluded(gslc_tsGui* pGui,gslc_tsCollect* pCollect,uint16_t nElemInd);
+
+
+///
+/// Determine if a scheduled update is due and if so, restart its interval
+///
+/// \param[in]  nNow:         Current time (ms)
+/// \param[in]  pnLast:       Pointer to time of the last update (ms)
+/// \param[in]  nInterval:    Minimum interval between updates (ms), 0 for always
+///
+/// \return true if the update is due, false otherwise
+///
+bool gslc_SchedDue(uint32_t nNow,uint32_t* pnLast,uint16_t nInterval);
+
+
+///
+/// Determine the time remaining until a scheduled update is due
+///
+/// \param[in]  nNow:         Current time (ms)
+/// \param[in]  nLast:        Time of the last update (ms)
+/// \param[in]  nInterval:    Minimum interval between updates (ms)
+///
+/// \return Time remaining (ms), 0 if it is due now
+///
+uint16_t gslc_SchedRemain(uint32_t nNow,uint32_t nLast,uint16_t nInterval);
+
+
+///
+/// Start recording drawing primitives into the display list
+/// - Recording is only enabled if GSLC_DISPLIST_MAX > 0
+///
+/// \param[in]  pGui:         Pointer to the GUI
+///
+/// \return none
+///
+void gslc_DispListStart(gslc_tsGui* pGui);
+
+
+///
+/// Submit any recorded drawing primitives and stop recording
+///
+/// \param[in]  pGui:         Pointer to the GUI
+///
+/// \return none
+///
+void gslc_DispListStop(gslc_tsGui* pGui);
+
+
+///
+/// Record a drawing command into the display list
+/// - If the display list is full, the pending commands
+///   are submitted first
+///
+/// \param[in]  pGui:         Pointer to the GUI
+/// \param[in]  sCmd:         Drawing command
+///
+/// \return true if the command was recorded, false if it should
+///         be drawn immediately (display list not recording)
+///
+bool gslc_DispListAdd(gslc_tsGui* pGui,gslc_tsDispCmd sCmd);
+
+
+///
+/// Optimize and submit the recorded drawing commands to the driver
+/// - Recording continues afterwards. This is called whenever the
+///   drawing order must be preserved for an operation that can't
+///   be recorded (eg. clipping rect changes)
+///
+/// \param[in]  pGui:         Pointer to the GUI
+///
+/// \return none
+///
+void gslc_DispListFlush(gslc_tsGui* pGui);
+
+
+///
+/// Optimize the recorded drawing commands
+/// - Drops commands that are completely overdrawn by a later fill
+/// - Moves commands earlier to follow a command of the same type
+///   and color if they don't overlap anything they pass
+/// - Merges adjacent fills of the same color
+///
+/// \param[in]  pGui:         Pointer to the GUI
+///
+/// \return none
+///
+void gslc_DispListOptimize(gslc_tsGui* pGui);
+
+
+///
+/// Send a single drawing command to the driver
+///
+/// \param[in]  pGui:         Pointer to the GUI
+/// \param[in]  pCmd:         Pointer to drawing command
+///
+/// \return none
+///
+void gslc_DispCmdExec(gslc_tsGui* pGui,gslc_tsDispCmd* pCmd);
+
+
 // ------------------------------------------------------------------------
 // Collect Event Handlers
 // ------------------------------------------------------------------------
@@ -1847,6 +2524,79 @@ bool gslc_SetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol);
 ///
 bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElem* pElem);
 
+/// Determine if an element's fill completely hides what lies beneath it
+/// - The fill must be enabled and neither of the fill colors may
+///   have any transparency
+///
+/// \param[in]  pElem:       Ptr to Element
+///
+/// \return true if the fill is opaque, false otherwise
+///
+bool gslc_ElemFillOpaque(gslc_tsElem* pElem);
+
+/// Find the retained cache of an element
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Ptr to Element
+///
+/// \return Index of the cache or -1 if the element isn't cached
+///
+int16_t gslc_ElemCacheFind(gslc_tsGui* pGui,gslc_tsElem* pElem);
+
+/// Release a retained cache and compact the pool
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nInd:        Index of the cache
+///
+/// \return none
+///
+void gslc_ElemCacheRelease(gslc_tsGui* pGui,int16_t nInd);
+
+/// Draw a custom-drawn element, using its retained cache if
+/// it is valid and refreshing the cache otherwise
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Ptr to Element
+///
+/// \return none
+///
+void gslc_ElemCacheDraw(gslc_tsGui* pGui,gslc_tsElem* pElem);
+
+/// Acquire the loaded image for an image reference
+/// - Drivers call this instead of gslc_DrvLoadImage() so that
+///   images from the same source are loaded once and shared
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return Void ptr to the loaded image or NULL if none
+///
+void* gslc_ImgCacheAcquire(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+/// Release an image acquired with gslc_ImgCacheAcquire()
+/// - The image is destroyed once it is no longer referenced and
+///   doesn't fit within the registry budget
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvImg:       Void ptr to the loaded image
+///
+/// \return none
+///
+void gslc_ImgCacheRelease(gslc_tsGui* pGui,void* pvImg);
+
+/// Evict unreferenced images, least recently used first, until a
+/// new image of the given size fits in the registry
+/// - The registry never exceeds GSLC_IMG_CACHE_BYTES. If the images
+///   still referenced leave no room, the new image doesn't fit and
+///   is used unshared.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nBytes:      Size of the image to make room for (0 to only
+///                          enforce the budget)
+///
+/// \return true if the image fits, false otherwise
+///
+bool gslc_ImgCacheTrim(gslc_tsGui* pGui,uint32_t nBytes);
 
 
 ///
@@ -1865,29 +2615,32 @@ void gslc_GuiDestruct(gslc_tsGui* pGui);
 ///
 /// Free up any members associated with a page
 /// 
+/// \param[in]  pGui:         Pointer to GUI
 /// \param[in]  pPage:        Pointer to Page
 /// 
 /// \return none
 ///
-void gslc_PageDestruct(gslc_tsPage* pPage);
+void gslc_PageDestruct(gslc_tsGui* pGui,gslc_tsPage* pPage);
 
 ///
 /// Free up any members associated with an element collection
 /// 
+/// \param[in]  pGui:         Pointer to GUI
 /// \param[in]  pCollect:     Pointer to collection
 /// 
 /// \return none
 ///
-void gslc_CollectDestruct(gslc_tsCollect* pCollect);
+void gslc_CollectDestruct(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
 
 ///
 /// Free up any members associated with an element
 /// 
+/// \param[in]  pGui:         Pointer to GUI
 /// \param[in]  pElem:        Pointer to element
 /// 
 /// \return none
 ///
-void gslc_ElemDestruct(gslc_tsElem* pElem);
+void gslc_ElemDestruct(gslc_tsGui* pGui,gslc_tsElem* pElem);
 
 
 ///
@@ -1915,6 +2668,99 @@ bool gslc_ElemSendEventTouch(gslc_tsGui* pGui,gslc_tsElem* pElemTracked,
 ///
 void gslc_ResetFont(gslc_tsFont* pFont);
 
+///
+/// Measure a text string in a font
+/// - Bitmap fonts are measured by the core and other fonts
+///   by the driver
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFont:       Ptr to Font structure
+/// \param[in]  pStr:        String to measure
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[out] pnTxtSzW:    Ptr to width of text
+/// \param[out] pnTxtSzH:    Ptr to height of text
+///
+/// \return true if success, false if failure
+///
+bool gslc_FontGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,
+  gslc_teTxtFlags eTxtFlags,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH);
+
+///
+/// Draw a text string in a font
+/// - Bitmap fonts are drawn by the core and other fonts
+///   by the driver
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTxtX:       X coordinate of top-left text string
+/// \param[in]  nTxtY:       Y coordinate of top-left text string
+/// \param[in]  pFont:       Ptr to Font
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[in]  colTxt:      Color to draw text
+///
+/// \return true if success, false if failure
+///
+bool gslc_FontDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,
+  const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt);
+
+///
+/// Fetch the descriptor of a bitmap font
+/// - Copies from PROGMEM if required
+///
+/// \param[in]  pFont:       Ptr to Font (of bitmap type)
+/// \param[out] pFontBmp:    Ptr to descriptor to fill
+///
+/// \return none
+///
+void gslc_FontBmpGetDesc(gslc_tsFont* pFont,gslc_tsFontBmp* pFontBmp);
+
+///
+/// Fetch a glyph of a bitmap font
+/// - Copies from PROGMEM if required
+///
+/// \param[in]  pFont:       Ptr to Font (of bitmap type)
+/// \param[in]  pFontBmp:    Ptr to descriptor of the font
+/// \param[in]  nChar:       Character to fetch
+/// \param[out] pGlyph:      Ptr to glyph to fill
+///
+/// \return true if the font holds the character, false otherwise
+///
+bool gslc_FontBmpGetGlyph(gslc_tsFont* pFont,const gslc_tsFontBmp* pFontBmp,uint16_t nChar,gslc_tsFontBmpGlyph* pGlyph);
+
+///
+/// Measure a text string in a bitmap font
+/// - The width is the sum of the glyph advances and the height
+///   spans the tallest ascent and deepest descent of the font
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFont:       Ptr to Font (of bitmap type)
+/// \param[in]  pStr:        String to measure
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[out] pnTxtSzW:    Ptr to width of text
+/// \param[out] pnTxtSzH:    Ptr to height of text
+///
+/// \return true if success, false if failure
+///
+bool gslc_FontBmpGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,
+  gslc_teTxtFlags eTxtFlags,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH);
+
+///
+/// Draw a text string in a bitmap font
+/// - Each run of set pixels in a glyph row is drawn as one span
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTxtX:       X coordinate of top-left text string
+/// \param[in]  nTxtY:       Y coordinate of top-left text string
+/// \param[in]  pFont:       Ptr to Font (of bitmap type)
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[in]  colTxt:      Color to draw text
+///
+/// \return true if success, false if failure
+///
+bool gslc_FontBmpDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,
+  const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt);
+
 ///
 /// Initialize an Element struct
 ///
@@ -1924,6 +2770,210 @@ void gslc_ResetFont(gslc_tsFont* pFont);
 ///
 void gslc_ResetElem(gslc_tsElem* pElem);
 
+///
+/// Perform integer division rounded towards negative infinity
+///
+/// \param[in]  nNum:        Numerator
+/// \param[in]  nDen:        Denominator (must be positive)
+///
+/// \return Quotient
+///
+int32_t gslc_DivFloor(int32_t nNum,int32_t nDen);
+
+///
+/// Draw the portion of a line within the clipping region as spans
+/// - The pixels drawn are identical to those of the unclipped line
+/// - Steps of the line outside of the clipping region are skipped
+///   rather than rasterized
+/// - Horizontal and vertical lines are not supported
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         X coordinate of line startpoint
+/// \param[in]  nY0:         Y coordinate of line startpoint
+/// \param[in]  nX1:         X coordinate of line endpoint
+/// \param[in]  nY1:         Y coordinate of line endpoint
+/// \param[in]  nCol:        Color RGB value for the line
+///
+/// \return none
+///
+void gslc_DrawLineClipSpans(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
+
+///
+/// Calculate the sine of an angle in fixed point
+///
+/// \param[in]  nAng:        Angle (degrees)
+///
+/// \return Sine of the angle scaled by 1024
+///
+int16_t gslc_SinDeg(int32_t nAng);
+
+///
+/// Calculate the integer square root
+///
+/// \param[in]  nVal:        Value
+///
+/// \return Largest integer whose square doesn't exceed nVal
+///
+uint16_t gslc_SqrtInt(uint32_t nVal);
+
+///
+/// Draw a horizontal span immediately
+/// - The span is clipped to the active clipping region
+/// - Unlike gslc_DrawLineH(), the span is never recorded in the
+///   display list, so the caller must flush it first
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of span start
+/// \param[in]  nY:          Y coordinate of span start
+/// \param[in]  nW:          Width of span
+/// \param[in]  nCol:        Color RGB value for the span
+///
+/// \return none
+///
+void gslc_DrawSpanH(gslc_tsGui* pGui,int32_t nX,int32_t nY,int32_t nW,gslc_tsColor nCol);
+
+///
+/// Draw a vertical span immediately
+/// - The span is clipped to the active clipping region
+/// - Unlike gslc_DrawLineV(), the span is never recorded in the
+///   display list, so the caller must flush it first
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of span start
+/// \param[in]  nY:          Y coordinate of span start
+/// \param[in]  nH:          Height of span
+/// \param[in]  nCol:        Color RGB value for the span
+///
+/// \return none
+///
+void gslc_DrawSpanV(gslc_tsGui* pGui,int32_t nX,int32_t nY,int32_t nH,gslc_tsColor nCol);
+
+///
+/// Draw the outline of a rectangle with rounded corners
+/// - The corners are quarter circles centered on the corners of
+///   rInner. A circle is drawn when rInner is a single pixel.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rInner:      Rectangle joining the centers of the corners
+/// \param[in]  nRadius:     Radius of the corners
+/// \param[in]  nCol:        Color RGB value for the outline
+///
+/// \return none
+///
+void gslc_DrawRoundFrame(gslc_tsGui* pGui,gslc_tsRect rInner,uint16_t nRadius,gslc_tsColor nCol);
+
+///
+/// Fill a rectangle with rounded corners using horizontal spans
+/// - The corners are quarter circles centered on the corners of
+///   rInner. A circle is filled when rInner is a single pixel.
+/// - The filled region covers exactly the outline drawn by
+///   gslc_DrawRoundFrame() and its interior
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rInner:      Rectangle joining the centers of the corners
+/// \param[in]  nRadius:     Radius of the corners
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return none
+///
+void gslc_DrawRoundFill(gslc_tsGui* pGui,gslc_tsRect rInner,uint16_t nRadius,gslc_tsColor nCol);
+
+///
+/// Determine the extent of one row of a filled circle
+/// - Matches the row drawn by gslc_DrawRoundFill() for a single
+///   pixel rInner, so shapes built from it line up with circles
+/// - Takes a number of steps proportional to the radius
+///
+/// \param[in]  nRadius:     Radius of the circle
+/// \param[in]  nRow:        Distance of the row from the center
+///
+/// \return Number of pixels either side of the center that are filled,
+///         or -1 if the row is beyond the circle
+///
+int32_t gslc_DrawRoundRowW(uint16_t nRadius,int32_t nRow);
+
+///
+/// Start decoding a run-length encoded image
+/// (GSLC_IMGREF_FMT_RLE16 or GSLC_IMGREF_FMT_RLE8)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pDec:        Pointer to decoder state
+/// \param[in]  nDstX:       X coordinate of the image destination
+/// \param[in]  nDstY:       Y coordinate of the image destination
+/// \param[in]  bPal:        Image is palettized (RLE8)
+///
+/// \return none
+///
+void gslc_ImgRleInit(gslc_tsGui* pGui,gslc_tsImgRleDec* pDec,int16_t nDstX,int16_t nDstY,bool bPal);
+
+///
+/// Decode the next chunk of a run-length encoded image
+/// - Runs are drawn immediately as spans (or as a single fill for
+///   runs that cover whole rows), so the caller must flush the
+///   display list first
+/// - Literal pixels are gathered into blocks of up to
+///   GSLC_IMG_RLE_BUF_MAX pixels within a row (see gslc_ImgRleFlush)
+/// - Bytes following the end of the image are ignored
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pDec:        Pointer to decoder state
+/// \param[in]  pBuf:        Pointer to the chunk of encoded image
+/// \param[in]  nLen:        Length of the chunk
+/// \param[in]  bProg:       Chunk is located in program memory (PROGMEM)
+///
+/// \return Number of bytes consumed (less than nLen once the image is
+///         complete or malformed)
+///
+uint32_t gslc_ImgRleDecode(gslc_tsGui* pGui,gslc_tsImgRleDec* pDec,const uint8_t* pBuf,uint32_t nLen,bool bProg);
+
+///
+/// Draw pixels of a run-length encoded image
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pDec:        Pointer to decoder state
+/// \param[in]  nCol565:     Color of the pixels (RGB565)
+/// \param[in]  nCnt:        Number of pixels
+///
+/// \return none
+///
+void gslc_ImgRleEmit(gslc_tsGui* pGui,gslc_tsImgRleDec* pDec,uint16_t nCol565,uint16_t nCnt);
+
+///
+/// Draw the literal pixels gathered by a run-length decoder
+/// - Drivers that support it (DRV_HAS_DRAW_ROW565) receive the
+///   block with a single gslc_DrvDrawRow565() call. Otherwise each
+///   group of matching pixels is drawn as a span.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pDec:        Pointer to decoder state
+///
+/// \return none
+///
+void gslc_ImgRleFlush(gslc_tsGui* pGui,gslc_tsImgRleDec* pDec);
+
+///
+/// Convert an RGB565 color to the full 8-bit range
+///
+/// \param[in]  nCol565:     Color (RGB565)
+///
+/// \return Color
+///
+gslc_tsColor gslc_ImgRleColor(uint16_t nCol565);
+
+///
+/// Draw a run-length encoded image held in memory
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       X coordinate of the image destination
+/// \param[in]  nDstY:       Y coordinate of the image destination
+/// \param[in]  pImgBuf:     Pointer to the encoded image
+/// \param[in]  bProg:       Image is located in program memory (PROGMEM)
+/// \param[in]  bPal:        Image is palettized (RLE8)
+///
+/// \return true if success, false if the image is malformed
+///
+bool gslc_ImgRleDraw(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,const uint8_t* pImgBuf,bool bProg,bool bPal);
+
 
 
 // ------------------------------------------------------------------------
@@ -49,6 +49,7 @@ extern "C" {
 #define DRV_DISP_SDL1                // LINUX: SDL 1.2 library
 //#define DRV_DISP_SDL2              // LINUX: SDL 2.0 library
 //#define DRV_DISP_ADAGFX            // Arduino: Adafruit-GFX library
+//#define DRV_DISP_MEM               // Headless: In-memory framebuffer
 
   
 // Specify the touchscreen driver
@@ -58,6 +59,7 @@ extern "C" {
 #define DRV_TOUCH_TSLIB           // LINUX: Use tslib touch driver
 //#define DRV_TOUCH_ADA_STMPE610  // Arduino: Use Adafruit STMPE610 touch driver
 //#define DRV_TOUCH_ADA_FT6206    // Arduino: Use Adafruit FT6206 touch driver     [Untested]
+//#define DRV_TOUCH_MEM           // Headless: Touch events injected by gslc_DrvMemSetTouch()
 
 
 
@@ -71,6 +73,21 @@ extern "C" {
   // Enable SDL startup workaround?
   #define DRV_SDL_FIX_START
 
+  // Limit each page flip to the screen regions drawn since the last one
+  // - DRV_SDL_UPDATE_RECT_MAX defines the number of regions tracked
+  // - If the regions cover more than DRV_SDL_UPDATE_FULL_PCT percent
+  //   of the screen, the entire screen is flipped instead
+  #define DRV_SDL_UPDATE_RECT_MAX   16
+  #define DRV_SDL_UPDATE_FULL_PCT   60
+
+  // Cache the glyphs of each font and text color in an atlas so that
+  // strings are composed from glyph blits rather than being rendered
+  // by SDL_ttf on every draw
+  // - DRV_SDL_GLYPH_ATLAS_MAX defines the number of font and color
+  //   combinations cached (the least recently used one is evicted)
+  // - Set to 0 to render all text directly with SDL_ttf
+  #define DRV_SDL_GLYPH_ATLAS_MAX   8
+
   #define GSLC_LOCAL_STR  1
     
   // Error reporting
@@ -86,6 +103,22 @@ extern "C" {
   #define GSLC_DEV_FB    "/dev/fb0"
   #define GSLC_DEV_TOUCH "/dev/input/touchscreen"  
 
+  // Render into a persistent target texture that is copied to the
+  // display on every page flip. This retains the drawing between
+  // frames so that only the changed elements need to be redrawn.
+  // - Set to 0 to redraw the full page after every page flip
+  // - If the renderer doesn't support target textures, the driver
+  //   falls back to full page redraws
+  #define DRV_SDL_RENDER_TARGET   1
+
+  // Cache the glyphs of each font and text color in an atlas so that
+  // strings are composed from glyph blits rather than being rendered
+  // by SDL_ttf on every draw
+  // - DRV_SDL_GLYPH_ATLAS_MAX defines the number of font and color
+  //   combinations cached (the least recently used one is evicted)
+  // - Set to 0 to render all text directly with SDL_ttf
+  #define DRV_SDL_GLYPH_ATLAS_MAX   8
+
   #define GSLC_LOCAL_STR  1
 
   // Error reporting
@@ -128,14 +161,45 @@ extern "C" {
   //   with limited resources.
   #define ADAGFX_SD_EN    0
   
-  // Define buffer size for loading images from SD
+  // Define buffer size (in pixels) for loading images from SD
   // - A larger buffer will be faster but at the cost of RAM
+  // - A buffer that holds one or more whole BMP rows reads each
+  //   block of rows at once, otherwise each row is read in segments
   #define ADAGFX_SD_BUFFPIXEL   20
 
   // Enable support for clipping (DrvSetClipRect)
   // - Note that this will impact performance of drawing graphics primitives
   #define ADAGFX_CLIP 1
 
+  // Define the number of points sorted together by gslc_DrvDrawPoints()
+  // - Points within a batch are merged into horizontal and vertical runs
+  //   that are each sent to the display with a single address window
+  // - A larger batch finds more runs at the cost of additional stack
+  #define ADAGFX_PTS_BATCH      16
+
+
+#elif defined(DRV_DISP_MEM)
+
+  #define GSLC_DEV_FB    ""   // No device path used
+  #define GSLC_DEV_TOUCH ""   // No device path used
+
+  #define GSLC_LOCAL_STR  1
+
+  // Error reporting
+  #define DEBUG_ERR   1       // Enable error message reporting (requires more memory)
+
+  // Define the framebuffer dimensions (in pixels)
+  #define DRV_MEM_WIDTH   320
+  #define DRV_MEM_HEIGHT  240
+
+  // Define the framebuffer pixel format
+  // - 32: XRGB8888
+  // - 24: RGB888
+  // - 16: RGB565
+  // -  8: RGB332
+  // -  1: Monochrome
+  #define DRV_MEM_BPP     16
+
 #endif // DRV_DISP_*
 
 
@@ -145,6 +209,9 @@ extern "C" {
 #if defined(DRV_TOUCH_SDL)
   #define DRV_TOUCH_IN_DISP   // Use the display driver (SDL) for touch events
   
+#elif defined(DRV_TOUCH_MEM)
+  #define DRV_TOUCH_IN_DISP   // Use the display driver (in-memory) for touch events
+
 #elif defined(DRV_TOUCH_ADA_STMPE610)
 
   // Select wiring method by uncommenting one of the following
@@ -183,6 +250,87 @@ extern "C" {
 #define GSLC_LOCAL_STR_LEN  30  // Max string length of text elements
 
 
+// Define the maximum number of invalidated regions tracked between
+// page redraws. When a transparent element changes (or an element
+// moves), only the exposed region is redrawn instead of the full page.
+// - A larger list avoids merging distant regions at the cost of RAM
+// - Set to 0 to always redraw the full page in these cases
+#define GSLC_INVALID_RGN_MAX  8
+
+
+// Enable occlusion culling during full page redraws
+// - Elements that are completely covered by a later opaque element
+//   (filled and without a custom draw function) are skipped
+// - Set to 0 if custom-drawn elements draw outside of their rect
+#define GSLC_DRAW_CULL_EN     1
+
+
+// Define the size of the display list used during page redraws
+// - When enabled, drawing primitives issued during a page redraw are
+//   recorded and optimized (overdrawn fills dropped, adjacent fills of
+//   the same color merged, commands grouped by color) before being
+//   submitted to the driver
+// - Each entry consumes RAM, so keep this small on constrained devices
+// - Set to 0 to send drawing primitives directly to the driver
+#define GSLC_DISPLIST_MAX     0
+
+
+// Define the retained caches for custom-drawn elements
+// - An element enabled with gslc_ElemSetCacheEn() keeps a copy of the
+//   pixels rendered by its draw function. Redraws that aren't caused
+//   by a change to the element (eg. page switch, restoring a region
+//   beneath a transparent element) copy the pixels back instead of
+//   calling the draw function again.
+// - GSLC_ELEM_CACHE_MAX is the number of elements that can be cached
+//   and GSLC_ELEM_CACHE_BYTES is the RAM budget shared by their pixels
+// - Set GSLC_ELEM_CACHE_MAX to 0 to disable
+#define GSLC_ELEM_CACHE_MAX   0
+#define GSLC_ELEM_CACHE_BYTES 0
+
+
+// Define the registry of loaded images
+// - Elements and backgrounds that reference the same image source
+//   (file path, RAM or PROGMEM pointer) and format share one copy
+//   of the image loaded by the driver
+// - Images that are no longer referenced are retained for reuse while
+//   the total size of the registry is within GSLC_IMG_CACHE_BYTES, and
+//   are otherwise released least recently used first
+// - The registry never grows beyond GSLC_IMG_CACHE_BYTES. An image
+//   that doesn't fit is loaded separately for its element and isn't
+//   shared.
+// - GSLC_IMG_CACHE_MAX is the number of images that can be registered
+// - GSLC_IMG_CACHE_PATH_MAX is the longest file path (including the
+//   terminator) that the registry keeps a copy of. Images loaded from
+//   longer paths are used unshared.
+// - Set GSLC_IMG_CACHE_MAX to 0 to disable
+#define GSLC_IMG_CACHE_MAX    0
+#define GSLC_IMG_CACHE_BYTES  0
+#define GSLC_IMG_CACHE_PATH_MAX 64
+
+
+// Define the default scheduling of gslc_Update()
+// - Each interval is the minimum time (in milliseconds) between
+//   touch polls and tick events. Set to 0 to perform them on
+//   every call to gslc_Update().
+// - GSLC_SCHED_FPS_MAX limits the rate of page redraws.
+//   Set to 0 to redraw on every call.
+// - The time remaining until the next scheduled update is
+//   reported by gslc_GetUpdateSleep()
+// - These can be changed at runtime with gslc_SetUpdateRate()
+#define GSLC_SCHED_TOUCH_MS   0
+#define GSLC_SCHED_TICK_MS    0
+#define GSLC_SCHED_FPS_MAX    0
+
+
+// Enable vectorized kernels for software rendering
+// - Used by drivers that draw into a framebuffer in memory
+//   (SDL1, in-memory) for solid fills and image copies
+// - The instruction set (SSE2/AVX2 on x86, NEON on ARM) is
+//   detected at runtime, with a scalar fallback
+// - Set to 0 to build only the portable scalar code
+#define GSLC_SIMD_EN          1
+
+
 // Debug modes
 //#define DBG_LOG           // Enable debugging log output
 //#define DBG_TOUCH         // Enable debugging of touch-presses
@@ -193,6 +341,17 @@ extern "C" {
 #define GSLC_BMP_TRANS_EN     1               // 1 = enabled, 0 = disabled
 #define GSLC_BMP_TRANS_RGB    0xFF,0x00,0xFF  // RGB color (default:pink)
 
+// Define the largest palette of a palettized run-length encoded image
+// (GSLC_IMGREF_FMT_RLE8)
+// - The palette is held by the streaming decoder (2 bytes per entry)
+#define GSLC_IMG_RLE_PAL_MAX  16
+
+// Define the number of literal pixels that the run-length decoder
+// gathers before sending them to the display as one block
+// - The buffer is held by the streaming decoder (2 bytes per pixel)
+// - Blocks never continue across the end of a row
+#define GSLC_IMG_RLE_BUF_MAX  32
+
 
 // -----------------------------------------------------------------------------------------
 
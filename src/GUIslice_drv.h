@@ -46,6 +46,8 @@ extern "C" {
   #include "GUIslice_drv_sdl.h"
 #elif defined(DRV_DISP_ADAGFX)
   #include "GUIslice_drv_adagfx.h"  
+#elif defined(DRV_DISP_MEM)
+  #include "GUIslice_drv_mem.h"
 #else
   #error "Driver needs to be specified in GUIslice_config.h (DRV_DISP_*)"
 #endif
@@ -120,6 +120,7 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
     gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
 
     pDriver->nColRawBkgnd = gslc_DrvAdaptColorToRaw(GSLC_COL_BLACK);
+    pDriver->nWinCnt      = 0;
 
     // These displays can accept partial redraw as they retain the last
     // image in the controller graphics RAM
@@ -160,6 +161,11 @@ void gslc_DrvDestruct(gslc_tsGui* pGui)
 {
 }
 
+uint32_t gslc_DrvGetTicks(void)
+{
+  return millis();
+}
+
 // -----------------------------------------------------------------------
 // Image/surface handling Functions
 // -----------------------------------------------------------------------
@@ -230,15 +236,22 @@ bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 }
 
 
+uint32_t gslc_DrvGetImageBytes(gslc_tsGui* pGui,void* pvImg)
+{
+  // Images aren't preloaded by this driver
+  return 0;
+}
+
+
 void gslc_DrvImageDestruct(void* pvImg)
 {
 }
 
 bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
-  // NOTE: The clipping rect is currently saved in the
-  // driver struct, but the drawing code does not currently
-  // use it.
+  // NOTE: The clipping rect is saved in the driver struct
+  // and is only applied by the drawing code if ADAGFX_CLIP
+  // has been enabled.
   gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   if (pRect == NULL) {
     // Default to entire display
@@ -248,7 +261,13 @@ bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
   }
 
   // TODO: For ILI9341, perhaps we can leverage m_disp.setAddrWindow(x0, y0, x1, y1)?
+#if (ADAGFX_CLIP)
+  return true;
+#else
+  // Report that clipping won't be honored so that the core
+  // doesn't depend upon it (eg. for region redraw)
   return false;
+#endif
 }
 
 
@@ -294,6 +313,9 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
 {
   uint16_t nTxtScale = pFont->nSize;  
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(colTxt);
+  // The built-in font is drawn one window per lit glyph pixel, which
+  // depends on font data private to Adafruit-GFX, so text isn't
+  // included in the window count
   m_disp.setTextColor(nColRaw);
   m_disp.setCursor(nTxtX,nTxtY);
   m_disp.setTextSize(nTxtScale);
@@ -339,13 +361,14 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
 
 bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 {
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);  
 #if (ADAGFX_CLIP)
   // Perform clipping
-  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);  
   if (!gslc_ClipPt(&pDriver->rClipRect,nX,nY)) { return true; }
 #endif
   
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  pDriver->nWinCnt++;
   m_disp.drawPixel(nX,nY,nColRaw);
   return true;
 }
@@ -353,31 +376,68 @@ bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 
 bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
 {
-  return false;
+  gslc_tsPt asBatch[ADAGFX_PTS_BATCH];
+  uint16_t  nBatch;
+
+  while (nNumPt > 0) {
+    nBatch = (nNumPt < ADAGFX_PTS_BATCH)? nNumPt : ADAGFX_PTS_BATCH;
+    memcpy(asBatch,asPt,nBatch*sizeof(gslc_tsPt));
+    asPt   += nBatch;
+    nNumPt -= nBatch;
+
+    // Send the horizontal runs first and then group the
+    // remaining isolated points into vertical runs
+    nBatch = gslc_DrvDrawPtRuns(pGui,asBatch,nBatch,false,nCol);
+    gslc_DrvDrawPtRuns(pGui,asBatch,nBatch,true,nCol);
+  }
+  return true;
 }
 
 bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 {
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);  
 #if (ADAGFX_CLIP)
   // Perform clipping
-  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);  
   if (!gslc_ClipRect(&pDriver->rClipRect,&rRect)) { return true; }  
 #endif
   
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);  
+  pDriver->nWinCnt++;
   m_disp.fillRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
   return true;
 }
 
-bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+bool gslc_DrvDrawRow565(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t* pnCol,uint16_t nCnt)
 {
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
 #if (ADAGFX_CLIP)
   // Perform clipping
+  gslc_tsRect rRow = {nX,nY,nCnt,1};
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rRow)) { return true; }
+  pnCol += rRow.x - nX;
+  nX     = rRow.x;
+  nCnt   = rRow.w;
+#endif
+
+  // The whole row is sent through a single address window
+  // - A non-const pointer selects the RAM version of drawRGBBitmap()
+  pDriver->nWinCnt++;
+  m_disp.drawRGBBitmap(nX,nY,pnCol,nCnt,1);
+  return true;
+}
+
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);  
+#if (ADAGFX_CLIP)
+  // Perform clipping
   if (!gslc_ClipRect(&pDriver->rClipRect,&rRect)) { return true; }    
 #endif  
   
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);  
+  // Adafruit-GFX sends the frame as two horizontal and two
+  // vertical spans
+  pDriver->nWinCnt += 4;
   m_disp.drawRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
   return true;
 }
@@ -385,38 +445,140 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
 {
-#if (ADAGFX_CLIP)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);  
+#if (ADAGFX_CLIP)
   if (!gslc_ClipLine(&pDriver->rClipRect,&nX0,&nY0,&nX1,&nY1)) { return true; }      
 #endif
   
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  // Adafruit-GFX sends axis-aligned lines as a span and
+  // diagonal lines one pixel at a time
+  int16_t nDX = (nX1 > nX0)? nX1-nX0 : nX0-nX1;
+  int16_t nDY = (nY1 > nY0)? nY1-nY0 : nY0-nY1;
+  if ((nDX == 0) || (nDY == 0)) {
+    pDriver->nWinCnt++;
+  } else {
+    pDriver->nWinCnt += ((nDX > nDY)? nDX : nDY) + 1;
+  }
   m_disp.drawLine(nX0,nY0,nX1,nY1,nColRaw);
   return true;
 }
 
-bool gslc_DrvDrawFrameCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+bool gslc_DrvDrawLineH(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nW,gslc_tsColor nCol)
 {
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rRect = {nX,nY,nW,1};
 #if (ADAGFX_CLIP)
-  // TODO
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rRect)) { return true; }
+#endif
+
+  // A span is sent with a single address window
+  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  pDriver->nWinCnt++;
+  m_disp.drawFastHLine(rRect.x,rRect.y,rRect.w,nColRaw);
+  return true;
+}
+
+bool gslc_DrvDrawLineV(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nH,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rRect = {nX,nY,1,nH};
+#if (ADAGFX_CLIP)
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rRect)) { return true; }
+#endif
+
+  // A span is sent with a single address window
+  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  pDriver->nWinCnt++;
+  m_disp.drawFastVLine(rRect.x,rRect.y,rRect.h,nColRaw);
+  return true;
+}
+
+bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+#if (ADAGFX_CLIP)
+  // The library can't clip the circle, so leave partially
+  // visible circles to the core emulation
+  gslc_tsRect rBound = {nMidX-nRadius,nMidY-nRadius,2*nRadius+1,2*nRadius+1};
+  if (!gslc_IsRectInRect(rBound,pDriver->rClipRect)) { return false; }
 #endif
   
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);  
+  // Adafruit-GFX sends four pixels and then eight per midpoint step
+  pDriver->nWinCnt += 4 + 8*(uint32_t)gslc_DrvAdaCircleSteps(nRadius);
   m_disp.drawCircle(nMidX,nMidY,nRadius,nColRaw);
   return true;
 }
 
-bool gslc_DrvDrawFillCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+bool gslc_DrvDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
 {
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
 #if (ADAGFX_CLIP)
-  // TODO
+  gslc_tsRect rBound = {nMidX-nRadius,nMidY-nRadius,2*nRadius+1,2*nRadius+1};
+  if (!gslc_IsRectInRect(rBound,pDriver->rClipRect)) { return false; }
 #endif
   
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  // Adafruit-GFX sends the middle column and then four vertical
+  // spans per midpoint step
+  pDriver->nWinCnt += 1 + 4*(uint32_t)gslc_DrvAdaCircleSteps(nRadius);
   m_disp.fillCircle(nMidX,nMidY,nRadius,nColRaw);
   return true;
 }
 
+bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint16_t nRadius,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+#if (ADAGFX_CLIP)
+  if (!gslc_IsRectInRect(rRect,pDriver->rClipRect)) { return false; }
+#endif
+
+  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  // Adafruit-GFX sends the four straight edges and then two pixels
+  // per corner for each midpoint step
+  pDriver->nWinCnt += 4 + 8*(uint32_t)gslc_DrvAdaCircleSteps(nRadius);
+  m_disp.drawRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
+  return true;
+}
+
+bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint16_t nRadius,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+#if (ADAGFX_CLIP)
+  if (!gslc_IsRectInRect(rRect,pDriver->rClipRect)) { return false; }
+#endif
+
+  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  // Adafruit-GFX sends the middle as one rect and then two vertical
+  // spans per side for each midpoint step
+  pDriver->nWinCnt += 1 + 4*(uint32_t)gslc_DrvAdaCircleSteps(nRadius);
+  m_disp.fillRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
+  return true;
+}
+
+bool gslc_DrvDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+  int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+#if (ADAGFX_CLIP)
+  int16_t nXMin = (nX0 < nX1)? nX0 : nX1;  if (nX2 < nXMin) { nXMin = nX2; }
+  int16_t nXMax = (nX0 > nX1)? nX0 : nX1;  if (nX2 > nXMax) { nXMax = nX2; }
+  int16_t nYMin = (nY0 < nY1)? nY0 : nY1;  if (nY2 < nYMin) { nYMin = nY2; }
+  int16_t nYMax = (nY0 > nY1)? nY0 : nY1;  if (nY2 > nYMax) { nYMax = nY2; }
+  gslc_tsRect rBound = {nXMin,nYMin,nXMax-nXMin+1,nYMax-nYMin+1};
+  if (!gslc_IsRectInRect(rBound,pDriver->rClipRect)) { return false; }
+#endif
+
+  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  // Adafruit-GFX sends one horizontal span per row
+  int16_t nYTop = (nY0 < nY1)? nY0 : nY1;  if (nY2 < nYTop) { nYTop = nY2; }
+  int16_t nYBot = (nY0 > nY1)? nY0 : nY1;  if (nY2 > nYBot) { nYBot = nY2; }
+  pDriver->nWinCnt += (uint32_t)(nYBot - nYTop) + 1;
+  m_disp.fillTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
+  return true;
+}
+
 
 
 
@@ -458,9 +620,13 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t x, int16_t y,
   bmap_base++;
   
   int16_t i, j, byteWidth = (w + 7) / 8;
+  int16_t nRunX;
   uint8_t nByte;
 
+  // Consecutive set bits in a row are sent as a single span
+  // rather than one address window per pixel
   for(j=0; j<h; j++) {
+    nRunX = -1;
     for(i=0; i<w; i++) {
       if(i & 7) nByte <<= 1;
       else {
@@ -471,14 +637,83 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t x, int16_t y,
         }
       }
       if(nByte & 0x80) {
-        gslc_DrvDrawPoint(pGui,x+i,y+j,nCol);
+        if (nRunX < 0) nRunX = i;
+      } else if (nRunX >= 0) {
+        gslc_DrvDrawLineH(pGui,x+nRunX,y+j,i-nRunX,nCol);
+        nRunX = -1;
       }
     }
+    if (nRunX >= 0) {
+      gslc_DrvDrawLineH(pGui,x+nRunX,y+j,w-nRunX,nCol);
+    }
   }   
 }
 // ----- REFERENCE CODE end
 
 
+// Draw an RGB565 image (GSLC_IMGREF_FMT_RAW16) from the provided
+// pixel array (see GUIslice.h for the format)
+// - The pixels are already in the display format, so they are pushed
+//   straight from the array with drawRGBBitmap()
+// - Transparent pixels (GSLC_BMP_TRANS_RGB) and pixels outside the
+//   clipping region split each row into separate runs
+void gslc_DrvDrawRaw16FromMem(gslc_tsGui* pGui,int16_t x,int16_t y,
+ const unsigned char *bitmap,bool bProgMem)
+{
+  gslc_tsDriver*  pDriver   = (gslc_tsDriver*)(pGui->pvDriver);
+  const uint16_t* pWords    = (const uint16_t*)bitmap;
+  gslc_tsColor    nColTrans = (gslc_tsColor){GSLC_BMP_TRANS_RGB};
+  uint16_t        nTransRaw = gslc_DrvAdaptColorToRaw(nColTrans);
+  int16_t         w,h,i,j;
+  int16_t         nRunX;
+  const uint16_t* pRow;
+  uint16_t        nColRaw;
+
+  w = (bProgMem)? pgm_read_word(&pWords[0]) : pWords[0];
+  h = (bProgMem)? pgm_read_word(&pWords[1]) : pWords[1];
+  pWords += 2;
+
+  gslc_tsRect rVis = {x,y,(uint16_t)w,(uint16_t)h};
+#if (ADAGFX_CLIP)
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rVis)) { return; }
+#endif
+
+  // Push the whole image as one window when nothing is
+  // transparent or clipped
+  if ((!GSLC_BMP_TRANS_EN) && (rVis.w == w) && (rVis.h == h)) {
+    pDriver->nWinCnt++;
+    if (bProgMem) {
+      m_disp.drawRGBBitmap(x,y,pWords,w,h);
+    } else {
+      m_disp.drawRGBBitmap(x,y,(uint16_t*)pWords,w,h);
+    }
+    return;
+  }
+
+  for (j=rVis.y-y; j<rVis.y-y+rVis.h; j++) {
+    pRow  = pWords + (int32_t)j*w;
+    nRunX = rVis.x-x;
+    for (i=rVis.x-x; i<=rVis.x-x+rVis.w; i++) {
+      // Close the run at a transparent pixel or at the clipped row end
+      if (i < rVis.x-x+rVis.w) {
+        if (!GSLC_BMP_TRANS_EN) continue;
+        nColRaw = (bProgMem)? pgm_read_word(&pRow[i]) : pRow[i];
+        if (nColRaw != nTransRaw) continue;
+      }
+      if (i > nRunX) {
+        pDriver->nWinCnt++;
+        if (bProgMem) {
+          m_disp.drawRGBBitmap(x+nRunX,y+j,pRow+nRunX,i-nRunX,1);
+        } else {
+          m_disp.drawRGBBitmap(x+nRunX,y+j,(uint16_t*)(pRow+nRunX),i-nRunX,1);
+        }
+      }
+      nRunX = i+1;
+    }
+  }
+}
+
+
 #if (ADAGFX_SD_EN)
 // ----- REFERENCE CODE begin
 // The following code was based upon the following reference code but modified to
@@ -505,6 +740,40 @@ uint32_t gslc_DrvRead32SD(File f) {
   ((uint8_t *)&result)[3] = f.read(); // MSB
   return result;
 }
+// Convert a row of BMP pixels (B,G,R) to RGB565 and push each
+// opaque run to the display as a single address window
+// - Transparent pixels (GSLC_BMP_TRANS_RGB) are left as gaps
+// - The converted pixels are written over the buffer from pOut,
+//   which must be 16-bit aligned and must not follow pBgr
+void gslc_DrvPushBmp24Row(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint8_t* pOut,const uint8_t* pBgr,uint16_t nPix)
+{
+  gslc_tsDriver*  pDriver   = (gslc_tsDriver*)(pGui->pvDriver);
+  uint16_t*       pnCol     = (uint16_t*)pOut;
+  gslc_tsColor    nColTrans = (gslc_tsColor){GSLC_BMP_TRANS_RGB};
+  uint16_t        nInd;
+  uint16_t        nRunStart = 0;
+  uint8_t         r, g, b;
+
+  for (nInd=0; nInd<nPix; nInd++) {
+    b = *pBgr++;
+    g = *pBgr++;
+    r = *pBgr++;
+    if ((GSLC_BMP_TRANS_EN) && (r == nColTrans.r) && (g == nColTrans.g) && (b == nColTrans.b)) {
+      if (nInd > nRunStart) {
+        pDriver->nWinCnt++;
+        m_disp.drawRGBBitmap(nX+nRunStart,nY,&pnCol[nRunStart],nInd-nRunStart,1);
+      }
+      nRunStart = nInd+1;
+      continue;
+    }
+    pnCol[nInd] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+  }
+  if (nPix > nRunStart) {
+    pDriver->nWinCnt++;
+    m_disp.drawRGBBitmap(nX+nRunStart,nY,&pnCol[nRunStart],nPix-nRunStart,1);
+  }
+}
+
 void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x, uint16_t y)
 {
   File     bmpFile;
@@ -512,20 +781,17 @@ void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x,
   uint8_t  bmpDepth;              // Bit depth (currently must be 24)
   uint32_t bmpImageoffset;        // Start of image data in file
   uint32_t rowSize;               // Not always = bmpWidth; may have padding
-  uint8_t  sdbuffer[3*ADAGFX_SD_BUFFPIXEL]; // pixel buffer (R+G+B per pixel)
-  uint8_t  buffidx = sizeof(sdbuffer); // Current position in sdbuffer
+  uint16_t sdbuffer[(3*ADAGFX_SD_BUFFPIXEL+1)/2]; // pixel buffer (B+G+R per pixel, converted in place to RGB565)
   boolean  goodBmp = false;       // Set to true on valid header parse
   boolean  flip    = true;        // BMP is stored bottom-to-top
-  int      w, h, row, col;
-  uint8_t  r, g, b;
-  uint32_t pos = 0, startTime = millis();
+  gslc_tsRect rVis;               // Visible region of the image
+  int      nCol0, nRow0;          // First visible column and row of the image
+  int      nRowsPerBuf;           // Number of whole rows that fit in sdbuffer
+  int      row, nRows, nBlk, nSeg, nSegLen;
+  uint8_t* pRow;
+  uint32_t pos = 0;
 
   if((x >= pGui->nDispW) || (y >= pGui->nDispH)) return;
- 
-  //Serial.println();
-  //Serial.print("Loading image '");
-  //Serial.print(filename);
-  //Serial.println('\'');
 
   // Open requested file on SD card
   if ((bmpFile = SD.open(filename)) == 0) {
@@ -534,25 +800,17 @@ void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x,
   }
   // Parse BMP header
   if(gslc_DrvRead16SD(bmpFile) == 0x4D42) { // BMP signature
-    uint32_t nFileSize = gslc_DrvRead32SD(bmpFile);
-    //Serial.print("File size: "); Serial.println(nFileSize);
+    (void)gslc_DrvRead32SD(bmpFile); // Read & ignore file size
     (void)gslc_DrvRead32SD(bmpFile); // Read & ignore creator bytes
     bmpImageoffset = gslc_DrvRead32SD(bmpFile); // Start of image data
-    //Serial.print("Image Offset: "); Serial.println(bmpImageoffset, DEC);
     // Read DIB header
-    uint32_t nHdrSize = gslc_DrvRead32SD(bmpFile);
-    //Serial.print("Header size: "); Serial.println(nHdrSize);
+    (void)gslc_DrvRead32SD(bmpFile); // Read & ignore header size
     bmpWidth  = gslc_DrvRead32SD(bmpFile);
     bmpHeight = gslc_DrvRead32SD(bmpFile);
     if(gslc_DrvRead16SD(bmpFile) == 1) { // # planes -- must be '1'
       bmpDepth = gslc_DrvRead16SD(bmpFile); // bits per pixel
-      //Serial.print("Bit Depth: "); Serial.println(bmpDepth);
       if((bmpDepth == 24) && (gslc_DrvRead32SD(bmpFile) == 0)) { // 0 = uncompressed
         goodBmp = true; // Supported BMP format -- proceed!
-        //Serial.print("Image size: ");
-        //Serial.print(bmpWidth);
-        //Serial.print('x');
-        //Serial.println(bmpHeight);
 
         // BMP rows are padded (if needed) to 4-byte boundary
         rowSize = (bmpWidth * 3 + 3) & ~3;
@@ -564,61 +822,62 @@ void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x,
           flip      = false;
         }
 
-        // Crop area to be loaded
-        w = bmpWidth;
-        h = bmpHeight;
-        if((x+w-1) >= pGui->nDispW) w = pGui->nDispW  - x;
-        if((y+h-1) >= pGui->nDispH) h = pGui->nDispH - y;
-
-        // Set TFT address window to clipped image bounds
-        //xxx tft.setAddrWindow(x, y, x+w-1, y+h-1);
-
-        for (row=0; row<h; row++) { // For each scanline...
-
-          // Seek to start of scan line.  It might seem labor-
-          // intensive to be doing this on every line, but this
-          // method covers a lot of gritty details like cropping
-          // and scanline padding.  Also, the seek only takes
-          // place if the file position actually needs to change
-          // (avoids a lot of cluster math in SD library).
-          if(flip) // Bitmap is stored bottom-to-top order (normal BMP)
-            pos = bmpImageoffset + (bmpHeight - 1 - row) * rowSize;
-          else     // Bitmap is stored top-to-bottom
-            pos = bmpImageoffset + row * rowSize;
-          if(bmpFile.position() != pos) { // Need seek?
-            bmpFile.seek(pos);
-            buffidx = sizeof(sdbuffer); // Force buffer reload
-          }
-
-          for (col=0; col<w; col++) { // For each pixel...
-            // Time to read more pixel data?
-            if (buffidx >= sizeof(sdbuffer)) { // Indeed
-              bmpFile.read(sdbuffer, sizeof(sdbuffer));
-              buffidx = 0; // Set index to beginning
+        // Crop area to be loaded so that only the visible
+        // part of the image is read and pushed
+        rVis = (gslc_tsRect){(int16_t)x,(int16_t)y,(uint16_t)bmpWidth,(uint16_t)bmpHeight};
+        #if (ADAGFX_CLIP)
+        gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+        if (!gslc_ClipRect(&pDriver->rClipRect,&rVis)) { rVis.h = 0; }
+        #else
+        gslc_tsRect rDisp = {0,0,pGui->nDispW,pGui->nDispH};
+        if (!gslc_ClipRect(&rDisp,&rVis)) { rVis.h = 0; }
+        #endif
+        nCol0 = rVis.x - x;
+        nRow0 = rVis.y - y;
+        nRowsPerBuf = (3*ADAGFX_SD_BUFFPIXEL) / rowSize;
+
+        if (nRowsPerBuf > 0) {
+          // Read blocks of whole rows
+          // - A bottom-to-top image is read in file order and its
+          //   rows drawn in reverse, so each block needs at most
+          //   one seek
+          for (row=0; row<rVis.h; row+=nRows) {
+            nRows = rVis.h - row;
+            if (nRows > nRowsPerBuf) nRows = nRowsPerBuf;
+            if(flip) // Bitmap is stored bottom-to-top order (normal BMP)
+              pos = bmpImageoffset + (bmpHeight - nRow0 - row - nRows) * rowSize;
+            else     // Bitmap is stored top-to-bottom
+              pos = bmpImageoffset + (nRow0 + row) * rowSize;
+            if(bmpFile.position() != pos) { // Need seek?
+              bmpFile.seek(pos);
             }
-
-            // Convert pixel from BMP to TFT format, push to display
-            b = sdbuffer[buffidx++];
-            g = sdbuffer[buffidx++];
-            r = sdbuffer[buffidx++];
-            //xxx tft.pushColor(tft.Color565(r,g,b));
-            gslc_tsColor nCol = (gslc_tsColor){r,g,b};
-            gslc_tsColor nColTrans = (gslc_tsColor){GSLC_BMP_TRANS_RGB};
-            bool bDrawBit = true;
-            if (GSLC_BMP_TRANS_EN) {
-              if ((nCol.r == nColTrans.r) && (nCol.g == nColTrans.g) && (nCol.b == nColTrans.b)) {
-                bDrawBit = false;
-              }
+            bmpFile.read((uint8_t*)sdbuffer,nRows*rowSize);
+            for (nBlk=0; nBlk<nRows; nBlk++) {
+              pRow = (uint8_t*)sdbuffer + nBlk*rowSize;
+              gslc_DrvPushBmp24Row(pGui,rVis.x,rVis.y + ((flip)? row+nRows-1-nBlk : row+nBlk),
+                pRow,pRow+nCol0*3,rVis.w);
             }
-            if (bDrawBit) {
-              gslc_DrvDrawPoint(pGui,x+col,y+row,nCol);
+          }
+        } else {
+          // Rows don't fit in the buffer, so read the visible
+          // part of each row in segments
+          for (row=0; row<rVis.h; row++) {
+            if(flip)
+              pos = bmpImageoffset + (bmpHeight - 1 - nRow0 - row) * rowSize + nCol0*3;
+            else
+              pos = bmpImageoffset + (nRow0 + row) * rowSize + nCol0*3;
+            if(bmpFile.position() != pos) {
+              bmpFile.seek(pos);
+            }
+            for (nSeg=0; nSeg<rVis.w; nSeg+=nSegLen) {
+              nSegLen = rVis.w - nSeg;
+              if (nSegLen > ADAGFX_SD_BUFFPIXEL) nSegLen = ADAGFX_SD_BUFFPIXEL;
+              bmpFile.read((uint8_t*)sdbuffer,nSegLen*3);
+              gslc_DrvPushBmp24Row(pGui,rVis.x+nSeg,rVis.y+row,
+                (uint8_t*)sdbuffer,(uint8_t*)sdbuffer,nSegLen);
             }
-            
-          } // end pixel
-        } // end scanline
-        //Serial.print("Loaded in ");
-        //Serial.print(millis() - startTime);
-        //Serial.println(" ms");
+          }
+        }
       } // end goodBmp
     }
   }
@@ -628,6 +887,37 @@ void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x,
   }
 }
 // ----- REFERENCE CODE end
+
+// Draw a run-length encoded image (GSLC_IMGREF_FMT_RLE16 or
+// GSLC_IMGREF_FMT_RLE8) from the SD card
+// - The file is streamed through the decoder in blocks, so
+//   the image is never held in RAM
+bool gslc_DrvDrawRleFromSD(gslc_tsGui* pGui,const char *filename,int16_t nDstX,int16_t nDstY,bool bPal)
+{
+  File              rleFile;
+  uint8_t           sdbuffer[3*ADAGFX_SD_BUFFPIXEL];
+  int               nRead;
+  gslc_tsImgRleDec  sDec;
+
+  if ((rleFile = SD.open(filename)) == 0) {
+    GSLC_DEBUG_PRINT("ERROR: DrvDrawRleFromSD() file not found [%s]",filename);
+    return false;
+  }
+  gslc_ImgRleInit(pGui,&sDec,nDstX,nDstY,bPal);
+  while ((sDec.eState != GSLC_IMGRLE_DONE) && (sDec.eState != GSLC_IMGRLE_ERR)) {
+    nRead = rleFile.read(sdbuffer,sizeof(sdbuffer));
+    if (nRead <= 0) {
+      break;
+    }
+    gslc_ImgRleDecode(pGui,&sDec,sdbuffer,nRead,false);
+  }
+  rleFile.close();
+  if (sDec.eState != GSLC_IMGRLE_DONE) {
+    GSLC_DEBUG_PRINT("ERROR: DrvDrawRleFromSD() image incomplete [%s]",filename);
+    return false;
+  }
+  return true;
+}
 #endif // ADAGFX_SD_EN
 
 
@@ -648,6 +938,15 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
       // - Dimensions and output color are defined in arrray header
       gslc_DrvDrawMonoFromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,false);
       return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RAW16) {
+      // Draw an RGB565 image from SRAM
+      gslc_DrvDrawRaw16FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,false);
+      return true;
+    } else if (((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE16) ||
+               ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE8)) {
+      // Draw a run-length encoded image from SRAM
+      return gslc_ImgRleDraw(pGui,nDstX,nDstY,sImgRef.pImgBuf,false,
+        ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE8));
     } else {
       return false; // TODO: not yet supported
     }    
@@ -660,6 +959,15 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
       // - Dimensions and output color are defined in arrray header
       gslc_DrvDrawMonoFromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,true);
       return true;      
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RAW16) {
+      // Draw an RGB565 image from program memory
+      gslc_DrvDrawRaw16FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,true);
+      return true;
+    } else if (((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE16) ||
+               ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE8)) {
+      // Draw a run-length encoded image from program memory
+      return gslc_ImgRleDraw(pGui,nDstX,nDstY,sImgRef.pImgBuf,true,
+        ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE8));
     } else {
       return false; // TODO: not yet supported
     }
@@ -671,6 +979,11 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
         // 24-bit Bitmap
         gslc_DrvDrawBmp24FromSD(pGui,sImgRef.pFname,nDstX,nDstY);   
         return true; 
+      } else if (((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE16) ||
+                 ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE8)) {
+        // Run-length encoded image
+        return gslc_DrvDrawRleFromSD(pGui,sImgRef.pFname,nDstX,nDstY,
+          ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE8));
       } else {
         // Unsupported format
         return false;
@@ -699,7 +1012,16 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
       //       background should be a flat color instead of
       //       an image.
       uint16_t nColRaw = pDriver->nColRawBkgnd;
+#if (ADAGFX_CLIP)
+      // Only fill the clipping region so that redrawing an
+      // invalidated region doesn't erase the rest of the display
+      gslc_tsRect rClipRect = pDriver->rClipRect;
+      pDriver->nWinCnt++;
+      m_disp.fillRect(rClipRect.x,rClipRect.y,rClipRect.w,rClipRect.h,nColRaw);
+#else
+      pDriver->nWinCnt++;
       m_disp.fillScreen(nColRaw);
+#endif
     } else {
       // An image should be loaded
       // TODO: For now, re-use the DrvDrawImage(). Later, consider
@@ -711,6 +1033,34 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
   }
 }
 
+void gslc_DrvDrawBkgndRect(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  if (pGui->pvDriver) {
+    gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+    if (pGui->sImgRefBkgnd.eImgFlags == GSLC_IMGREF_NONE) {
+      // Flat color background, so just fill the region
+#if (ADAGFX_CLIP)
+      if (!gslc_ClipRect(&pDriver->rClipRect,&rRect)) { return; }
+#endif
+      pDriver->nWinCnt++;
+      m_disp.fillRect(rRect.x,rRect.y,rRect.w,rRect.h,pDriver->nColRawBkgnd);
+    } else {
+      // The image sources (RAM, PROGMEM, SD) are decoded from the
+      // start, so redraw the full image but limit the clipping
+      // region to the requested rect
+      // - Without ADAGFX_CLIP the entire image is redrawn
+      gslc_tsRect rClipOld = pDriver->rClipRect;
+      gslc_tsRect rClipNew = rRect;
+      if (gslc_ClipRect(&rClipOld,&rClipNew)) {
+        pDriver->rClipRect = rClipNew;
+        gslc_DrvDrawImage(pGui,0,0,pGui->sImgRefBkgnd);
+      }
+      pDriver->rClipRect = rClipOld;
+    }
+  }
+}
+
 
 // -----------------------------------------------------------------------
 // Touch Functions (via display driver)
@@ -891,6 +1241,23 @@ bool gslc_TDrvGetTouch(gslc_tsGui* pGui,int16_t* pnX, int16_t* pnY, uint16_t* pn
 #endif // DRV_TOUCH_*
 
 
+// =======================================================================
+// Diagnostic Functions
+// =======================================================================
+
+uint32_t gslc_DrvAdaGetWinCnt(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return pDriver->nWinCnt;
+}
+
+void gslc_DrvAdaResetWinCnt(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nWinCnt = 0;
+}
+
+
 // =======================================================================
 // Private Functions
 // =======================================================================
@@ -919,6 +1286,87 @@ uint16_t gslc_DrvAdaptColorToRaw(gslc_tsColor nCol)
   return nColRaw;
 }
 
+uint16_t gslc_DrvAdaCircleSteps(uint16_t nRadius)
+{
+  // Same stepping as the midpoint loop in Adafruit-GFX
+  int16_t   nErr  = 1 - (int16_t)nRadius;
+  int16_t   nDdx  = 1;
+  int16_t   nDdy  = -2 * (int16_t)nRadius;
+  int16_t   nX    = 0;
+  int16_t   nY    = (int16_t)nRadius;
+  uint16_t  nSteps = 0;
+  while (nX < nY) {
+    if (nErr >= 0) {
+      nY--;
+      nDdy += 2;
+      nErr += nDdy;
+    }
+    nX++;
+    nDdx += 2;
+    nErr += nDdx;
+    nSteps++;
+  }
+  return nSteps;
+}
+
+uint16_t gslc_DrvDrawPtRuns(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,bool bVert,gslc_tsColor nCol)
+{
+  gslc_tsPt sPt;
+  uint16_t  nInd,nPos,nRunLen;
+  uint16_t  nNumSingle = 0;
+  int       nMaj,nMin,nRunMaj,nRunMin;
+
+  // Sort the points by row then column (or by column then row
+  // for vertical runs)
+  // - Insertion sort is used as the batches are small
+  for (nInd=1;nInd<nNumPt;nInd++) {
+    sPt  = asPt[nInd];
+    nMaj = (bVert)? sPt.x : sPt.y;
+    nMin = (bVert)? sPt.y : sPt.x;
+    for (nPos=nInd;nPos>0;nPos--) {
+      nRunMaj = (bVert)? asPt[nPos-1].x : asPt[nPos-1].y;
+      nRunMin = (bVert)? asPt[nPos-1].y : asPt[nPos-1].x;
+      if ((nRunMaj < nMaj) || ((nRunMaj == nMaj) && (nRunMin <= nMin))) {
+        break;
+      }
+      asPt[nPos] = asPt[nPos-1];
+    }
+    asPt[nPos] = sPt;
+  }
+
+  // Scan for runs of adjacent points
+  // - Duplicate points are dropped
+  nInd = 0;
+  while (nInd < nNumPt) {
+    sPt     = asPt[nInd];
+    nRunMaj = (bVert)? sPt.x : sPt.y;
+    nRunMin = (bVert)? sPt.y : sPt.x;
+    nRunLen = 1;
+    for (nInd++;nInd<nNumPt;nInd++) {
+      nMaj = (bVert)? asPt[nInd].x : asPt[nInd].y;
+      nMin = (bVert)? asPt[nInd].y : asPt[nInd].x;
+      if (nMaj != nRunMaj) { break; }
+      if (nMin == nRunMin+nRunLen-1) { continue; }
+      if (nMin != nRunMin+nRunLen) { break; }
+      nRunLen++;
+    }
+
+    if (nRunLen > 1) {
+      if (bVert) {
+        gslc_DrvDrawLineV(pGui,sPt.x,sPt.y,nRunLen,nCol);
+      } else {
+        gslc_DrvDrawLineH(pGui,sPt.x,sPt.y,nRunLen,nCol);
+      }
+    } else if (bVert) {
+      gslc_DrvDrawPoint(pGui,sPt.x,sPt.y,nCol);
+    } else {
+      // Keep isolated points for the vertical pass
+      asPt[nNumSingle++] = sPt;
+    }
+  }
+  return nNumSingle;
+}
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -58,13 +58,29 @@ extern "C" {
   
 #define DRV_HAS_DRAW_POINT          1 ///< Support gslc_DrvDrawPoint()
   
-  #define DRV_HAS_DRAW_POINTS         0 ///< Support gslc_DrvDrawPoints()  
-  #define DRV_HAS_DRAW_LINE           1 ///< Support gslc_DrvDrawLine()
+  #define DRV_HAS_DRAW_POINTS         1 ///< Support gslc_DrvDrawPoints()  
+  // Lines are drawn by the core as clipped spans since drawLine()
+  // sends diagonal lines to the display one pixel at a time
+  #define DRV_HAS_DRAW_LINE           0 ///< Support gslc_DrvDrawLine()
+  #define DRV_HAS_DRAW_LINE_H         1 ///< Support gslc_DrvDrawLineH()
+  #define DRV_HAS_DRAW_LINE_V         1 ///< Support gslc_DrvDrawLineV()
   #define DRV_HAS_DRAW_RECT_FRAME     1 ///< Support gslc_DrvDrawFrameRect()
   #define DRV_HAS_DRAW_RECT_FILL      1 ///< Support gslc_DrvDrawFillRect()
   #define DRV_HAS_DRAW_CIRCLE_FRAME   1 ///< Support gslc_DrvDrawFrameCircle()
   #define DRV_HAS_DRAW_CIRCLE_FILL    1 ///< Support gslc_DrvDrawFillCircle()
+  #define DRV_HAS_DRAW_RECT_ROUND_FRAME 1 ///< Support gslc_DrvDrawFrameRoundRect()
+  #define DRV_HAS_DRAW_RECT_ROUND_FILL  1 ///< Support gslc_DrvDrawFillRoundRect()
+  #define DRV_HAS_DRAW_TRI_FILL       1 ///< Support gslc_DrvDrawFillTriangle()
+  #define DRV_HAS_DRAW_ROW565         1 ///< Support gslc_DrvDrawRow565()
+  // Pixels can't be read back from the display for blending, so the
+  // anti-aliased primitives are drawn aliased by the core and
+  // semi-transparent fills are drawn opaque
+  #define DRV_HAS_DRAW_LINE_AA        0 ///< Support gslc_DrvDrawLineAA()
+  #define DRV_HAS_DRAW_CIRCLE_AA      0 ///< Support gslc_DrvDrawFrameCircleAA()
+  #define DRV_HAS_DRAW_RECT_FILL_ALPHA  0 ///< Support gslc_DrvDrawFillRectAlpha()
   #define DRV_HAS_DRAW_TEXT           1 ///< Support gslc_DrvDrawTxt()
+  // For the same reason, element caches aren't available
+  #define DRV_HAS_COPY_RECT           0 ///< Support gslc_DrvCopyRectOut(), gslc_DrvCopyRectIn()
   
 // =======================================================================
 // Driver-specific members
@@ -73,6 +89,8 @@ typedef struct {
   uint16_t      nColRawBkgnd;   ///< Background color (if not image-based)
   
   gslc_tsRect   rClipRect;      ///< Clipping rectangle
+
+  uint32_t      nWinCnt;        ///< Number of address windows sent to display
   
 } gslc_tsDriver;
   
@@ -132,6 +150,15 @@ bool gslc_DrvInitTs(gslc_tsGui* pGui,const char* acDev);
 void gslc_DrvDestruct(gslc_tsGui* pGui);
 
 
+///
+/// Get the elapsed time since startup
+/// - Used for scheduling of gslc_Update()
+///
+/// \return Elapsed time in milliseconds
+///
+uint32_t gslc_DrvGetTicks(void);
+
+
 // -----------------------------------------------------------------------
 // Image/surface handling Functions
 // -----------------------------------------------------------------------
@@ -195,6 +222,19 @@ bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
 
 
+///
+/// Get the size of an image loaded by gslc_DrvLoadImage()
+/// - Used to account for the image in the registry budget
+///   (see GSLC_IMG_CACHE_BYTES)
+///
+/// \param[in]  pGui:           Pointer to GUI
+/// \param[in]  pvImg:          Void ptr to image
+///
+/// \return Size of the image in bytes
+///
+uint32_t gslc_DrvGetImageBytes(gslc_tsGui* pGui,void* pvImg);
+
+
 /// 
 /// Release an image surface
 /// 
@@ -303,7 +343,10 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
 bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
 
 ///
-/// Draw a point
+/// Draw a set of points
+/// - The points are sorted in batches of ADAGFX_PTS_BATCH and
+///   neighbouring points on a row or column are sent to the display
+///   as a single span. The order of asPt is not modified.
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  asPt:        Array of points to draw
@@ -338,6 +381,23 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 
 
+///
+/// Draw a row of RGB565 pixels
+/// - Used to send the literal pixels of a run-length encoded
+///   image as one block
+/// - The pixels must be located in RAM
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of the first pixel
+/// \param[in]  nY:          Y coordinate of the row
+/// \param[in]  pnCol:       Pointer to the pixels (RGB565, host byte order)
+/// \param[in]  nCnt:        Number of pixels
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawRow565(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t* pnCol,uint16_t nCnt);
+
+
 ///
 /// Draw a line
 ///
@@ -353,6 +413,34 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
 
 
+///
+/// Draw a horizontal line (span)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          Line start (X coordinate)
+/// \param[in]  nY:          Line start (Y coordinate)
+/// \param[in]  nW:          Line length (pixels)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLineH(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nW,gslc_tsColor nCol);
+
+
+///
+/// Draw a vertical line (span)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          Line start (X coordinate)
+/// \param[in]  nY:          Line start (Y coordinate)
+/// \param[in]  nH:          Line length (pixels)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLineV(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nH,gslc_tsColor nCol);
+
+
 ///
 /// Draw a framed circle
 ///
@@ -381,6 +469,50 @@ bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16
 bool gslc_DrvDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol);
 
 
+///
+/// Draw a framed rectangle with rounded corners
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to frame
+/// \param[in]  nRadius:     Radius of the corners
+/// \param[in]  nCol:        Color RGB value to frame
+///
+/// \return true if success, false if the core should draw it instead
+///
+bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint16_t nRadius,gslc_tsColor nCol);
+
+
+///
+/// Draw a filled rectangle with rounded corners
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nRadius:     Radius of the corners
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return true if success, false if the core should draw it instead
+///
+bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,uint16_t nRadius,gslc_tsColor nCol);
+
+
+///
+/// Draw a filled triangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         X coordinate of first vertex
+/// \param[in]  nY0:         Y coordinate of first vertex
+/// \param[in]  nX1:         X coordinate of second vertex
+/// \param[in]  nY1:         Y coordinate of second vertex
+/// \param[in]  nX2:         X coordinate of third vertex
+/// \param[in]  nY2:         Y coordinate of third vertex
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return true if success, false if the core should draw it instead
+///
+bool gslc_DrvDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+  int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol);
+
+
 ///
 /// Copy all of source image to destination screen at specified coordinate
 ///
@@ -403,6 +535,18 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
 void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);  
 
 
+///
+/// Restore a region of the screen from the background image
+/// - For a flat color background, the region is simply filled
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the screen to restore
+///
+/// \return none
+///
+void gslc_DrvDrawBkgndRect(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+
 // -----------------------------------------------------------------------
 // Touch Functions (if using display driver library)
 // -----------------------------------------------------------------------  
@@ -465,6 +609,39 @@ bool gslc_TDrvGetTouch(gslc_tsGui* pGui,int16_t* pnX, int16_t* pnY, uint16_t* pn
 #endif // DRV_TOUCH_*
 
 
+// =======================================================================
+// Diagnostic Functions
+// - These functions are specific to this driver and report the
+//   amount of traffic sent to the display controller
+// =======================================================================
+
+///
+/// Get the number of address windows sent to the display
+/// - Each window selects a region on the controller before its
+///   pixels are sent and is the dominant cost of drawing over SPI
+/// - Points count as one window, spans, filled rects and image runs
+///   as one and framed rects as four. Diagonal lines count one per
+///   pixel, and circles, rounded rects and triangles count the spans
+///   and pixels that Adafruit-GFX sends for them.
+/// - Text drawn with the built-in Adafruit-GFX font isn't included
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return Window count since initialization or the last reset
+///
+uint32_t gslc_DrvAdaGetWinCnt(gslc_tsGui* pGui);
+
+
+///
+/// Reset the address window count
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvAdaResetWinCnt(gslc_tsGui* pGui);
+
+
 // =======================================================================
 // Private Functions
 // - These functions are not included in the scope of APIs used by
@@ -474,6 +651,36 @@ bool gslc_TDrvGetTouch(gslc_tsGui* pGui,int16_t* pnX, int16_t* pnY, uint16_t* pn
 
 uint16_t gslc_DrvAdaptColorToRaw(gslc_tsColor nCol);
 
+
+///
+/// Get the number of steps in the Adafruit-GFX midpoint circle loop
+/// - Used to count the address windows sent for circles and
+///   rounded rects
+///
+/// \param[in]  nRadius:     Radius of circle or corner
+///
+/// \return Number of steps
+///
+uint16_t gslc_DrvAdaCircleSteps(uint16_t nRadius);
+
+
+///
+/// Draw the runs of adjacent points within a set of points
+/// - The points are sorted in place
+/// - For horizontal runs, any isolated points are not drawn but
+///   are instead moved to the start of the array so that they can
+///   be passed to a subsequent vertical pass
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Array of points (modified)
+/// \param[in]  nNumPt:      Number of points in array
+/// \param[in]  bVert:       Find vertical runs instead of horizontal runs
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return Number of isolated points remaining (always 0 for vertical runs)
+///
+uint16_t gslc_DrvDrawPtRuns(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,bool bVert,gslc_tsColor nCol);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
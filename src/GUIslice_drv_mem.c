@@ -0,0 +1,1043 @@
+// =======================================================================
+// GUIslice library (driver layer for in-memory framebuffer)
+// - Calvin Hass
+// - http://www.impulseadventure.com/elec/guislice-gui.html
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2017 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+
+
+// =======================================================================
+// Driver Layer for in-memory framebuffer
+// =======================================================================
+
+// GUIslice library
+#include "GUIslice_drv_mem.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+// ------------------------------------------------------------------------
+// Built-in font
+// - Classic 5x7 font covering the printable ASCII range (0x20..0x7E)
+// - Each character is defined by 5 columns (left to right) with
+//   the least significant bit as the top row. Bit 7 is used by
+//   characters with descenders.
+// ------------------------------------------------------------------------
+#define DRV_MEM_FONT_FIRST  0x20
+#define DRV_MEM_FONT_LAST   0x7E
+
+const uint8_t m_acDrvMemFont[(DRV_MEM_FONT_LAST-DRV_MEM_FONT_FIRST+1)*5] = {
+  0x00,0x00,0x00,0x00,0x00, // ' '
+  0x00,0x00,0x5F,0x00,0x00, // '!'
+  0x00,0x07,0x00,0x07,0x00, // '"'
+  0x14,0x7F,0x14,0x7F,0x14, // '#'
+  0x24,0x2A,0x7F,0x2A,0x12, // '$'
+  0x23,0x13,0x08,0x64,0x62, // '%'
+  0x36,0x49,0x56,0x20,0x50, // '&'
+  0x00,0x08,0x07,0x03,0x00, // '''
+  0x00,0x1C,0x22,0x41,0x00, // '('
+  0x00,0x41,0x22,0x1C,0x00, // ')'
+  0x2A,0x1C,0x7F,0x1C,0x2A, // '*'
+  0x08,0x08,0x3E,0x08,0x08, // '+'
+  0x00,0x80,0x70,0x30,0x00, // ','
+  0x08,0x08,0x08,0x08,0x08, // '-'
+  0x00,0x00,0x60,0x60,0x00, // '.'
+  0x20,0x10,0x08,0x04,0x02, // '/'
+  0x3E,0x51,0x49,0x45,0x3E, // '0'
+  0x00,0x42,0x7F,0x40,0x00, // '1'
+  0x72,0x49,0x49,0x49,0x46, // '2'
+  0x21,0x41,0x49,0x4D,0x33, // '3'
+  0x18,0x14,0x12,0x7F,0x10, // '4'
+  0x27,0x45,0x45,0x45,0x39, // '5'
+  0x3C,0x4A,0x49,0x49,0x31, // '6'
+  0x41,0x21,0x11,0x09,0x07, // '7'
+  0x36,0x49,0x49,0x49,0x36, // '8'
+  0x46,0x49,0x49,0x29,0x1E, // '9'
+  0x00,0x00,0x14,0x00,0x00, // ':'
+  0x00,0x40,0x34,0x00,0x00, // ';'
+  0x00,0x08,0x14,0x22,0x41, // '<'
+  0x14,0x14,0x14,0x14,0x14, // '='
+  0x00,0x41,0x22,0x14,0x08, // '>'
+  0x02,0x01,0x59,0x09,0x06, // '?'
+  0x3E,0x41,0x5D,0x59,0x4E, // '@'
+  0x7C,0x12,0x11,0x12,0x7C, // 'A'
+  0x7F,0x49,0x49,0x49,0x36, // 'B'
+  0x3E,0x41,0x41,0x41,0x22, // 'C'
+  0x7F,0x41,0x41,0x41,0x3E, // 'D'
+  0x7F,0x49,0x49,0x49,0x41, // 'E'
+  0x7F,0x09,0x09,0x09,0x01, // 'F'
+  0x3E,0x41,0x41,0x51,0x73, // 'G'
+  0x7F,0x08,0x08,0x08,0x7F, // 'H'
+  0x00,0x41,0x7F,0x41,0x00, // 'I'
+  0x20,0x40,0x41,0x3F,0x01, // 'J'
+  0x7F,0x08,0x14,0x22,0x41, // 'K'
+  0x7F,0x40,0x40,0x40,0x40, // 'L'
+  0x7F,0x02,0x1C,0x02,0x7F, // 'M'
+  0x7F,0x04,0x08,0x10,0x7F, // 'N'
+  0x3E,0x41,0x41,0x41,0x3E, // 'O'
+  0x7F,0x09,0x09,0x09,0x06, // 'P'
+  0x3E,0x41,0x51,0x21,0x5E, // 'Q'
+  0x7F,0x09,0x19,0x29,0x46, // 'R'
+  0x26,0x49,0x49,0x49,0x32, // 'S'
+  0x03,0x01,0x7F,0x01,0x03, // 'T'
+  0x3F,0x40,0x40,0x40,0x3F, // 'U'
+  0x1F,0x20,0x40,0x20,0x1F, // 'V'
+  0x3F,0x40,0x38,0x40,0x3F, // 'W'
+  0x63,0x14,0x08,0x14,0x63, // 'X'
+  0x03,0x04,0x78,0x04,0x03, // 'Y'
+  0x61,0x59,0x49,0x4D,0x43, // 'Z'
+  0x00,0x7F,0x41,0x41,0x41, // '['
+  0x02,0x04,0x08,0x10,0x20, // '\'
+  0x00,0x41,0x41,0x41,0x7F, // ']'
+  0x04,0x02,0x01,0x02,0x04, // '^'
+  0x40,0x40,0x40,0x40,0x40, // '_'
+  0x00,0x03,0x07,0x08,0x00, // '`'
+  0x20,0x54,0x54,0x78,0x40, // 'a'
+  0x7F,0x28,0x44,0x44,0x38, // 'b'
+  0x38,0x44,0x44,0x44,0x28, // 'c'
+  0x38,0x44,0x44,0x28,0x7F, // 'd'
+  0x38,0x54,0x54,0x54,0x18, // 'e'
+  0x00,0x08,0x7E,0x09,0x02, // 'f'
+  0x18,0xA4,0xA4,0x9C,0x78, // 'g'
+  0x7F,0x08,0x04,0x04,0x78, // 'h'
+  0x00,0x44,0x7D,0x40,0x00, // 'i'
+  0x20,0x40,0x40,0x3D,0x00, // 'j'
+  0x7F,0x10,0x28,0x44,0x00, // 'k'
+  0x00,0x41,0x7F,0x40,0x00, // 'l'
+  0x7C,0x04,0x78,0x04,0x78, // 'm'
+  0x7C,0x08,0x04,0x04,0x78, // 'n'
+  0x38,0x44,0x44,0x44,0x38, // 'o'
+  0xFC,0x18,0x24,0x24,0x18, // 'p'
+  0x18,0x24,0x24,0x18,0xFC, // 'q'
+  0x7C,0x08,0x04,0x04,0x08, // 'r'
+  0x48,0x54,0x54,0x54,0x24, // 's'
+  0x04,0x04,0x3F,0x44,0x24, // 't'
+  0x3C,0x40,0x40,0x20,0x7C, // 'u'
+  0x1C,0x20,0x40,0x20,0x1C, // 'v'
+  0x3C,0x40,0x30,0x40,0x3C, // 'w'
+  0x44,0x28,0x10,0x28,0x44, // 'x'
+  0x4C,0x90,0x90,0x90,0x7C, // 'y'
+  0x44,0x64,0x54,0x4C,0x44, // 'z'
+  0x00,0x08,0x36,0x41,0x00, // '{'
+  0x00,0x00,0x77,0x00,0x00, // '|'
+  0x00,0x41,0x36,0x08,0x00, // '}'
+  0x02,0x01,0x02,0x04,0x02, // '~'
+};
+
+
+// =======================================================================
+// Public APIs to GUIslice core library
+// =======================================================================
+
+// -----------------------------------------------------------------------
+// Configuration Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvInit(gslc_tsGui* pGui)
+{
+  // Primary surface definitions
+  pGui->sImgRefBkgnd = gslc_ResetImage();
+
+  // Initialize any library-specific members
+  if (pGui->pvDriver) {
+    gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+    pDriver->nColBkgnd    = GSLC_COL_BLACK;
+    pDriver->nFlipCnt     = 0;
+    pDriver->pfuncFlip    = NULL;
+    pDriver->bTouchPend   = false;
+    pDriver->nTouchX      = 0;
+    pDriver->nTouchY      = 0;
+    pDriver->nTouchPress  = 0;
+
+    // Start with a black display
+    memset(pDriver->acFrameBuf,0,DRV_MEM_BUF_SZ);
+
+    pGui->nDispW      = DRV_MEM_WIDTH;
+    pGui->nDispH      = DRV_MEM_HEIGHT;
+    pGui->nDispDepth  = DRV_MEM_BPP;
+
+    // The framebuffer retains its contents between page flips
+    // so we can support partial redraw
+    pGui->bRedrawPartialEn = true;
+
+    // Attach the rasterizer, which also defaults the clipping region
+    if (!gslc_RasterInit(&pDriver->sRaster,pDriver->acFrameBuf,DRV_MEM_STRIDE,
+        DRV_MEM_WIDTH,DRV_MEM_HEIGHT,gslc_RasterGetFmt(DRV_MEM_BPP))) {
+      GSLC_DEBUG_PRINT("ERROR: DrvInit(%s) rasterizer init failed\n","");
+      return false;
+    }
+
+    // Describe the color channels (see gslc_DrvAdaptColorToRaw)
+    // so that the anti-aliased primitives can blend
+#if (DRV_MEM_BPP == 8)
+    gslc_RasterSetChannels(&pDriver->sRaster,5,3,2,3,0,2);
+#elif (DRV_MEM_BPP == 16)
+    gslc_RasterSetChannels(&pDriver->sRaster,11,5,5,6,0,5);
+#elif (DRV_MEM_BPP == 24)
+    gslc_RasterSetChannels(&pDriver->sRaster,0,8,8,8,16,8);
+#elif (DRV_MEM_BPP == 32)
+    gslc_RasterSetChannels(&pDriver->sRaster,16,8,8,8,0,8);
+#endif
+  }
+  return true;
+}
+
+
+void gslc_DrvDestruct(gslc_tsGui* pGui)
+{
+  // Nothing to deallocate as the framebuffer resides in the driver struct
+}
+
+
+uint32_t gslc_DrvGetTicks(void)
+{
+  struct timespec sTime;
+  clock_gettime(CLOCK_MONOTONIC,&sTime);
+  return (uint32_t)(sTime.tv_sec*1000 + sTime.tv_nsec/1000000);
+}
+
+
+// -----------------------------------------------------------------------
+// Image/surface handling Functions
+// -----------------------------------------------------------------------
+
+void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  if (sImgRef.eImgFlags == GSLC_IMGREF_NONE) {
+    return NULL;
+
+  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
+    // Read the entire file into memory. It is decoded during render.
+    // - The file size is stored ahead of the contents since
+    //   not every image format records it
+    FILE*           pFile;
+    long            nFileSz;
+    unsigned char*  pBuf;
+    pFile = fopen(sImgRef.pFname,"rb");
+    if (pFile == NULL) {
+      GSLC_DEBUG_PRINT("ERROR: DrvLoadImage(%s) failed to open file\n",sImgRef.pFname);
+      return NULL;
+    }
+    fseek(pFile,0,SEEK_END);
+    nFileSz = ftell(pFile);
+    fseek(pFile,0,SEEK_SET);
+    pBuf = (nFileSz > 0)? (unsigned char*)malloc(DRV_MEM_IMG_HDR+nFileSz) : NULL;
+    if ((pBuf == NULL) || (fread(pBuf+DRV_MEM_IMG_HDR,1,nFileSz,pFile) != (size_t)nFileSz)) {
+      GSLC_DEBUG_PRINT("ERROR: DrvLoadImage(%s) failed to read file\n",sImgRef.pFname);
+      free(pBuf);
+      fclose(pFile);
+      return NULL;
+    }
+    fclose(pFile);
+    *(uint32_t*)pBuf = (uint32_t)nFileSz;
+    return (void*)(pBuf+DRV_MEM_IMG_HDR);
+
+  } else {
+    // Images in RAM or program memory are decoded directly
+    // during render, so no preload is required. SD card
+    // access is not supported by this driver.
+    return NULL;
+  }
+}
+
+
+bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous background
+  if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_ImgCacheRelease(pGui,pGui->sImgRefBkgnd.pvImgRaw);
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+  }
+  pGui->sImgRefBkgnd = sImgRef;
+  pGui->sImgRefBkgnd.pvImgRaw = gslc_ImgCacheAcquire(pGui,sImgRef);
+  if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
+    if (pGui->sImgRefBkgnd.pvImgRaw == NULL) {
+      GSLC_DEBUG_PRINT("ERROR: DrvSetBkgndImage(%s) failed\n","");
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+  if (pGui->pvDriver) {
+    gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+    pDriver->nColBkgnd = nCol;
+  }
+  return true;
+}
+
+
+bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
+{
+  if (pElem->sImgRefNorm.pvImgRaw != NULL) {
+    GSLC_DEBUG_PRINT("ERROR: DrvSetElemImageNorm(%s) with pvImgRaw already set\n","");
+    return false;
+  }
+
+  pElem->sImgRefNorm = sImgRef;
+  pElem->sImgRefNorm.pvImgRaw = gslc_ImgCacheAcquire(pGui,sImgRef);
+  if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
+    if (pElem->sImgRefNorm.pvImgRaw == NULL) {
+      GSLC_DEBUG_PRINT("ERROR: DrvSetElemImageNorm(%s) failed\n","");
+      return false;
+    }
+  }
+  return true;
+}
+
+
+bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
+{
+  if (pElem->sImgRefGlow.pvImgRaw != NULL) {
+    GSLC_DEBUG_PRINT("ERROR: DrvSetElemImageGlow(%s) with pvImgRaw already set\n","");
+    return false;
+  }
+
+  pElem->sImgRefGlow = sImgRef;
+  pElem->sImgRefGlow.pvImgRaw = gslc_ImgCacheAcquire(pGui,sImgRef);
+  if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
+    if (pElem->sImgRefGlow.pvImgRaw == NULL) {
+      GSLC_DEBUG_PRINT("ERROR: DrvSetElemImageGlow(%s) failed\n","");
+      return false;
+    }
+  }
+  return true;
+}
+
+
+uint32_t gslc_DrvGetImageBytes(gslc_tsGui* pGui,void* pvImg)
+{
+  // Images from file are held as the file contents, preceded
+  // by the file size
+  const uint8_t* pBuf = (const uint8_t*)pvImg;
+  if (pBuf == NULL) {
+    return 0;
+  }
+  return DRV_MEM_IMG_HDR + *(const uint32_t*)(pBuf-DRV_MEM_IMG_HDR);
+}
+
+
+void gslc_DrvImageDestruct(void* pvImg)
+{
+  // Only images loaded from file have been allocated
+  if (pvImg == NULL) {
+    return;
+  }
+  free((uint8_t*)pvImg-DRV_MEM_IMG_HDR);
+}
+
+
+bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
+{
+  // A NULL rect defaults to the entire display
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_RasterSetClip(&pDriver->sRaster,pRect);
+  return true;
+}
+
+
+// -----------------------------------------------------------------------
+// Font handling Functions
+// -----------------------------------------------------------------------
+
+void* gslc_DrvFontAdd(const char* acFontName,uint16_t nFontSz)
+{
+  // Only the built-in font is available, so nothing to load
+  return NULL;
+}
+
+
+void gslc_DrvFontsDestruct(gslc_tsGui* pGui)
+{
+  // Nothing to deallocate
+}
+
+
+bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH)
+{
+  uint16_t  nTxtScale = gslc_DrvMemGetFontScale(pFont);
+  uint16_t  nTxtLen   = (pStr)? strlen(pStr) : 0;
+
+  *pnTxtSzW = nTxtLen*DRV_MEM_FONT_W*nTxtScale;
+  *pnTxtSzH = DRV_MEM_FONT_H*nTxtScale;
+  return true;
+}
+
+
+bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt)
+{
+  uint16_t        nTxtScale = gslc_DrvMemGetFontScale(pFont);
+  int16_t         nCharX    = nTxtX;
+  const uint8_t*  pGlyph;
+  uint8_t         nCol,nRow,nBits;
+  char            ch;
+
+  if (pStr == NULL) {
+    return true;
+  }
+
+  while ((ch = *pStr++)) {
+    if ((ch >= DRV_MEM_FONT_FIRST) && (ch <= DRV_MEM_FONT_LAST)) {
+      pGlyph = &m_acDrvMemFont[(ch-DRV_MEM_FONT_FIRST)*5];
+      for (nCol=0;nCol<5;nCol++) {
+        nBits = pGlyph[nCol];
+        for (nRow=0;nRow<8;nRow++) {
+          if (nBits & (1<<nRow)) {
+            if (nTxtScale == 1) {
+              gslc_DrvDrawPoint(pGui,nCharX+nCol,nTxtY+nRow,colTxt);
+            } else {
+              gslc_tsRect rDot = {nCharX+nCol*nTxtScale,nTxtY+nRow*nTxtScale,nTxtScale,nTxtScale};
+              gslc_DrvDrawFillRect(pGui,rDot,colTxt);
+            }
+          }
+        }
+      }
+    }
+    // Unsupported characters are left blank
+    nCharX += DRV_MEM_FONT_W*nTxtScale;
+  }
+
+  return true;
+}
+
+
+// -----------------------------------------------------------------------
+// Screen Management Functions
+// -----------------------------------------------------------------------
+
+void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  // The framebuffer is always up to date, so only notify the
+  // application that a new frame is complete
+  pDriver->nFlipCnt++;
+  if (pDriver->pfuncFlip != NULL) {
+    (*pDriver->pfuncFlip)((void*)pGui,pDriver->acFrameBuf);
+  }
+}
+
+
+// -----------------------------------------------------------------------
+// Graphics Primitives Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_RasterSetPixel(&pDriver->sRaster,nX,nY,gslc_DrvAdaptColorToRaw(nCol));
+  return true;
+}
+
+
+bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_RasterPoints(&pDriver->sRaster,asPt,nNumPt,gslc_DrvAdaptColorToRaw(nCol));
+  return true;
+}
+
+
+bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_RasterFillRect(&pDriver->sRaster,rRect,gslc_DrvAdaptColorToRaw(nCol));
+  return true;
+}
+
+
+bool gslc_DrvDrawRow565(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t* pnCol,uint16_t nCnt)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRaster*  pRaster = &pDriver->sRaster;
+  uint16_t        nInd;
+
+  // An RGB565 framebuffer takes the row as is
+  if (DRV_MEM_BPP == 16) {
+    gslc_RasterBlit(pRaster,nX,nY,(const uint8_t*)pnCol,nCnt*2,nCnt,1);
+    return true;
+  }
+  for (nInd=0;nInd<nCnt;nInd++) {
+    gslc_RasterSetPixel(pRaster,nX+nInd,nY,gslc_DrvAdaptColorToRaw(gslc_ImgRleColor(pnCol[nInd])));
+  }
+  return true;
+}
+
+
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_RasterFrameRect(&pDriver->sRaster,rRect,gslc_DrvAdaptColorToRaw(nCol));
+  return true;
+}
+
+
+bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_RasterLine(&pDriver->sRaster,nX0,nY0,nX1,nY1,gslc_DrvAdaptColorToRaw(nCol));
+  return true;
+}
+
+
+bool gslc_DrvDrawLineH(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nW,gslc_tsColor nCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_RasterFillSpan(&pDriver->sRaster,nX,nY,nW,gslc_DrvAdaptColorToRaw(nCol));
+  return true;
+}
+
+
+bool gslc_DrvDrawLineV(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nH,gslc_tsColor nCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_RasterFillRect(&pDriver->sRaster,(gslc_tsRect){nX,nY,1,nH},gslc_DrvAdaptColorToRaw(nCol));
+  return true;
+}
+
+
+bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_RasterFrameCircle(&pDriver->sRaster,nMidX,nMidY,nRadius,gslc_DrvAdaptColorToRaw(nCol));
+  return true;
+}
+
+
+bool gslc_DrvDrawLineAA(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_RasterCanBlend(&pDriver->sRaster)) {
+    return false;
+  }
+  gslc_RasterLineAA(&pDriver->sRaster,nX0,nY0,nX1,nY1,gslc_DrvAdaptColorToRaw(nCol));
+  return true;
+}
+
+
+bool gslc_DrvDrawFrameCircleAA(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_RasterCanBlend(&pDriver->sRaster)) {
+    return false;
+  }
+  gslc_RasterFrameCircleAA(&pDriver->sRaster,nMidX,nMidY,nRadius,gslc_DrvAdaptColorToRaw(nCol));
+  return true;
+}
+
+
+bool gslc_DrvDrawFillRectAlpha(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_RasterCanBlend(&pDriver->sRaster)) {
+    return false;
+  }
+  gslc_RasterFillRectAlpha(&pDriver->sRaster,rRect,gslc_DrvAdaptColorToRaw(nCol),255-nCol.transp);
+  return true;
+}
+
+
+uint32_t gslc_DrvCopyRectSize(gslc_tsGui* pGui,uint16_t nW,uint16_t nH)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return (uint32_t)gslc_RasterRowBytes(&pDriver->sRaster,nW) * nH;
+}
+
+
+bool gslc_DrvCopyRectOut(gslc_tsGui* pGui,gslc_tsRect rRect,uint8_t* pBuf)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return gslc_RasterCopyOut(&pDriver->sRaster,rRect,pBuf);
+}
+
+
+bool gslc_DrvCopyRectIn(gslc_tsGui* pGui,gslc_tsRect rRect,const uint8_t* pBuf)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRaster*  pRaster = &pDriver->sRaster;
+  gslc_RasterBlit(pRaster,rRect.x,rRect.y,pBuf,gslc_RasterRowBytes(pRaster,rRect.w),rRect.w,rRect.h);
+  return true;
+}
+
+
+bool gslc_DrvDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+{
+  // Not supported by driver (DRV_HAS_DRAW_CIRCLE_FILL=0)
+  return false;
+}
+
+
+bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef)
+{
+  const unsigned char*  pImgBuf;
+
+  if (sImgRef.eImgFlags == GSLC_IMGREF_NONE) {
+    return true;  // Nothing to do
+  }
+
+  // Images from file have been read into memory by gslc_DrvLoadImage()
+  // whereas images in RAM or program memory are accessed directly.
+  // On the hosts that this driver targets, program memory is
+  // directly addressable.
+  switch (sImgRef.eImgFlags & GSLC_IMGREF_SRC) {
+    case GSLC_IMGREF_SRC_FILE:
+      pImgBuf = (const unsigned char*)sImgRef.pvImgRaw;
+      break;
+    case GSLC_IMGREF_SRC_RAM:
+    case GSLC_IMGREF_SRC_PROG:
+      pImgBuf = sImgRef.pImgBuf;
+      break;
+    default:
+      // Unsupported source
+      return false;
+  }
+  if (pImgBuf == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: DrvDrawImage(%s) image not loaded\n","");
+    return false;
+  }
+
+  switch (sImgRef.eImgFlags & GSLC_IMGREF_FMT) {
+    case GSLC_IMGREF_FMT_RAW1:
+      gslc_DrvDrawMonoFromMem(pGui,nDstX,nDstY,pImgBuf);
+      return true;
+    case GSLC_IMGREF_FMT_BMP16:
+    case GSLC_IMGREF_FMT_BMP24:
+      return gslc_DrvDrawBmpFromMem(pGui,nDstX,nDstY,pImgBuf);
+    case GSLC_IMGREF_FMT_RAW16:
+    case GSLC_IMGREF_FMT_RAW24:
+      gslc_DrvDrawRawFromMem(pGui,nDstX,nDstY,pImgBuf,
+        ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RAW24));
+      return true;
+    case GSLC_IMGREF_FMT_RLE16:
+    case GSLC_IMGREF_FMT_RLE8:
+      return gslc_ImgRleDraw(pGui,nDstX,nDstY,pImgBuf,
+        ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG),
+        ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE8));
+    default:
+      // Unsupported format
+      return false;
+  }
+}
+
+
+void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
+{
+  if (pGui->pvDriver) {
+    gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+    if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
+      gslc_DrvDrawImage(pGui,0,0,pGui->sImgRefBkgnd);
+    } else {
+      gslc_tsRect rDisp = {0,0,pGui->nDispW,pGui->nDispH};
+      gslc_DrvDrawFillRect(pGui,rDisp,pDriver->nColBkgnd);
+    }
+  }
+}
+
+
+void gslc_DrvDrawBkgndRect(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  if (pGui->pvDriver) {
+    gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+    if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
+      // Narrow the clipping region to the rect while the
+      // background image is redrawn, then restore it
+      gslc_tsRect rClipOld = pDriver->sRaster.rClip;
+      if (gslc_ClipRect(&rClipOld,&rRect)) {
+        pDriver->sRaster.rClip = rRect;
+        gslc_DrvDrawImage(pGui,0,0,pGui->sImgRefBkgnd);
+        pDriver->sRaster.rClip = rClipOld;
+      }
+    } else {
+      gslc_DrvDrawFillRect(pGui,rRect,pDriver->nColBkgnd);
+    }
+  }
+}
+
+
+// -----------------------------------------------------------------------
+// Touch Functions (if using display driver library)
+// -----------------------------------------------------------------------
+
+bool gslc_DrvInitTouch(gslc_tsGui* pGui,const char* acDev)
+{
+  // Touch events are injected by gslc_DrvMemSetTouch()
+  return true;
+}
+
+
+bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!pDriver->bTouchPend) {
+    return false;
+  }
+  *pnX      = pDriver->nTouchX;
+  *pnY      = pDriver->nTouchY;
+  *pnPress  = pDriver->nTouchPress;
+  pDriver->bTouchPend = false;
+  return true;
+}
+
+
+// =======================================================================
+// Framebuffer Access Functions
+// =======================================================================
+
+uint8_t* gslc_DrvMemGetBuf(gslc_tsGui* pGui)
+{
+  if ((pGui == NULL) || (pGui->pvDriver == NULL)) {
+    GSLC_DEBUG_PRINT("ERROR: DrvMemGetBuf(%s) called with NULL ptr\n","");
+    return NULL;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return pDriver->acFrameBuf;
+}
+
+
+uint16_t gslc_DrvMemGetStride(gslc_tsGui* pGui)
+{
+  return DRV_MEM_STRIDE;
+}
+
+
+gslc_tsColor gslc_DrvMemGetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY)
+{
+  gslc_tsColor    nCol = GSLC_COL_BLACK;
+  if ((pGui == NULL) || (pGui->pvDriver == NULL)) {
+    GSLC_DEBUG_PRINT("ERROR: DrvMemGetPixel(%s) called with NULL ptr\n","");
+    return nCol;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint32_t        nRaw    = gslc_RasterGetPixel(&pDriver->sRaster,nX,nY);
+
+  // Expand each channel to 8 bits by replicating the upper bits
+#if (DRV_MEM_BPP == 1)
+  if (nRaw) {
+    nCol = GSLC_COL_WHITE;
+  }
+#elif (DRV_MEM_BPP == 8)
+  nCol.r = ((nRaw & 0xE0)) | ((nRaw & 0xE0) >> 3) | ((nRaw & 0xC0) >> 6);
+  nCol.g = ((nRaw & 0x1C) << 3) | ((nRaw & 0x1C)) | ((nRaw & 0x18) >> 3);
+  nCol.b = ((nRaw & 0x03) << 6) | ((nRaw & 0x03) << 4) | ((nRaw & 0x03) << 2) | (nRaw & 0x03);
+#elif (DRV_MEM_BPP == 16)
+  nCol.r = ((nRaw >> 8) & 0xF8) | ((nRaw >> 13) & 0x07);
+  nCol.g = ((nRaw >> 3) & 0xFC) | ((nRaw >>  9) & 0x03);
+  nCol.b = ((nRaw << 3) & 0xF8) | ((nRaw >>  2) & 0x07);
+#elif (DRV_MEM_BPP == 24)
+  nCol.r = (nRaw >>  0) & 0xFF;
+  nCol.g = (nRaw >>  8) & 0xFF;
+  nCol.b = (nRaw >> 16) & 0xFF;
+#elif (DRV_MEM_BPP == 32)
+  nCol.r = (nRaw >> 16) & 0xFF;
+  nCol.g = (nRaw >>  8) & 0xFF;
+  nCol.b = (nRaw >>  0) & 0xFF;
+#endif
+  return nCol;
+}
+
+
+uint32_t gslc_DrvMemGetFlipCnt(gslc_tsGui* pGui)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return pDriver->nFlipCnt;
+}
+
+
+void gslc_DrvMemSetFlipCb(gslc_tsGui* pGui,GSLC_CB_MEM_FLIP pfuncCb)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->pfuncFlip = pfuncCb;
+}
+
+
+void gslc_DrvMemSetTouch(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nPress)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nTouchX      = nX;
+  pDriver->nTouchY      = nY;
+  pDriver->nTouchPress  = nPress;
+  pDriver->bTouchPend   = true;
+}
+
+
+// =======================================================================
+// Private Functions
+// =======================================================================
+
+uint32_t gslc_DrvAdaptColorToRaw(gslc_tsColor nCol)
+{
+#if (DRV_MEM_BPP == 1)
+  // Threshold on the approximate luminance
+  uint16_t nLum = (nCol.r*3 + nCol.g*6 + nCol.b) / 10;
+  return (nLum >= 0x80)? 1 : 0;
+#elif (DRV_MEM_BPP == 8)
+  return (nCol.r & 0xE0) | ((nCol.g & 0xE0) >> 3) | (nCol.b >> 6);
+#elif (DRV_MEM_BPP == 16)
+  return ((nCol.r & 0xF8) << 8) | ((nCol.g & 0xFC) << 3) | (nCol.b >> 3);
+#elif (DRV_MEM_BPP == 24)
+  // The rasterizer stores the least significant byte first,
+  // which results in R,G,B byte order
+  return ((uint32_t)nCol.b << 16) | ((uint32_t)nCol.g << 8) | nCol.r;
+#elif (DRV_MEM_BPP == 32)
+  return ((uint32_t)nCol.r << 16) | ((uint32_t)nCol.g << 8) | nCol.b;
+#endif
+}
+
+
+uint16_t gslc_DrvMemGetFontScale(gslc_tsFont* pFont)
+{
+  uint16_t nSize = (pFont)? pFont->nSize : 1;
+  if (nSize < DRV_MEM_FONT_H) {
+    return (nSize > 0)? nSize : 1;
+  }
+  return nSize / DRV_MEM_FONT_H;
+}
+
+
+// Image array format (GSLC_IMGREF_FMT_RAW1):
+// - Width[15:8],  Width[7:0],
+// - Height[15:8], Height[7:0],
+// - ColorR[7:0],  ColorG[7:0],
+// - ColorB[7:0],  0x00,
+// - Monochrome bitmap follows (unset bits are transparent)
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,const unsigned char* pBitmap)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  int16_t         nW,nH,nX,nY;
+  int16_t         nByteW;
+  gslc_tsColor    nCol;
+  uint32_t        nColRaw;
+  const unsigned char* pRow;
+
+  nW      = (pBitmap[0] << 8) | pBitmap[1];
+  nH      = (pBitmap[2] << 8) | pBitmap[3];
+  nCol.r  = pBitmap[4];
+  nCol.g  = pBitmap[5];
+  nCol.b  = pBitmap[6];
+  nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  pBitmap += 8;
+
+  nByteW = (nW + 7) / 8;
+  for (nY=0;nY<nH;nY++) {
+    pRow = pBitmap + nY*nByteW;
+    for (nX=0;nX<nW;nX++) {
+      if (pRow[nX/8] & (0x80 >> (nX%8))) {
+        gslc_RasterSetPixel(&pDriver->sRaster,nDstX+nX,nDstY+nY,nColRaw);
+      }
+    }
+  }
+}
+
+void gslc_DrvDrawRawFromMem(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,const unsigned char* pImgBuf,bool b24)
+{
+  gslc_tsDriver*  pDriver   = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRaster*  pRaster   = &pDriver->sRaster;
+  gslc_tsColor    nColTrans = (gslc_tsColor){GSLC_BMP_TRANS_RGB};
+  uint16_t        nTrans565 = ((nColTrans.r & 0xF8) << 8) | ((nColTrans.g & 0xFC) << 3) | (nColTrans.b >> 3);
+  uint16_t        nW,nH,nX,nY;
+  uint16_t        nRunX;
+  uint8_t         nBytes;
+  bool            bNative;
+  bool            bTrans;
+  gslc_tsColor    nCol;
+  uint16_t        nCol565;
+  const uint8_t*  pPix;
+  const uint8_t*  pRow;
+
+  if (b24) {
+    nW      = (pImgBuf[0] << 8) | pImgBuf[1];
+    nH      = (pImgBuf[2] << 8) | pImgBuf[3];
+    nBytes  = 3;
+    bNative = (DRV_MEM_BPP == 24);
+  } else {
+    nW      = ((const uint16_t*)pImgBuf)[0];
+    nH      = ((const uint16_t*)pImgBuf)[1];
+    nBytes  = 2;
+    bNative = (DRV_MEM_BPP == 16);
+  }
+  pPix = pImgBuf + 4;
+
+  // Copy the whole image at once when nothing is transparent
+  if ((bNative) && (!GSLC_BMP_TRANS_EN)) {
+    gslc_RasterBlit(pRaster,nDstX,nDstY,pPix,nW*nBytes,nW,nH);
+    return;
+  }
+
+  for (nY=0;nY<nH;nY++) {
+    pRow  = pPix + (uint32_t)nY*nW*nBytes;
+    nRunX = 0;
+    for (nX=0;nX<nW;nX++) {
+      if (b24) {
+        nCol    = (gslc_tsColor){pRow[nX*3],pRow[nX*3+1],pRow[nX*3+2]};
+        bTrans  = (nCol.r == nColTrans.r) && (nCol.g == nColTrans.g) && (nCol.b == nColTrans.b);
+      } else {
+        nCol565 = ((const uint16_t*)pRow)[nX];
+        bTrans  = (nCol565 == nTrans565);
+      }
+      bTrans = bTrans && (GSLC_BMP_TRANS_EN);
+      if (bNative) {
+        // Copy the opaque run that ends at a transparent pixel
+        if (bTrans) {
+          if (nX > nRunX) {
+            gslc_RasterBlit(pRaster,nDstX+nRunX,nDstY+nY,pRow+nRunX*nBytes,nW*nBytes,nX-nRunX,1);
+          }
+          nRunX = nX+1;
+        }
+      } else if (!bTrans) {
+        if (!b24) {
+          nCol.r = ((nCol565 >> 8) & 0xF8) | (nCol565 >> 13);
+          nCol.g = ((nCol565 >> 3) & 0xFC) | ((nCol565 >> 9) & 0x03);
+          nCol.b = ((nCol565 << 3) & 0xF8) | ((nCol565 >> 2) & 0x07);
+        }
+        gslc_RasterSetPixel(pRaster,nDstX+nX,nDstY+nY,gslc_DrvAdaptColorToRaw(nCol));
+      }
+    }
+    if ((bNative) && (nW > nRunX)) {
+      gslc_RasterBlit(pRaster,nDstX+nRunX,nDstY+nY,pRow+nRunX*nBytes,nW*nBytes,nW-nRunX,1);
+    }
+  }
+}
+
+
+bool gslc_DrvDrawBmpFromMem(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,const unsigned char* pBmp)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint32_t        nOffset,nCompress,nMaskG;
+  int32_t         nBmpW,nBmpH;
+  uint16_t        nDepth;
+  uint32_t        nRowSz;
+  bool            bFlip = true;   // BMP is stored bottom-to-top
+  bool            b565  = false;
+  int16_t         nX,nY;
+  uint16_t        nPix;
+  const unsigned char* pRow;
+  const unsigned char* pPix;
+  gslc_tsColor    nCol;
+  gslc_tsColor    nColTrans = (gslc_tsColor){GSLC_BMP_TRANS_RGB};
+#if (DRV_MEM_BPP == 16)
+  uint16_t        nEndian   = 1;
+  uint16_t        nPixTrans = (uint16_t)gslc_DrvAdaptColorToRaw(nColTrans);
+  int16_t         nRunX;
+#endif
+
+  // Parse BMP header (all fields are little-endian)
+  #define BMP_RD16(nOfs) ((uint16_t)(pBmp[nOfs] | (pBmp[(nOfs)+1] << 8)))
+  #define BMP_RD32(nOfs) ((uint32_t)BMP_RD16(nOfs) | ((uint32_t)BMP_RD16((nOfs)+2) << 16))
+  if (BMP_RD16(0) != 0x4D42) {
+    GSLC_DEBUG_PRINT("ERROR: DrvDrawBmpFromMem(%s) missing BMP signature\n","");
+    return false;
+  }
+  nOffset   = BMP_RD32(10);
+  nBmpW     = (int32_t)BMP_RD32(18);
+  nBmpH     = (int32_t)BMP_RD32(22);
+  nDepth    = BMP_RD16(28);
+  nCompress = BMP_RD32(30);
+  if ((nDepth == 16) && (nCompress == 3)) {
+    // Bitfields: distinguish RGB565 from RGB555 by the green mask
+    nMaskG  = BMP_RD32(58);
+    b565    = (nMaskG == 0x07E0);
+  } else if (((nDepth != 16) && (nDepth != 24)) || (nCompress != 0)) {
+    GSLC_DEBUG_PRINT("ERROR: DrvDrawBmpFromMem(%s) BMP format unsupported\n","");
+    return false;
+  }
+  #undef BMP_RD16
+  #undef BMP_RD32
+
+  // If the height is negative, the image is in top-down order
+  if (nBmpH < 0) {
+    nBmpH = -nBmpH;
+    bFlip = false;
+  }
+  // BMP rows are padded to a 4-byte boundary
+  nRowSz = ((nBmpW * (nDepth/8)) + 3) & ~3;
+
+#if (DRV_MEM_BPP == 16)
+  // RGB565 rows match the framebuffer layout on little-endian
+  // hosts, so runs of opaque pixels are copied directly
+  #define BMP_PIX565(nInd) ((uint16_t)(pRow[(nInd)*2] | (pRow[(nInd)*2+1] << 8)))
+  if (b565 && (*(uint8_t*)&nEndian == 1)) {
+    for (nY=0;nY<nBmpH;nY++) {
+      pRow = pBmp + nOffset + ((bFlip)? (nBmpH-1-nY) : nY) * nRowSz;
+      nX = 0;
+      while (nX < nBmpW) {
+        if (GSLC_BMP_TRANS_EN) {
+          while ((nX < nBmpW) && (BMP_PIX565(nX) == nPixTrans)) { nX++; }
+        }
+        nRunX = nX;
+        while ((nX < nBmpW) && (!GSLC_BMP_TRANS_EN || (BMP_PIX565(nX) != nPixTrans))) { nX++; }
+        if (nX > nRunX) {
+          gslc_RasterBlit(&pDriver->sRaster,nDstX+nRunX,nDstY+nY,pRow+nRunX*2,nRowSz,nX-nRunX,1);
+        }
+      }
+    }
+    return true;
+  }
+  #undef BMP_PIX565
+#endif
+
+  for (nY=0;nY<nBmpH;nY++) {
+    pRow = pBmp + nOffset + ((bFlip)? (nBmpH-1-nY) : nY) * nRowSz;
+    for (nX=0;nX<nBmpW;nX++) {
+      if (!gslc_ClipPt(&pDriver->sRaster.rClip,nDstX+nX,nDstY+nY)) {
+        continue;
+      }
+      if (nDepth == 24) {
+        pPix    = pRow + nX*3;
+        nCol.b  = pPix[0];
+        nCol.g  = pPix[1];
+        nCol.r  = pPix[2];
+      } else {
+        pPix    = pRow + nX*2;
+        nPix    = pPix[0] | (pPix[1] << 8);
+        if (b565) {
+          nCol.r  = ((nPix >> 8) & 0xF8) | ((nPix >> 13) & 0x07);
+          nCol.g  = ((nPix >> 3) & 0xFC) | ((nPix >>  9) & 0x03);
+        } else {
+          nCol.r  = ((nPix >> 7) & 0xF8) | ((nPix >> 12) & 0x07);
+          nCol.g  = ((nPix >> 2) & 0xF8) | ((nPix >>  7) & 0x07);
+        }
+        nCol.b  = ((nPix << 3) & 0xF8) | ((nPix >> 2) & 0x07);
+      }
+      if (GSLC_BMP_TRANS_EN) {
+        if ((nCol.r == nColTrans.r) && (nCol.g == nColTrans.g) && (nCol.b == nColTrans.b)) {
+          continue;
+        }
+      }
+      gslc_RasterSetPixel(&pDriver->sRaster,nDstX+nX,nDstY+nY,gslc_DrvAdaptColorToRaw(nCol));
+    }
+  }
+  return true;
+}
@@ -0,0 +1,793 @@
+#ifndef _GUISLICE_DRV_MEM_H_
+#define _GUISLICE_DRV_MEM_H_
+
+// =======================================================================
+// GUIslice library (driver layer for in-memory framebuffer)
+// - Calvin Hass
+// - http://www.impulseadventure.com/elec/guislice-gui.html
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2017 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+
+
+// =======================================================================
+// Driver Layer for in-memory framebuffer
+// - Renders into a plain RAM buffer without any display hardware
+// - Useful for headless operation, screenshots and regression
+//   testing of the rendering output
+// =======================================================================
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include "GUIslice.h"
+#include "GUIslice_raster.h"
+
+#include <stdio.h>
+
+
+// =======================================================================
+// API support definitions
+// - These defines indicate whether the driver includes optimized
+//   support for various APIs. If a define is set to 0, then the
+//   GUIslice core emulation will be used instead.
+// - At the very minimum, the point draw routine must be available:
+//   gslc_DrvDrawPoint()
+// =======================================================================
+
+#define DRV_HAS_DRAW_POINT          1 ///< Support gslc_DrvDrawPoint()
+
+#define DRV_HAS_DRAW_POINTS         1 ///< Support gslc_DrvDrawPoints()
+#define DRV_HAS_DRAW_LINE           1 ///< Support gslc_DrvDrawLine()
+#define DRV_HAS_DRAW_LINE_H         1 ///< Support gslc_DrvDrawLineH()
+#define DRV_HAS_DRAW_LINE_V         1 ///< Support gslc_DrvDrawLineV()
+#define DRV_HAS_DRAW_RECT_FRAME     1 ///< Support gslc_DrvDrawFrameRect()
+#define DRV_HAS_DRAW_RECT_FILL      1 ///< Support gslc_DrvDrawFillRect()
+#define DRV_HAS_DRAW_CIRCLE_FRAME   1 ///< Support gslc_DrvDrawFrameCircle()
+#define DRV_HAS_DRAW_CIRCLE_FILL    0 ///< Support gslc_DrvDrawFillCircle()
+#define DRV_HAS_DRAW_RECT_ROUND_FRAME 0 ///< Support gslc_DrvDrawFrameRoundRect()
+#define DRV_HAS_DRAW_RECT_ROUND_FILL  0 ///< Support gslc_DrvDrawFillRoundRect()
+#define DRV_HAS_DRAW_TRI_FILL       0 ///< Support gslc_DrvDrawFillTriangle()
+#define DRV_HAS_DRAW_ROW565         1 ///< Support gslc_DrvDrawRow565()
+#define DRV_HAS_DRAW_LINE_AA        1 ///< Support gslc_DrvDrawLineAA()
+#define DRV_HAS_DRAW_CIRCLE_AA      1 ///< Support gslc_DrvDrawFrameCircleAA()
+#define DRV_HAS_DRAW_RECT_FILL_ALPHA  1 ///< Support gslc_DrvDrawFillRectAlpha()
+#define DRV_HAS_DRAW_TEXT           1 ///< Support gslc_DrvDrawTxt()
+#define DRV_HAS_COPY_RECT           1 ///< Support gslc_DrvCopyRectOut(), gslc_DrvCopyRectIn()
+
+
+// =======================================================================
+// Framebuffer layout
+// - Pixels are stored row by row, starting at the top-left corner
+// - DRV_MEM_BPP selects the pixel format:
+//   - 32: XRGB8888, one native-endian uint32_t per pixel
+//   - 24: RGB888, three bytes per pixel in R,G,B order
+//   - 16: RGB565, one native-endian uint16_t per pixel
+//   -  8: RGB332, one byte per pixel
+//   -  1: Monochrome, eight pixels per byte (MSB is leftmost)
+// =======================================================================
+
+#if (DRV_MEM_BPP == 1)
+  #define DRV_MEM_STRIDE  ((DRV_MEM_WIDTH+7)/8)   ///< Bytes per framebuffer row
+#elif (DRV_MEM_BPP == 8) || (DRV_MEM_BPP == 16) || (DRV_MEM_BPP == 24) || (DRV_MEM_BPP == 32)
+  #define DRV_MEM_STRIDE  (DRV_MEM_WIDTH*(DRV_MEM_BPP/8)) ///< Bytes per framebuffer row
+#else
+  #error "DRV_MEM_BPP must be 1, 8, 16, 24 or 32 in GUIslice_config.h"
+#endif
+
+#define DRV_MEM_BUF_SZ    (DRV_MEM_STRIDE*DRV_MEM_HEIGHT) ///< Framebuffer size (bytes)
+
+#define DRV_MEM_FONT_W    6   ///< Width of built-in font cell (pixels, including spacing)
+#define DRV_MEM_FONT_H    8   ///< Height of built-in font cell (pixels, including spacing)
+
+#define DRV_MEM_IMG_HDR   4   ///< Bytes ahead of an image loaded from file (holding the file size)
+
+
+/// Callback function for page flips of the in-memory framebuffer
+/// - Called with the framebuffer after every gslc_DrvPageFlipNow()
+typedef void (*GSLC_CB_MEM_FLIP)(void* pvGui,const uint8_t* pBuf);
+
+
+// =======================================================================
+// Driver-specific members
+// =======================================================================
+typedef struct {
+  uint8_t           acFrameBuf[DRV_MEM_BUF_SZ]; ///< Framebuffer (see DRV_MEM_BPP)
+
+  gslc_tsColor      nColBkgnd;      ///< Background color (if not image-based)
+
+  gslc_tsRaster     sRaster;        ///< Rasterizer for framebuffer (includes clipping)
+
+  uint32_t          nFlipCnt;       ///< Number of page flips performed
+  GSLC_CB_MEM_FLIP  pfuncFlip;      ///< Callback on page flip (or NULL)
+
+  bool              bTouchPend;     ///< Injected touch event is pending
+  int16_t           nTouchX;        ///< Injected touch X coordinate
+  int16_t           nTouchY;        ///< Injected touch Y coordinate
+  uint16_t          nTouchPress;    ///< Injected touch pressure (0 for release)
+
+} gslc_tsDriver;
+
+
+
+// =======================================================================
+// Public APIs to GUIslice core library
+// - These functions define the renderer / driver-dependent
+//   implementations for the core drawing operations within
+//   GUIslice.
+// =======================================================================
+
+
+// -----------------------------------------------------------------------
+// Configuration Functions
+// -----------------------------------------------------------------------
+
+///
+/// Initialize the in-memory framebuffer
+/// - Clears the framebuffer to black
+/// - Configures the display dimensions from DRV_MEM_WIDTH
+///   and DRV_MEM_HEIGHT
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvInit(gslc_tsGui* pGui);
+
+
+///
+/// Free up any members associated with the driver
+/// - Eg. renderers, windows, background surfaces, etc.
+/// 
+/// \param[in]  pGui:         Pointer to GUI
+/// 
+/// \return none
+///
+void gslc_DrvDestruct(gslc_tsGui* pGui);
+
+
+///
+/// Get the elapsed time since startup
+/// - Used for scheduling of gslc_Update()
+///
+/// \return Elapsed time in milliseconds
+///
+uint32_t gslc_DrvGetTicks(void);
+
+
+// -----------------------------------------------------------------------
+// Image/surface handling Functions
+// -----------------------------------------------------------------------
+
+
+///
+/// Load a bitmap (*.bmp) and create a new image resource.
+/// Transparency is enabled by GSLC_BMP_TRANS_EN
+/// through use of color (GSLC_BMP_TRANS_RGB).
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return Image pointer (surface/texture) or NULL if error
+///
+void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+
+///
+/// Configure the background to use a bitmap image
+/// - The background is used when redrawing the entire page
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+///
+/// Configure the background to use a solid color
+/// - The background is used when redrawing the entire page
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nCol:        RGB Color to use
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol);
+
+///
+/// Set an element's normal-state image
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element to update
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
+
+///
+/// Set an element's glow-state image
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element to update
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if error
+///  
+bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
+
+
+///
+/// Get the size of an image loaded by gslc_DrvLoadImage()
+/// - Used to account for the image in the registry budget
+///   (see GSLC_IMG_CACHE_BYTES)
+///
+/// \param[in]  pGui:           Pointer to GUI
+/// \param[in]  pvImg:          Void ptr to image
+///
+/// \return Size of the image in bytes
+///
+uint32_t gslc_DrvGetImageBytes(gslc_tsGui* pGui,void* pvImg);
+
+
+/// 
+/// Release an image surface
+/// 
+/// \param[in]  pvImg:          Void ptr to image
+/// 
+/// \return none
+///
+void gslc_DrvImageDestruct(void* pvImg);  
+
+
+/// 
+/// Set the clipping rectangle for future drawing updates
+/// 
+/// \param[in]  pGui:          Pointer to GUI  
+/// \param[in]  pRect:         Rectangular region to constrain edits
+/// 
+/// \return none
+///
+bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect);
+
+
+// -----------------------------------------------------------------------
+// Font handling Functions
+// -----------------------------------------------------------------------
+
+///
+/// Load a font from a file and return pointer to it
+/// - This driver only provides a built-in 5x7 font, so the
+///   font name is ignored. The font size selects the scaling
+///   (see gslc_DrvMemGetFontScale())
+///
+/// \param[in]  acFontName:  Filename path to the font
+/// \param[in]  nFontSz:     Typeface size to use
+///
+/// \return NULL as no font resource is allocated
+///
+void* gslc_DrvFontAdd(const char* acFontName,uint16_t nFontSz);
+
+/// 
+/// Release all fonts defined in the GUI
+/// 
+/// \param[in]  pGui:          Pointer to GUI  
+/// 
+/// \return none
+///
+void gslc_DrvFontsDestruct(gslc_tsGui* pGui);
+
+
+///
+/// Get the extent (width and height) of a text string
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFont:       Ptr to Font structure
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[out] pnTxtSzW:    Ptr to width of text
+/// \param[out] pnTxtSzH:    Ptr to height of text
+///
+/// \return true if success, false if failure
+///  
+bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH);
+
+
+///
+/// Draw a text string at the given coordinate
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTxtX:       X coordinate of top-left text string
+/// \param[in]  nTxtY:       Y coordinate of top-left text string
+/// \param[in]  pFont:       Ptr to Font
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[in]  colTxt:      Color to draw text
+///
+/// \return true if success, false if failure
+///  
+bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt);
+
+
+// -----------------------------------------------------------------------
+// Screen Management Functions
+// -----------------------------------------------------------------------
+
+///
+/// Force a page flip to occur. As the framebuffer is already
+/// the display surface, this only counts the flip and invokes
+/// the flip callback (if one was set by gslc_DrvMemSetFlipCb).
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+/// 
+void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Graphics Primitives Functions
+// -----------------------------------------------------------------------  
+
+///
+/// Draw a point
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of point
+/// \param[in]  nY:          Y coordinate of point
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
+
+///
+/// Draw a point
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Array of points to draw
+/// \param[in]  nNumPt:      Number of points in array
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+
+///
+/// Draw a framed rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to frame
+/// \param[in]  nCol:        Color RGB value to frame
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Draw a filled rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Draw a row of RGB565 pixels
+/// - Used to send the literal pixels of a run-length encoded
+///   image as one block
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of the first pixel
+/// \param[in]  nY:          Y coordinate of the row
+/// \param[in]  pnCol:       Pointer to the pixels (RGB565, host byte order)
+/// \param[in]  nCnt:        Number of pixels
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawRow565(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t* pnCol,uint16_t nCnt);
+
+
+///
+/// Draw a line
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         Line start (X coordinate)
+/// \param[in]  nY0:         Line start (Y coordinate)
+/// \param[in]  nX1:         Line finish (X coordinate)
+/// \param[in]  nY1:         Line finish (Y coordinate)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
+
+
+///
+/// Draw a horizontal line (span)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          Line start (X coordinate)
+/// \param[in]  nY:          Line start (Y coordinate)
+/// \param[in]  nW:          Line length (pixels)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLineH(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nW,gslc_tsColor nCol);
+
+
+///
+/// Draw a vertical line (span)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          Line start (X coordinate)
+/// \param[in]  nY:          Line start (Y coordinate)
+/// \param[in]  nH:          Line length (pixels)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLineV(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nH,gslc_tsColor nCol);
+
+
+///
+/// Draw a framed circle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMidX:       Center of circle (X coordinate)
+/// \param[in]  nMidY:       Center of circle (Y coordinate)
+/// \param[in]  nRadius:     Radius of circle
+/// \param[in]  nCol:        Color RGB value to frame
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol);
+
+
+///
+/// Draw an anti-aliased line
+/// - Blends the line with the existing pixels
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         Line start (X coordinate)
+/// \param[in]  nY0:         Line start (Y coordinate)
+/// \param[in]  nX1:         Line finish (X coordinate)
+/// \param[in]  nY1:         Line finish (Y coordinate)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if blending isn't supported
+///
+bool gslc_DrvDrawLineAA(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
+
+
+///
+/// Draw an anti-aliased framed circle
+/// - Blends the circle with the existing pixels
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMidX:       Center of circle (X coordinate)
+/// \param[in]  nMidY:       Center of circle (Y coordinate)
+/// \param[in]  nRadius:     Radius of circle
+/// \param[in]  nCol:        Color RGB value to frame
+///
+/// \return true if success, false if blending isn't supported
+///
+bool gslc_DrvDrawFrameCircleAA(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol);
+
+
+///
+/// Draw a filled rectangle blended with the existing pixels
+/// - The opacity is taken from the transparency of the color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nCol:        Color RGB value and transparency to fill
+///
+/// \return true if success, false if blending isn't supported
+///
+bool gslc_DrvDrawFillRectAlpha(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Determine the number of bytes needed to hold a copy of
+/// a display region (see gslc_DrvCopyRectOut)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nW:          Width of region
+/// \param[in]  nH:          Height of region
+///
+/// \return Number of bytes or 0 if copying isn't supported
+///
+uint32_t gslc_DrvCopyRectSize(gslc_tsGui* pGui,uint16_t nW,uint16_t nH);
+
+
+///
+/// Copy the pixels of a display region to a buffer
+/// - The clipping region is ignored
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region to copy
+/// \param[out] pBuf:        Buffer of gslc_DrvCopyRectSize() bytes
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvCopyRectOut(gslc_tsGui* pGui,gslc_tsRect rRect,uint8_t* pBuf);
+
+
+///
+/// Copy pixels saved by gslc_DrvCopyRectOut() back to
+/// the display (clipped)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region to restore (same size as the copy)
+/// \param[in]  pBuf:        Buffer holding the copy
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvCopyRectIn(gslc_tsGui* pGui,gslc_tsRect rRect,const uint8_t* pBuf);
+
+
+///
+/// Draw a filled circle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMidX:       Center of circle (X coordinate)
+/// \param[in]  nMidY:       Center of circle (Y coordinate)
+/// \param[in]  nRadius:     Radius of circle
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol);
+
+
+///
+/// Copy all of source image to destination screen at specified coordinate
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord for copy
+/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef);
+
+///
+/// Copy the background image to destination screen
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);  
+
+
+///
+/// Restore a region of the screen from the background image
+/// - For a flat color background, the region is simply filled
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the screen to restore
+///
+/// \return none
+///
+void gslc_DrvDrawBkgndRect(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+
+// -----------------------------------------------------------------------
+// Touch Functions (if using display driver library)
+// -----------------------------------------------------------------------  
+
+///
+/// Perform any touchscreen-specific initialization
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  acDev:       Device path to touchscreen
+///                          eg. "/dev/input/touchscreen"
+///
+/// \return true if successful
+///
+bool gslc_DrvInitTouch(gslc_tsGui* pGui,const char* acDev);
+
+
+///
+/// Get the last touch event injected by gslc_DrvMemSetTouch()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnX:         Ptr to X coordinate of last touch event
+/// \param[out] pnY:         Ptr to Y coordinate of last touch event
+/// \param[out] pnPress:     Ptr to Pressure level of last touch event (0 for none, 1 for touch)
+///
+/// \return true if an event was detected or false otherwise
+///
+bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX, int16_t* pnY, uint16_t* pnPress);
+
+
+// =======================================================================
+// Framebuffer Access Functions
+// - These functions are specific to this driver and give the
+//   application access to the rendered output
+// =======================================================================
+
+///
+/// Get a pointer to the framebuffer
+/// - The layout is defined by DRV_MEM_BPP and the row stride
+///   by gslc_DrvMemGetStride()
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return Pointer to the framebuffer or NULL if error
+///
+uint8_t* gslc_DrvMemGetBuf(gslc_tsGui* pGui);
+
+
+///
+/// Get the number of bytes per framebuffer row
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return Row stride in bytes
+///
+uint16_t gslc_DrvMemGetStride(gslc_tsGui* pGui);
+
+
+///
+/// Read back a pixel from the framebuffer
+/// - The color is expanded from the framebuffer pixel format,
+///   so it may differ from the color that was drawn
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of pixel
+/// \param[in]  nY:          Y coordinate of pixel
+///
+/// \return Pixel color (black if out of range)
+///
+gslc_tsColor gslc_DrvMemGetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY);
+
+
+///
+/// Get the number of page flips performed since initialization
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return Page flip count
+///
+uint32_t gslc_DrvMemGetFlipCnt(gslc_tsGui* pGui);
+
+
+///
+/// Set the callback that is invoked on every page flip
+/// - Can be used to copy the framebuffer to an external
+///   display, a file or a network stream
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pfuncCb:     Callback function (or NULL to disable)
+///
+/// \return none
+///
+void gslc_DrvMemSetFlipCb(gslc_tsGui* pGui,GSLC_CB_MEM_FLIP pfuncCb);
+
+
+///
+/// Inject a touch event
+/// - The event is reported by the next call to gslc_DrvGetTouch()
+///   when the touch driver is DRV_TOUCH_MEM
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of touch event
+/// \param[in]  nY:          Y coordinate of touch event
+/// \param[in]  nPress:      Pressure level (0 for release, 1 for touch)
+///
+/// \return none
+///
+void gslc_DrvMemSetTouch(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nPress);
+
+
+// =======================================================================
+// Private Functions
+// - These functions are not included in the scope of APIs used by
+//   the core GUIslice library. Instead, these functions are used
+//   to support the operations within this driver layer.
+// =======================================================================
+
+///
+/// Convert a color into the framebuffer pixel format
+///
+/// \param[in]  nCol:        RGB color
+///
+/// \return Raw pixel value
+///
+uint32_t gslc_DrvAdaptColorToRaw(gslc_tsColor nCol);
+
+///
+/// Get the text scaling factor used for a font
+/// - Sizes below the built-in font height are treated as a
+///   scaling factor (as in the Adafruit-GFX driver)
+/// - Larger sizes are treated as the font height in pixels
+///   (as in the SDL driver)
+///
+/// \param[in]  pFont:       Ptr to Font
+///
+/// \return Scaling factor (at least 1)
+///
+uint16_t gslc_DrvMemGetFontScale(gslc_tsFont* pFont);
+
+///
+/// Draw a monochrome bitmap (GSLC_IMGREF_FMT_RAW1)
+/// - Dimensions and output color are defined in the array header
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coordinate
+/// \param[in]  nDstY:       Destination Y coordinate
+/// \param[in]  pBitmap:     Pointer to image array
+///
+/// \return none
+///
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,const unsigned char* pBitmap);
+
+///
+/// Draw a raw pixel array (GSLC_IMGREF_FMT_RAW16 or GSLC_IMGREF_FMT_RAW24)
+/// - If the framebuffer has the same pixel format (DRV_MEM_BPP of 16
+///   or 24), rows are copied without conversion
+/// - Pixels matching GSLC_BMP_TRANS_RGB are skipped if
+///   GSLC_BMP_TRANS_EN is enabled
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coordinate
+/// \param[in]  nDstY:       Destination Y coordinate
+/// \param[in]  pImgBuf:     Pointer to image array
+/// \param[in]  b24:         Image is RGB888 (GSLC_IMGREF_FMT_RAW24)
+///
+/// \return none
+///
+void gslc_DrvDrawRawFromMem(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,const unsigned char* pImgBuf,bool b24);
+
+///
+/// Draw an uncompressed BMP file image (16-bit or 24-bit) held in memory
+/// - Pixels matching GSLC_BMP_TRANS_RGB are skipped if
+///   GSLC_BMP_TRANS_EN is enabled
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coordinate
+/// \param[in]  nDstY:       Destination Y coordinate
+/// \param[in]  pBmp:        Pointer to the BMP file contents
+///
+/// \return true if success, false if the format is unsupported
+///
+bool gslc_DrvDrawBmpFromMem(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,const unsigned char* pBmp);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // _GUISLICE_DRV_MEM_H_
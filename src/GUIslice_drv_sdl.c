@@ -38,6 +38,7 @@
 #include "GUIslice_drv_sdl.h"
 
 #include <stdio.h>
+#include <stdlib.h>   // For abs()
 
 
 // Optionally enable SDL clean start VT workaround
@@ -72,18 +73,40 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
   if (pGui->pvDriver) {
     gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
     
+    pDriver->nColBkgnd   = GSLC_COL_BLACK;
+
     #if defined(DRV_DISP_SDL1)
     pDriver->pSurfScreen = NULL;
+    pDriver->nUpdateRectCnt = 0;
     pGui->bRedrawPartialEn = true;
     #endif
 
     #if defined(DRV_DISP_SDL2)
     pDriver->pWind       = NULL;
     pDriver->pRender     = NULL;
+    pDriver->pTexTarget  = NULL;
     // In SDL2, always need full page redraw since backbuffer
     // is treated as invalidated after every RenderPresent()
+    // - This is relaxed below if a persistent render target is created
     pGui->bRedrawPartialEn = false;
     #endif
+
+    #if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+    uint8_t nAtlasInd;
+    for (nAtlasInd=0;nAtlasInd<DRV_SDL_GLYPH_ATLAS_MAX;nAtlasInd++) {
+      pDriver->asGlyphAtlas[nAtlasInd].pFont    = NULL;
+      #if defined(DRV_DISP_SDL1)
+      pDriver->asGlyphAtlas[nAtlasInd].pSurf    = NULL;
+      #endif
+      #if defined(DRV_DISP_SDL2)
+      pDriver->asGlyphAtlas[nAtlasInd].pTex     = NULL;
+      #endif
+      pDriver->asGlyphAtlas[nAtlasInd].nLastUse = 0;
+    }
+    pDriver->nGlyphUseCnt = 0;
+    #endif
+    pDriver->nGlyphHit    = 0;
+    pDriver->nGlyphMiss   = 0;
   }
 
 
@@ -129,6 +152,23 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
     GSLC_DEBUG_PRINT("ERROR: DrvInit() error in SDL_SetVideoMode(): %s\n",SDL_GetError());
     return false;
   }
+
+  // Draw directly into the software surface with the rasterizer
+  // - Note that the pixel format is based on the storage size
+  //   since 15-bit surfaces still occupy two bytes per pixel
+  SDL_Surface*  pScreen = pDriver->pSurfScreen;
+  if (!gslc_RasterInit(&pDriver->sRaster,(uint8_t*)pScreen->pixels,pScreen->pitch,
+      pScreen->w,pScreen->h,gslc_RasterGetFmt(pScreen->format->BytesPerPixel*8))) {
+    GSLC_DEBUG_PRINT("ERROR: DrvInit() unsupported screen depth (%u bpp)\n",pScreen->format->BitsPerPixel);
+    return false;
+  }
+  // Describe the color channels so that the anti-aliased primitives
+  // can blend (palettized surfaces don't support blending)
+  SDL_PixelFormat* pFmt = pScreen->format;
+  if (pFmt->palette == NULL) {
+    gslc_RasterSetChannels(&pDriver->sRaster,pFmt->Rshift,8-pFmt->Rloss,
+      pFmt->Gshift,8-pFmt->Gloss,pFmt->Bshift,8-pFmt->Bloss);
+  }
 #endif  
 #if defined(DRV_DISP_SDL2)
   // Default to using OpenGL rendering engine and full-screen
@@ -156,12 +196,32 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
   pGui->nDispDepth = SDL_BITSPERPIXEL(sDispMode.format);
   
   // Create renderer
+  #if (DRV_SDL_RENDER_TARGET)
+  pDriver->pRender = SDL_CreateRenderer(pDriver->pWind,-1,SDL_RENDERER_ACCELERATED | SDL_RENDERER_TARGETTEXTURE);
+  #else
   pDriver->pRender = SDL_CreateRenderer(pDriver->pWind,-1,SDL_RENDERER_ACCELERATED);
+  #endif
   if (!pDriver->pRender) {
     GSLC_DEBUG_PRINT("ERROR: DrvInit() error in SDL_CreateRenderer(): %s\n",SDL_GetError());
     return false;
   }
 
+  #if (DRV_SDL_RENDER_TARGET)
+  // Create the persistent render target that all drawing is directed to.
+  // Since its content survives RenderPresent(), partial redraw is possible.
+  if (SDL_RenderTargetSupported(pDriver->pRender)) {
+    pDriver->pTexTarget = SDL_CreateTexture(pDriver->pRender,sDispMode.format,
+      SDL_TEXTUREACCESS_TARGET,nSystemX,nSystemY);
+  }
+  if (pDriver->pTexTarget) {
+    SDL_SetRenderTarget(pDriver->pRender,pDriver->pTexTarget);
+    pGui->bRedrawPartialEn = true;
+  } else {
+    // Fall back to rendering into the backbuffer with full page redraws
+    GSLC_DEBUG_PRINT("ERROR: DrvInit() render target unavailable, using full redraw: %s\n",SDL_GetError());
+  }
+  #endif
+
   // If we wanted to support scaling of the renderer, we would call
   // SDL_RenderSetLogicalSize() here. For now, don't scale.
   
@@ -186,6 +246,10 @@ void gslc_DrvDestruct(gslc_tsGui* pGui)
 {
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);  
+  if (pDriver->pTexTarget) {
+    SDL_DestroyTexture(pDriver->pTexTarget);
+    pDriver->pTexTarget = NULL;
+  }
   if (pDriver->pRender) {
     SDL_DestroyRenderer(pDriver->pRender);
     pDriver->pRender = NULL;
@@ -200,108 +264,177 @@ void gslc_DrvDestruct(gslc_tsGui* pGui)
   SDL_Quit();  
 }
 
+
+uint32_t gslc_DrvGetTicks(void)
+{
+  return SDL_GetTicks();
+}
+
 // -----------------------------------------------------------------------
 // Image/surface handling Functions
 // -----------------------------------------------------------------------
 
+// Raw image arrays (GSLC_IMGREF_FMT_RAW16, GSLC_IMGREF_FMT_RAW24)
+// are described in GUIslice.h
 void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
 {
+  // Pointer to the surface image that was loaded
+  SDL_Surface*  pSurfLoaded = NULL;
+  // Indicate that the surface wraps the caller's pixels
+  bool          bWrapped = false;
+  const char*   pStrSrc = "";
 
   if (sImgRef.eImgFlags == GSLC_IMGREF_NONE) {
     return NULL;
+  } else if (gslc_DrvImageIsDirect(sImgRef)) {
+    // Decoded by gslc_DrvDrawImage() each time it is drawn
+    return NULL;
   } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_SD) {
     // Load image from SD card
     // TODO: Not yet supported
     return NULL;    
-  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_RAM) {
-    // Load image from RAM
-    // TODO: Not yet supported
-    return NULL;
-  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG) {
-    // Load image from FLASH
-    // TODO: Not yet supported
-    return NULL;
+  } else if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_RAM) ||
+             ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG)) {
+    // Load image from RAM or FLASH
+    // - Program memory is directly addressable on the SDL targets
+    const unsigned char* pImgBuf = sImgRef.pImgBuf;
+    pStrSrc = "mem";
+    if (pImgBuf == NULL) {
+      GSLC_DEBUG_PRINT("ERROR: DrvLoadImage(%s) NULL image buffer\n",pStrSrc);
+      return NULL;
+    }
+    if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RAW16) {
+      // Wrap the pixel array in a surface without copying it
+      // - SDL only reads from the pixels of a blit source
+      const uint16_t* pImgWords = (const uint16_t*)pImgBuf;
+      int nW = pImgWords[0];
+      int nH = pImgWords[1];
+      pSurfLoaded = SDL_CreateRGBSurfaceFrom((void*)(pImgWords+2),nW,nH,16,nW*2,
+        0xF800,0x07E0,0x001F,0x0000);
+      bWrapped = true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RAW24) {
+      // Wrap the pixel array in a surface without copying it
+      // - The pixels are stored as R,G,B bytes
+      int nW = (pImgBuf[0] << 8) | pImgBuf[1];
+      int nH = (pImgBuf[2] << 8) | pImgBuf[3];
+      #if (SDL_BYTEORDER == SDL_BIG_ENDIAN)
+      pSurfLoaded = SDL_CreateRGBSurfaceFrom((void*)(pImgBuf+4),nW,nH,24,nW*3,
+        0xFF0000,0x00FF00,0x0000FF,0x000000);
+      #else
+      pSurfLoaded = SDL_CreateRGBSurfaceFrom((void*)(pImgBuf+4),nW,nH,24,nW*3,
+        0x0000FF,0x00FF00,0xFF0000,0x000000);
+      #endif
+      bWrapped = true;
+    } else if (((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_BMP24) ||
+               ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_BMP16)) {
+      // Parse the BMP from memory
+      // - The file size is read from the BMP header
+      uint32_t nBmpSz = (uint32_t)pImgBuf[2] | ((uint32_t)pImgBuf[3] << 8) |
+        ((uint32_t)pImgBuf[4] << 16) | ((uint32_t)pImgBuf[5] << 24);
+      pSurfLoaded = SDL_LoadBMP_RW(SDL_RWFromConstMem(pImgBuf,(int)nBmpSz),1);
+    } else {
+      GSLC_DEBUG_PRINT("ERROR: DrvLoadImage(%s) unsupported format\n",pStrSrc);
+      return NULL;
+    }
   } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
     // Load image from file system
-    const char* pStrFname = sImgRef.pFname;
-    
-    // Pointer to the surface image that was loaded
-    SDL_Surface* pSurfLoaded = NULL;
+    pStrSrc = sImgRef.pFname;
 
     // Load the image
     // - The SDL_LoadBMP() routine should be able to handle a multitude of
     //   BMP format types.
     // - TODO: Check (eImgFlags & GSLC_IMGREF_FMT) to ensure type is supported
-    pSurfLoaded = SDL_LoadBMP(pStrFname);
+    pSurfLoaded = SDL_LoadBMP(pStrSrc);
+  } else {
+    // If reached here, it is an error
+    return NULL;
+  } // eImgFlags
 
-    // Confirm that the image loaded correctly
-    if (pSurfLoaded == NULL) {
-      GSLC_DEBUG_PRINT("ERROR: DrvLoadBmpFile(%s) failed: %s\n",pStrFname,SDL_GetError());
-      return NULL;
-    }
+  // Confirm that the image loaded correctly
+  if (pSurfLoaded == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: DrvLoadImage(%s) failed: %s\n",pStrSrc,SDL_GetError());
+    return NULL;
+  }
 
-    #if defined(DRV_DISP_SDL1)
+  #if defined(DRV_DISP_SDL1)
 
-    //Create an optimized surface
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_PixelFormat* pFmtScreen = pDriver->pSurfScreen->format;
+
+  //The optimized surface that will be used
+  SDL_Surface* pSurfOptimized = pSurfLoaded;
+
+  // A wrapped pixel array can only be used in place if it is already
+  // in the display's pixel format. Otherwise SDL would convert every
+  // pixel on each blit, so convert it once here instead.
+  if (bWrapped) {
+    SDL_PixelFormat* pFmtLoaded = pSurfLoaded->format;
+    if ((pFmtLoaded->BitsPerPixel != pFmtScreen->BitsPerPixel) ||
+        (pFmtLoaded->Rmask != pFmtScreen->Rmask) ||
+        (pFmtLoaded->Gmask != pFmtScreen->Gmask) ||
+        (pFmtLoaded->Bmask != pFmtScreen->Bmask)) {
+      bWrapped = false;
+    }
+  }
 
-    //The optimized surface that will be used
-    SDL_Surface* pSurfOptimized = SDL_DisplayFormat( pSurfLoaded );
+  // Create an optimized surface
+  // - This doesn't release the pixels of a wrapped array
+  if (!bWrapped) {
+    pSurfOptimized = SDL_DisplayFormat( pSurfLoaded );
 
     //Free the old surface
     SDL_FreeSurface( pSurfLoaded );
+  }
 
-    //If the surface was optimized
-    if( pSurfOptimized != NULL ) {
-
-      // Support optional transparency
-      if (GSLC_BMP_TRANS_EN) {
-        // Color key surface
-        // - Use transparency color key defined in BMP_TRANS_RGB
-        SDL_SetColorKey( pSurfOptimized, SDL_SRCCOLORKEY,
-          SDL_MapRGB( pSurfOptimized->format, GSLC_BMP_TRANS_RGB ) );
-      } // GSLC_BMP_TRANS_EN
-    } 
-
-    //Return the optimized surface
-    return (void*)(pSurfOptimized);
-
-    #endif
+  //If the surface was optimized
+  if( pSurfOptimized != NULL ) {
 
-    #if defined(DRV_DISP_SDL2)
-    gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver); 
-    SDL_Texture*  pTex = NULL;
-
-    if( pSurfLoaded != NULL ) {
+    // Support optional transparency
+    if (GSLC_BMP_TRANS_EN) {
+      // Color key surface
+      // - Use transparency color key defined in BMP_TRANS_RGB
+      SDL_SetColorKey( pSurfOptimized, SDL_SRCCOLORKEY,
+        SDL_MapRGB( pSurfOptimized->format, GSLC_BMP_TRANS_RGB ) );
+    } // GSLC_BMP_TRANS_EN
+  } 
 
-      // Support optional transparency
-      if (GSLC_BMP_TRANS_EN) {
-        // Color key surface
-        // - Use transparency color key defined in BMP_TRANS_RGB
-        // - SDL2 passes SDL_TRUE instead of SDL_SRCCOLORKEY
-        SDL_SetColorKey( pSurfLoaded, SDL_TRUE,
-          SDL_MapRGB( pSurfLoaded->format, GSLC_BMP_TRANS_RGB ) );
-      } // GSLC_BMP_TRANS_EN
-    } 
+  //Return the optimized surface
+  return (void*)(pSurfOptimized);
 
-    pTex = (void*)SDL_CreateTextureFromSurface(pDriver->pRender,pSurfLoaded);
-    if (pTex == NULL) {
-      GSLC_DEBUG_PRINT("ERROR: DrvLoadBmp(%s) SDL_CreateTextureFromSurface() failed: %s\n",pStrFname,SDL_GetError());
-      return NULL;    
-    }  
+  #endif
 
-    // Dispose of surface
-    SDL_FreeSurface(pSurfLoaded);
-    pSurfLoaded = NULL;  
+  #if defined(DRV_DISP_SDL2)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver); 
+  SDL_Texture*  pTex = NULL;
+  (void)bWrapped;  /* Textures always hold their own copy of the pixels */
+
+  // Support optional transparency
+  if (GSLC_BMP_TRANS_EN) {
+    // Color key surface
+    // - Use transparency color key defined in BMP_TRANS_RGB
+    // - SDL2 passes SDL_TRUE instead of SDL_SRCCOLORKEY
+    SDL_SetColorKey( pSurfLoaded, SDL_TRUE,
+      SDL_MapRGB( pSurfLoaded->format, GSLC_BMP_TRANS_RGB ) );
+  } // GSLC_BMP_TRANS_EN
+
+  // Upload the pixels to a texture
+  // - A wrapped pixel array is read directly by the upload
+  pTex = SDL_CreateTextureFromSurface(pDriver->pRender,pSurfLoaded);
+
+  // Dispose of surface
+  // - This doesn't release the pixels of a wrapped array
+  SDL_FreeSurface(pSurfLoaded);
+  pSurfLoaded = NULL;  
 
-    //Return the texture
-    return (void*)pTex;
+  if (pTex == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: DrvLoadImage(%s) SDL_CreateTextureFromSurface() failed: %s\n",pStrSrc,SDL_GetError());
+    return NULL;    
+  }  
 
-    #endif      
+  //Return the texture
+  return (void*)pTex;
 
-  } // eImgFlags
-  
-  // If reached here, it is an error
-  return NULL;
+  #endif      
 }
 
 
@@ -309,16 +442,28 @@ bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
 {
   // Dispose of previous background
   if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
-    gslc_DrvImageDestruct(pGui->sImgRefBkgnd.pvImgRaw);
+    gslc_ImgCacheRelease(pGui,pGui->sImgRefBkgnd.pvImgRaw);
     pGui->sImgRefBkgnd = gslc_ResetImage();
   }
 
+  // The background is restored by region from its surface, so
+  // images that are drawn directly can't be used
+  if (gslc_DrvImageIsDirect(sImgRef)) {
+    GSLC_DEBUG_PRINT("ERROR: DrvSetBkgndImage(%s) format unsupported for background\n","");
+    return false;
+  }
+
   pGui->sImgRefBkgnd = sImgRef;
-  pGui->sImgRefBkgnd.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  pGui->sImgRefBkgnd.pvImgRaw = gslc_ImgCacheAcquire(pGui,sImgRef);
   if (pGui->sImgRefBkgnd.pvImgRaw == NULL) {
     GSLC_DEBUG_PRINT("ERROR: DrvSetBkgndImage(%s) failed\n","");
     return false;
   }      
+
+  // NOTE: On SDL1 the image is always held in the display's pixel
+  //       format (see gslc_DrvLoadImage), including raw arrays, so
+  //       restoring a region of the background doesn't require a
+  //       format conversion
   
   return true;
 }
@@ -328,10 +473,14 @@ bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
   
   // Dispose of previous background
   if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
-    gslc_DrvImageDestruct(pGui->sImgRefBkgnd.pvImgRaw);
+    gslc_ImgCacheRelease(pGui,pGui->sImgRefBkgnd.pvImgRaw);
     pGui->sImgRefBkgnd = gslc_ResetImage();
   }
   
+  // Save the color so that regions can be restored with a fill
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nColBkgnd = nCol;
+
   SDL_Surface* pSurfBkgnd = NULL;
   
   uint16_t nScreenW = pGui->nDispW;
@@ -344,7 +493,6 @@ bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
   pSurfBkgnd = SDL_CreateRGBSurface(SDL_SWSURFACE,nScreenW,nScreenH,nBpp,0,0,0,0);
 #endif
 #if defined(DRV_DISP_SDL2)
-  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);  
   // - In SDL2, the flags field is ignored, so set to 0
   pSurfBkgnd = SDL_CreateRGBSurface(0,nScreenW,nScreenH,nBpp,0,0,0,0);  
 #endif
@@ -386,7 +534,10 @@ bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
   }
   
   pElem->sImgRefNorm = sImgRef;
-  pElem->sImgRefNorm.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (gslc_DrvImageIsDirect(sImgRef)) {
+    return true;
+  }
+  pElem->sImgRefNorm.pvImgRaw = gslc_ImgCacheAcquire(pGui,sImgRef);
   if (pElem->sImgRefNorm.pvImgRaw == NULL) {
     GSLC_DEBUG_PRINT("ERROR: DrvSetElemImageNorm(%s) failed\n","");
     return false;
@@ -403,7 +554,10 @@ bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
   }
 
   pElem->sImgRefGlow = sImgRef;
-  pElem->sImgRefGlow.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (gslc_DrvImageIsDirect(sImgRef)) {
+    return true;
+  }
+  pElem->sImgRefGlow.pvImgRaw = gslc_ImgCacheAcquire(pGui,sImgRef);
   if (pElem->sImgRefGlow.pvImgRaw == NULL) {
     GSLC_DEBUG_PRINT("ERROR: DrvSetElemImageGlow(%s) failed\n","");
     return false;
@@ -412,6 +566,30 @@ bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 }
 
 
+uint32_t gslc_DrvGetImageBytes(gslc_tsGui* pGui,void* pvImg)
+{
+  if (pvImg == NULL) {
+    return 0;
+  }
+  #if defined(DRV_DISP_SDL1)
+  SDL_Surface* pSurf = (SDL_Surface*)pvImg;
+  if (pSurf->flags & SDL_PREALLOC) {
+    // Wrapped pixel arrays don't hold any memory of their own
+    return 0;
+  }
+  return (uint32_t)pSurf->pitch * pSurf->h;
+  #endif
+  #if defined(DRV_DISP_SDL2)
+  // Textures are assumed to be held at 32 bits per pixel
+  int nW,nH;
+  if (SDL_QueryTexture((SDL_Texture*)pvImg,NULL,NULL,&nW,&nH) != 0) {
+    return 0;
+  }
+  return (uint32_t)nW * nH * 4;
+  #endif
+}
+
+
 void gslc_DrvImageDestruct(void* pvImg)
 {
   if (pvImg == NULL) {
@@ -436,6 +614,8 @@ bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
     SDL_Rect  rSRect = gslc_DrvAdaptRect(*pRect);
     SDL_SetClipRect(pScreen,&rSRect);
   }
+  // Keep the rasterizer clipping in sync with the surface
+  gslc_RasterSetClip(&pDriver->sRaster,pRect);
   return true;
 #endif
   
@@ -473,7 +653,15 @@ void gslc_DrvFontsDestruct(gslc_tsGui* pGui)
 {
   uint16_t  nFontInd;
   TTF_Font* pFont = NULL;
+#if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+  // Release the glyph atlases while their fonts and renderer still exist
+  gslc_DrvGlyphCacheReset(pGui);
+#endif
   for (nFontInd=0;nFontInd<pGui->nFontCnt;nFontInd++) {
+    // Bitmap fonts are owned by the user
+    if (pGui->asFont[nFontInd].eFontRefType != GSLC_FONTREF_FNAME) {
+      continue;
+    }
     if (pGui->asFont[nFontInd].pvFont != NULL) {
       pFont = (TTF_Font*)(pGui->asFont[nFontInd].pvFont);
       TTF_CloseFont(pFont);
@@ -509,6 +697,57 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
   gslc_tsDriver*  pDriver   = (gslc_tsDriver*)(pGui->pvDriver);
   SDL_Surface*    pSurfTxt  = NULL;
   TTF_Font*       pDrvFont  = (TTF_Font*)(pFont->pvFont);
+
+#if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+  // Compose the string from cached glyphs if all of its
+  // characters are held in the glyph atlas
+  // - Kerning between glyph pairs isn't applied
+  // - The first glyph positions the pen, so an empty string must
+  //   never reach the atlas (an empty string passes the loop below)
+  gslc_tsDrvGlyphAtlas* pAtlas = NULL;
+  const char*     pChar;
+  for (pChar=pStr;*pChar!='\0';pChar++) {
+    if (((uint8_t)*pChar < DRV_SDL_GLYPH_FIRST) || ((uint8_t)*pChar > DRV_SDL_GLYPH_LAST)) {
+      break;
+    }
+  }
+  if ((*pChar == '\0') && (pChar != pStr)) {
+    pAtlas = gslc_DrvGlyphAtlasGet(pGui,pDrvFont,colTxt);
+  } else {
+    pDriver->nGlyphMiss++;
+  }
+  if (pAtlas != NULL) {
+    // Position the pen so that the first glyph starts at nTxtX,
+    // matching the placement of a string rendered by SDL_ttf
+    uint8_t   nInd  = (uint8_t)pStr[0] - DRV_SDL_GLYPH_FIRST;
+    int16_t   nPenX = nTxtX - pAtlas->anOffsetX[nInd];
+    int16_t   nMinX = nTxtX;
+    int16_t   nMaxX = nTxtX;
+    SDL_Rect  rSrc;
+    SDL_Rect  rDst;
+    for (pChar=pStr;*pChar!='\0';pChar++) {
+      nInd  = (uint8_t)*pChar - DRV_SDL_GLYPH_FIRST;
+      rSrc  = pAtlas->asGlyph[nInd];
+      rDst  = (SDL_Rect){nPenX + pAtlas->anOffsetX[nInd],nTxtY,rSrc.w,rSrc.h};
+      if (rDst.x < nMinX) { nMinX = rDst.x; }
+      if (rDst.x + rSrc.w > nMaxX) { nMaxX = rDst.x + rSrc.w; }
+      #if defined(DRV_DISP_SDL1)
+      SDL_BlitSurface(pAtlas->pSurf,&rSrc,pDriver->pSurfScreen,&rDst);
+      #endif
+      #if defined(DRV_DISP_SDL2)
+      SDL_RenderCopy(pDriver->pRender,pAtlas->pTex,&rSrc,&rDst);
+      #endif
+      nPenX += pAtlas->anAdvance[nInd];
+    }
+    #if defined(DRV_DISP_SDL1)
+    gslc_DrvUpdateRectAdd(pGui,(gslc_tsRect){nMinX,nTxtY,nMaxX-nMinX,pAtlas->asGlyph[0].h});
+    #endif
+    return true;
+  }
+#else
+  pDriver->nGlyphMiss++;
+#endif // DRV_SDL_GLYPH_ATLAS_MAX
+
   pSurfTxt = TTF_RenderText_Solid(pDrvFont,pStr,gslc_DrvAdaptColor(colTxt));
   if (pSurfTxt == NULL) {
     GSLC_DEBUG_PRINT("ERROR: DrvDrawTxt() failed in TTF_RenderText_Solid() (%s)\n",pStr);
@@ -518,6 +757,7 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
 
 #if defined(DRV_DISP_SDL1)
   gslc_DrvPasteSurface(pGui,nTxtX,nTxtY,pSurfTxt,pDriver->pSurfScreen);
+  gslc_DrvUpdateRectAdd(pGui,(gslc_tsRect){nTxtX,nTxtY,pSurfTxt->w,pSurfTxt->h});
 #endif
 #if defined(DRV_DISP_SDL2)
   SDL_Rect rRect = (SDL_Rect){nTxtX,nTxtY,pSurfTxt->w,pSurfTxt->h};
@@ -545,6 +785,13 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
   return true;
 }
 
+void gslc_DrvGetGlyphCacheStats(gslc_tsGui* pGui,uint32_t* pnHit,uint32_t* pnMiss)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  *pnHit  = pDriver->nGlyphHit;
+  *pnMiss = pDriver->nGlyphMiss;
+}
+
 
 // -----------------------------------------------------------------------
 // Screen Management Functions
@@ -555,11 +802,38 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
 #if defined(DRV_DISP_SDL1)  
   SDL_Surface*   pScreen = pDriver->pSurfScreen;  
-  SDL_Flip(pScreen);
+  uint8_t        nInd;
+  // - The areas are summed in 64 bits so that the percentage
+  //   comparison can't wrap on large screens
+  uint64_t       nUpdateArea = 0;
+  uint64_t       nScreenArea = (uint64_t)pScreen->w * pScreen->h;
+  for (nInd=0;nInd<pDriver->nUpdateRectCnt;nInd++) {
+    nUpdateArea += (uint64_t)pDriver->asUpdateRect[nInd].w * pDriver->asUpdateRect[nInd].h;
+  }
+  // Only update the regions that were drawn, unless they
+  // cover enough of the screen that a full flip is cheaper
+  if (nUpdateArea*100 >= nScreenArea*DRV_SDL_UPDATE_FULL_PCT) {
+    SDL_Flip(pScreen);
+  } else if (pDriver->nUpdateRectCnt > 0) {
+    SDL_Rect  asSRect[DRV_SDL_UPDATE_RECT_MAX];
+    for (nInd=0;nInd<pDriver->nUpdateRectCnt;nInd++) {
+      asSRect[nInd] = gslc_DrvAdaptRect(pDriver->asUpdateRect[nInd]);
+    }
+    SDL_UpdateRects(pScreen,pDriver->nUpdateRectCnt,asSRect);
+  }
+  pDriver->nUpdateRectCnt = 0;
 #endif
 #if defined(DRV_DISP_SDL2)
   SDL_Renderer* pRender = pDriver->pRender;
-  if (pRender) {
+  if (pRender && pDriver->pTexTarget) {
+    // Copy the persistent render target into the backbuffer
+    // and display it. The render target retains its content
+    // so no clear is required before the next drawing.
+    SDL_SetRenderTarget(pRender,NULL);
+    SDL_RenderCopy(pRender,pDriver->pTexTarget,NULL,NULL);
+    SDL_RenderPresent(pRender);
+    SDL_SetRenderTarget(pRender,pDriver->pTexTarget);
+  } else if (pRender) {
     // Flip the offscreen buffer so we can display our drawing output
     SDL_RenderPresent(pRender);
     // Clear the drawing before any new drawing occurs
@@ -578,11 +852,12 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
 bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 {
 #if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   if (gslc_DrvScreenLock(pGui)) {
-    uint32_t nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);    
-    gslc_DrvDrawSetPixelRaw(pGui,nX,nY,nColRaw);
+    gslc_RasterSetPixel(&pDriver->sRaster,nX,nY,gslc_DrvAdaptColorRaw(pGui,nCol));
     gslc_DrvScreenUnlock(pGui);
   }
+  gslc_DrvUpdateRectAdd(pGui,(gslc_tsRect){nX,nY,1,1});
 #endif
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
@@ -599,14 +874,27 @@ bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
 {
 #if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   uint16_t nIndPt;
+  if (nNumPt == 0) {
+    return true;
+  }
+  int16_t  nMinX = asPt[0].x;
+  int16_t  nMinY = asPt[0].y;
+  int16_t  nMaxX = nMinX;
+  int16_t  nMaxY = nMinY;
   if (gslc_DrvScreenLock(pGui)) {
-    uint32_t nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
-    for (nIndPt=0;nIndPt<nNumPt;nIndPt++) {
-      gslc_DrvDrawSetPixelRaw(pGui,asPt[nIndPt].x,asPt[nIndPt].y,nColRaw);
-    }
+    gslc_RasterPoints(&pDriver->sRaster,asPt,nNumPt,gslc_DrvAdaptColorRaw(pGui,nCol));
     gslc_DrvScreenUnlock(pGui);
   }
+  // Track the bounding box of the points for the screen update
+  for (nIndPt=1;nIndPt<nNumPt;nIndPt++) {
+    if (asPt[nIndPt].x < nMinX) { nMinX = asPt[nIndPt].x; }
+    if (asPt[nIndPt].x > nMaxX) { nMaxX = asPt[nIndPt].x; }
+    if (asPt[nIndPt].y < nMinY) { nMinY = asPt[nIndPt].y; }
+    if (asPt[nIndPt].y > nMaxY) { nMaxY = asPt[nIndPt].y; }
+  }
+  gslc_DrvUpdateRectAdd(pGui,(gslc_tsRect){nMinX,nMinY,nMaxX-nMinX+1,nMaxY-nMinY+1});
 #endif
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
@@ -626,13 +914,11 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 {
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
 #if defined(DRV_DISP_SDL1)
-  // Typecast
-  SDL_Rect      rSRect  = gslc_DrvAdaptRect(rRect);  
-  SDL_Surface*  pScreen = pDriver->pSurfScreen;
-  
-  // Call SDL optimized routine
-  SDL_FillRect(pScreen,&rSRect,
-    SDL_MapRGB(pScreen->format,nCol.r,nCol.g,nCol.b)); 
+  if (gslc_DrvScreenLock(pGui)) {
+    gslc_RasterFillRect(&pDriver->sRaster,rRect,gslc_DrvAdaptColorRaw(pGui,nCol));
+    gslc_DrvScreenUnlock(pGui);
+  }
+  gslc_DrvUpdateRectAdd(pGui,rRect);
 #endif
 #if defined(DRV_DISP_SDL2)
   SDL_Renderer* pRender = pDriver->pRender;    
@@ -649,7 +935,13 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 {
 #if defined(DRV_DISP_SDL1)
-  return false;
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (gslc_DrvScreenLock(pGui)) {
+    gslc_RasterFrameRect(&pDriver->sRaster,rRect,gslc_DrvAdaptColorRaw(pGui,nCol));
+    gslc_DrvScreenUnlock(pGui);
+  }
+  gslc_DrvUpdateRectAdd(pGui,rRect);
+  return true;
 #endif
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
@@ -668,8 +960,18 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
 {
 #if defined(DRV_DISP_SDL1)
-  // ERROR
-  return false;
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (gslc_DrvScreenLock(pGui)) {
+    gslc_RasterLine(&pDriver->sRaster,nX0,nY0,nX1,nY1,gslc_DrvAdaptColorRaw(pGui,nCol));
+    gslc_DrvScreenUnlock(pGui);
+  }
+  gslc_tsRect rBound;
+  rBound.x = (nX0 < nX1)? nX0 : nX1;
+  rBound.y = (nY0 < nY1)? nY0 : nY1;
+  rBound.w = abs(nX1-nX0)+1;
+  rBound.h = abs(nY1-nY0)+1;
+  gslc_DrvUpdateRectAdd(pGui,rBound);
+  return true;
 #endif
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
@@ -682,15 +984,208 @@ bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16
 #endif  
 }
 
+bool gslc_DrvDrawLineH(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nW,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+#if defined(DRV_DISP_SDL1)
+  if (gslc_DrvScreenLock(pGui)) {
+    gslc_RasterFillSpan(&pDriver->sRaster,nX,nY,nW,gslc_DrvAdaptColorRaw(pGui,nCol));
+    gslc_DrvScreenUnlock(pGui);
+  }
+  gslc_DrvUpdateRectAdd(pGui,(gslc_tsRect){nX,nY,nW,1});
+#endif
+#if defined(DRV_DISP_SDL2)
+  SDL_Renderer* pRender = pDriver->pRender;
+  SDL_SetRenderDrawColor(pRender,nCol.r,nCol.g,nCol.b,255);
+  SDL_Rect rRectSdl = gslc_DrvAdaptRect((gslc_tsRect){nX,nY,nW,1});
+  SDL_RenderFillRect(pRender,&rRectSdl);
+#endif
+  return true;
+}
+
+bool gslc_DrvDrawLineV(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nH,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+#if defined(DRV_DISP_SDL1)
+  if (gslc_DrvScreenLock(pGui)) {
+    gslc_RasterFillRect(&pDriver->sRaster,(gslc_tsRect){nX,nY,1,nH},gslc_DrvAdaptColorRaw(pGui,nCol));
+    gslc_DrvScreenUnlock(pGui);
+  }
+  gslc_DrvUpdateRectAdd(pGui,(gslc_tsRect){nX,nY,1,nH});
+#endif
+#if defined(DRV_DISP_SDL2)
+  SDL_Renderer* pRender = pDriver->pRender;
+  SDL_SetRenderDrawColor(pRender,nCol.r,nCol.g,nCol.b,255);
+  SDL_Rect rRectSdl = gslc_DrvAdaptRect((gslc_tsRect){nX,nY,1,nH});
+  SDL_RenderFillRect(pRender,&rRectSdl);
+#endif
+  return true;
+}
+
+bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (gslc_DrvScreenLock(pGui)) {
+    gslc_RasterFrameCircle(&pDriver->sRaster,nMidX,nMidY,nRadius,gslc_DrvAdaptColorRaw(pGui,nCol));
+    gslc_DrvScreenUnlock(pGui);
+  }
+  gslc_DrvUpdateRectAdd(pGui,(gslc_tsRect){nMidX-nRadius,nMidY-nRadius,2*nRadius+1,2*nRadius+1});
+  return true;
+#endif
+#if defined(DRV_DISP_SDL2)
+  // Not supported by the SDL2 renderer, so the core emulation is used
+  return false;
+#endif
+}
+
+bool gslc_DrvDrawLineAA(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_RasterCanBlend(&pDriver->sRaster)) {
+    return false;
+  }
+  if (gslc_DrvScreenLock(pGui)) {
+    gslc_RasterLineAA(&pDriver->sRaster,nX0,nY0,nX1,nY1,gslc_DrvAdaptColorRaw(pGui,nCol));
+    gslc_DrvScreenUnlock(pGui);
+  }
+  // Include the pixels blended beside the line
+  gslc_tsRect rBound;
+  rBound.x = ((nX0 < nX1)? nX0 : nX1) - 1;
+  rBound.y = ((nY0 < nY1)? nY0 : nY1) - 1;
+  rBound.w = abs(nX1-nX0)+3;
+  rBound.h = abs(nY1-nY0)+3;
+  gslc_DrvUpdateRectAdd(pGui,rBound);
+  return true;
+#endif
+#if defined(DRV_DISP_SDL2)
+  // The renderer doesn't expose its pixels, so the core
+  // draws an aliased line instead
+  return false;
+#endif
+}
+
+bool gslc_DrvDrawFrameCircleAA(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_RasterCanBlend(&pDriver->sRaster)) {
+    return false;
+  }
+  if (gslc_DrvScreenLock(pGui)) {
+    gslc_RasterFrameCircleAA(&pDriver->sRaster,nMidX,nMidY,nRadius,gslc_DrvAdaptColorRaw(pGui,nCol));
+    gslc_DrvScreenUnlock(pGui);
+  }
+  gslc_DrvUpdateRectAdd(pGui,(gslc_tsRect){nMidX-nRadius-1,nMidY-nRadius-1,2*nRadius+3,2*nRadius+3});
+  return true;
+#endif
+#if defined(DRV_DISP_SDL2)
+  // The renderer doesn't expose its pixels, so the core
+  // draws an aliased circle instead
+  return false;
+#endif
+}
+
+bool gslc_DrvDrawFillRectAlpha(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+#if defined(DRV_DISP_SDL1)
+  if (!gslc_RasterCanBlend(&pDriver->sRaster)) {
+    return false;
+  }
+  if (gslc_DrvScreenLock(pGui)) {
+    gslc_RasterFillRectAlpha(&pDriver->sRaster,rRect,gslc_DrvAdaptColorRaw(pGui,nCol),255-nCol.transp);
+    gslc_DrvScreenUnlock(pGui);
+  }
+  gslc_DrvUpdateRectAdd(pGui,rRect);
+#endif
+#if defined(DRV_DISP_SDL2)
+  // Let the renderer blend the fill, then restore the
+  // default (opaque) mode for the other primitives
+  SDL_Renderer* pRender = pDriver->pRender;
+  SDL_Rect      rRectSdl = gslc_DrvAdaptRect(rRect);
+  SDL_SetRenderDrawBlendMode(pRender,SDL_BLENDMODE_BLEND);
+  SDL_SetRenderDrawColor(pRender,nCol.r,nCol.g,nCol.b,255-nCol.transp);
+  SDL_RenderFillRect(pRender,&rRectSdl);
+  SDL_SetRenderDrawBlendMode(pRender,SDL_BLENDMODE_NONE);
+#endif
+  return true;
+}
+
+uint32_t gslc_DrvCopyRectSize(gslc_tsGui* pGui,uint16_t nW,uint16_t nH)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return (uint32_t)gslc_RasterRowBytes(&pDriver->sRaster,nW) * nH;
+#endif
+#if defined(DRV_DISP_SDL2)
+  // Not supported by driver (DRV_HAS_COPY_RECT=0)
+  return 0;
+#endif
+}
+
+bool gslc_DrvCopyRectOut(gslc_tsGui* pGui,gslc_tsRect rRect,uint8_t* pBuf)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  bool           bOk     = false;
+  if (gslc_DrvScreenLock(pGui)) {
+    bOk = gslc_RasterCopyOut(&pDriver->sRaster,rRect,pBuf);
+    gslc_DrvScreenUnlock(pGui);
+  }
+  return bOk;
+#endif
+#if defined(DRV_DISP_SDL2)
+  // Not supported by driver (DRV_HAS_COPY_RECT=0)
+  return false;
+#endif
+}
+
+bool gslc_DrvCopyRectIn(gslc_tsGui* pGui,gslc_tsRect rRect,const uint8_t* pBuf)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRaster* pRaster = &pDriver->sRaster;
+  if (!gslc_DrvScreenLock(pGui)) {
+    return false;
+  }
+  gslc_RasterBlit(pRaster,rRect.x,rRect.y,pBuf,gslc_RasterRowBytes(pRaster,rRect.w),rRect.w,rRect.h);
+  gslc_DrvScreenUnlock(pGui);
+  gslc_DrvUpdateRectAdd(pGui,rRect);
+  return true;
+#endif
+#if defined(DRV_DISP_SDL2)
+  // Not supported by driver (DRV_HAS_COPY_RECT=0)
+  return false;
+#endif
+}
+
 bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef)
 {
   if (pGui == NULL) {
     GSLC_DEBUG_PRINT("ERROR: DrvDrawImage(%s) with NULL ptr\n","");
     return false;
   }
+  // Run-length encoded and monochrome arrays are decoded here
+  // - The spans are drawn through the driver primitives, which
+  //   also record the SDL1 update regions
+  if (gslc_DrvImageIsDirect(sImgRef)) {
+    switch (sImgRef.eImgFlags & GSLC_IMGREF_FMT) {
+      case GSLC_IMGREF_FMT_RAW1:
+        gslc_DrvDrawMonoFromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf);
+        return true;
+      default:
+        return gslc_ImgRleDraw(pGui,nDstX,nDstY,sImgRef.pImgBuf,
+          ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG),
+          ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE8));
+    }
+  }
+
   // GUIslice adapter library for SDL always pre-loads
-  // surfaces / textures before calling DrvDrawImage(), so
-  // we just need to confirm that the raw image data is defined.
+  // surfaces / textures for the other formats before calling
+  // DrvDrawImage(), so we just need to confirm that the raw
+  // image data is defined.
   void* pImage = sImgRef.pvImgRaw;
   if (pImage == NULL) {
     GSLC_DEBUG_PRINT("ERROR: DrvDrawImage(%s) with NULL pvImgRaw\n","");
@@ -700,7 +1195,9 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   
 #if defined(DRV_DISP_SDL1)
+  SDL_Surface*  pSurf = (SDL_Surface*)pImage;
   gslc_DrvPasteSurface(pGui,nDstX,nDstY,pImage,pDriver->pSurfScreen);
+  gslc_DrvUpdateRectAdd(pGui,(gslc_tsRect){nDstX,nDstY,pSurf->w,pSurf->h});
 #endif
 
 #if defined(DRV_DISP_SDL2)  
@@ -721,6 +1218,62 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
 }
 
 
+bool gslc_DrvImageIsDirect(gslc_tsImgRef sImgRef)
+{
+  if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) != GSLC_IMGREF_SRC_RAM) &&
+      ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) != GSLC_IMGREF_SRC_PROG)) {
+    return false;
+  }
+  switch (sImgRef.eImgFlags & GSLC_IMGREF_FMT) {
+    case GSLC_IMGREF_FMT_RAW1:
+    case GSLC_IMGREF_FMT_RLE16:
+    case GSLC_IMGREF_FMT_RLE8:
+      return (sImgRef.pImgBuf != NULL);
+    default:
+      return false;
+  }
+}
+
+
+// Image array format (GSLC_IMGREF_FMT_RAW1):
+// - Width[15:8],  Width[7:0],
+// - Height[15:8], Height[7:0],
+// - ColorR[7:0],  ColorG[7:0],
+// - ColorB[7:0],  0x00,
+// - Monochrome bitmap follows (unset bits are transparent)
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,const unsigned char* pBitmap)
+{
+  int16_t         nW,nH,nX,nY,nRunX;
+  int16_t         nByteW;
+  gslc_tsColor    nCol;
+  const unsigned char* pRow;
+
+  nW      = (pBitmap[0] << 8) | pBitmap[1];
+  nH      = (pBitmap[2] << 8) | pBitmap[3];
+  nCol.r  = pBitmap[4];
+  nCol.g  = pBitmap[5];
+  nCol.b  = pBitmap[6];
+  pBitmap += 8;
+
+  nByteW = (nW + 7) / 8;
+  for (nY=0;nY<nH;nY++) {
+    pRow = pBitmap + nY*nByteW;
+    nX = 0;
+    while (nX < nW) {
+      if (!(pRow[nX/8] & (0x80 >> (nX%8)))) {
+        nX++;
+        continue;
+      }
+      nRunX = nX;
+      while ((nX < nW) && (pRow[nX/8] & (0x80 >> (nX%8)))) {
+        nX++;
+      }
+      gslc_DrawSpanH(pGui,nDstX+nRunX,nDstY+nY,nX-nRunX,nCol);
+    }
+  }
+}
+
+
 /// NOTE: Background image is stored in pGui->sImgRefBkgnd
 void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
 {
@@ -741,6 +1294,7 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
   
 #if defined(DRV_DISP_SDL1)
   gslc_DrvPasteSurface(pGui,0,0,pGui->sImgRefBkgnd.pvImgRaw,pDriver->pSurfScreen);
+  gslc_DrvUpdateRectAdd(pGui,(gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH});
 #endif
 
 #if defined(DRV_DISP_SDL2)  
@@ -767,6 +1321,59 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
   
 }
 
+void gslc_DrvDrawBkgndRect(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: DrvDrawBkgndRect(%s) with NULL ptr\n","");
+    return;
+  }
+  void* pImage = pGui->sImgRefBkgnd.pvImgRaw;
+  if (pImage == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: DrvDrawBkgndRect(%s) with NULL pvImgRaw\n","");
+    return;
+  }
+
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  // A background assigned by DrvSetBkgndColor() has no image
+  // reference, so the region can be filled directly
+  if (pGui->sImgRefBkgnd.eImgFlags == GSLC_IMGREF_NONE) {
+    gslc_DrvDrawFillRect(pGui,rRect,pDriver->nColBkgnd);
+    return;
+  }
+
+#if defined(DRV_DISP_SDL1)
+  // The background surface is the same size as the screen,
+  // so the source and destination regions coincide
+  SDL_Rect  rSrc = gslc_DrvAdaptRect(rRect);
+  SDL_Rect  rDest = rSrc;
+  SDL_BlitSurface((SDL_Surface*)pImage,&rSrc,pDriver->pSurfScreen,&rDest);
+  gslc_DrvUpdateRectAdd(pGui,rRect);
+#endif
+
+#if defined(DRV_DISP_SDL2)
+  SDL_Renderer* pRender = pDriver->pRender;
+  SDL_Texture*  pTex    = (SDL_Texture*)(pImage);
+
+  // DrvDrawBkgnd() scales the texture to the viewport, so map
+  // the screen region back into the texture's coordinates
+  SDL_Rect  rView;
+  int       nTexW,nTexH;
+  SDL_RenderGetViewport(pRender,&rView);
+  SDL_QueryTexture(pTex,NULL,NULL,&nTexW,&nTexH);
+  if ((rView.w == 0) || (rView.h == 0)) {
+    return;
+  }
+  SDL_Rect  rDest = gslc_DrvAdaptRect(rRect);
+  SDL_Rect  rSrc;
+  rSrc.x = rDest.x * nTexW / rView.w;
+  rSrc.y = rDest.y * nTexH / rView.h;
+  rSrc.w = rDest.w * nTexW / rView.w;
+  rSrc.h = rDest.h * nTexH / rView.h;
+  SDL_RenderCopy(pRender,pTex,&rSrc,&rDest);
+#endif
+}
+
 
 
 // ------------------------------------------------------------------------
@@ -944,7 +1551,15 @@ uint32_t gslc_DrvAdaptColorRaw(gslc_tsGui* pGui,gslc_tsColor nCol)
   }      
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   SDL_Surface*   pScreen = pDriver->pSurfScreen;
-  return SDL_MapRGB(pScreen->format,nCol.r,nCol.g,nCol.b);
+  uint32_t       nColRaw = SDL_MapRGB(pScreen->format,nCol.r,nCol.g,nCol.b);
+#if (SDL_BYTEORDER == SDL_BIG_ENDIAN)
+  // The rasterizer stores 24-bit pixels least significant byte
+  // first, whereas SDL stores them in big-endian order
+  if (pScreen->format->BytesPerPixel == 3) {
+    nColRaw = ((nColRaw & 0xFF) << 16) | (nColRaw & 0xFF00) | ((nColRaw >> 16) & 0xFF);
+  }
+#endif
+  return nColRaw;
 }
 
 
@@ -970,6 +1585,8 @@ bool gslc_DrvScreenLock(gslc_tsGui* pGui)
     }
   }   
 
+  // The pixel buffer is only guaranteed to be valid while locked
+  gslc_RasterSetBuf(&pDriver->sRaster,(uint8_t*)pScreen->pixels);
   return true;
 }
 
@@ -989,8 +1606,6 @@ void gslc_DrvScreenUnlock(gslc_tsGui* pGui)
 }
 
 
-// - Based on code from:
-// -   https://www.libsdl.org/release/SDL-1.2.15/docs/html/guidevideo.html
 uint32_t gslc_DrvDrawGetPixelRaw(gslc_tsGui* pGui, int16_t nX, int16_t nY)
 {
   if (pGui == NULL) {
@@ -1003,8 +1618,6 @@ uint32_t gslc_DrvDrawGetPixelRaw(gslc_tsGui* pGui, int16_t nX, int16_t nY)
     GSLC_DEBUG_PRINT("ERROR: DrvDrawGetPixelRaw(%s) screen surface NULL\n","");
     return 0;
   }      
-  int nBpp = pScreen->format->BytesPerPixel;
-
   // Handle any range violations for entire surface
   if ( (nX < 0) || (nX >= pScreen->w) ||
        (nY < 0) || (nY >= pScreen->h) ) {
@@ -1013,35 +1626,19 @@ uint32_t gslc_DrvDrawGetPixelRaw(gslc_tsGui* pGui, int16_t nX, int16_t nY)
     return 0;
   }
 
-  // Here pPixel is the address to the pixel we want to get
-  uint8_t *pPixel = (uint8_t *)pScreen->pixels + nY * pScreen->pitch + nX * nBpp;
-
-  switch(nBpp) {
-    case 1:
-      return *pPixel;
-  
-    case 2:
-      return *(uint16_t *)pPixel;
-  
-    case 3:
-      if (SDL_BYTEORDER == SDL_BIG_ENDIAN)
-        return pPixel[0] << 16 | pPixel[1] << 8 | pPixel[2];
-      else
-        return pPixel[0] | pPixel[1] << 8 | pPixel[2] << 16;
-  
-    case 4:
-      return *(uint32_t *)pPixel;
-  
-    default:
-      return 0;       // shouldn't happen, but avoids warnings
+  uint32_t nPixelVal = gslc_RasterGetPixel(&pDriver->sRaster,nX,nY);
+#if (SDL_BYTEORDER == SDL_BIG_ENDIAN)
+  // Return 24-bit pixels in the SDL byte order
+  if (pScreen->format->BytesPerPixel == 3) {
+    nPixelVal = ((nPixelVal & 0xFF) << 16) | (nPixelVal & 0xFF00) | ((nPixelVal >> 16) & 0xFF);
   }
-
+#endif
+  return nPixelVal;
 }
 
 
-// - Based on code from:
-// -   https://www.libsdl.org/release/SDL-1.2.15/docs/html/guidevideo.html
-// - Added range checks from surface clipping rect
+// - Range checks are performed against the surface clipping rect
+// - The pixel value must be produced by gslc_DrvAdaptColorRaw()
 void gslc_DrvDrawSetPixelRaw(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint32_t nPixelVal)
 {
   if (pGui == NULL) {
@@ -1049,48 +1646,11 @@ void gslc_DrvDrawSetPixelRaw(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint32_t n
     return;
   }
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
-  SDL_Surface*   pScreen = pDriver->pSurfScreen;
-  if (pScreen == NULL) {
+  if (pDriver->pSurfScreen == NULL) {
     GSLC_DEBUG_PRINT("ERROR: DrvDrawSetPixelRaw(%s) screen surface NULL\n","");
     return;
   }        
-  uint8_t nBpp = pScreen->format->BytesPerPixel;
-
-  // Handle any clipping
-  if ( (nX < pScreen->clip_rect.x) || (nX >= pScreen->clip_rect.x+pScreen->clip_rect.w) ||
-       (nY < pScreen->clip_rect.y) || (nY >= pScreen->clip_rect.y+pScreen->clip_rect.h) ) {
-    return;
-  }
-
-  // Here pPixel is the address to the pixel we want to set
-  uint8_t *pPixel = (uint8_t *)pScreen->pixels + nY * pScreen->pitch + nX * nBpp;
-
-  switch(nBpp) {
-    case 1:
-      *pPixel = nPixelVal;
-      break;
-
-    case 2:
-      *(uint16_t *)pPixel = nPixelVal;
-      break;
-
-    case 3:
-      if (SDL_BYTEORDER == SDL_BIG_ENDIAN) {
-        pPixel[0] = (nPixelVal >> 16) & 0xff;
-        pPixel[1] = (nPixelVal >> 8) & 0xff;
-        pPixel[2] = nPixelVal & 0xff;
-      } else {
-        pPixel[0] = nPixelVal & 0xff;
-        pPixel[1] = (nPixelVal >> 8) & 0xff;
-        pPixel[2] = (nPixelVal >> 16) & 0xff;
-      }
-      break;
-
-    case 4:
-      *(uint32_t *)pPixel = nPixelVal;
-      break;
-  }
-
+  gslc_RasterSetPixel(&pDriver->sRaster,nX,nY,nPixelVal);
 }
 
 void gslc_DrvPasteSurface(gslc_tsGui* pGui,int16_t nX, int16_t nY, void* pvSrc, void* pvDest)
@@ -1107,7 +1667,208 @@ void gslc_DrvPasteSurface(gslc_tsGui* pGui,int16_t nX, int16_t nY, void* pvSrc,
   SDL_BlitSurface(pSrc,NULL,pDest,&offset);
 }
 
+void gslc_DrvUpdateRectAdd(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*    pScreen = pDriver->pSurfScreen;
+  uint8_t         nInd;
+
+  // Drawing is limited to the clipping region, so only
+  // that portion of the screen can have changed
+  gslc_tsRect rClip = {pScreen->clip_rect.x,pScreen->clip_rect.y,
+                       pScreen->clip_rect.w,pScreen->clip_rect.h};
+  if ((rRect.w == 0) || (rRect.h == 0)) { return; }
+  if (!gslc_ClipRect(&rClip,&rRect)) { return; }
+
+  // Merge with a region that overlaps or touches the new one
+  // - Searching from the most recent region first since
+  //   consecutive draws (eg. points along a line) are usually
+  //   adjacent to each other
+  gslc_tsRect rTouch = gslc_ExpandRect(rRect,1,1);
+  for (nInd=pDriver->nUpdateRectCnt;nInd>0;nInd--) {
+    if (gslc_IsRectOverlap(rTouch,pDriver->asUpdateRect[nInd-1])) {
+      pDriver->asUpdateRect[nInd-1] = gslc_UnionRect(pDriver->asUpdateRect[nInd-1],rRect);
+      return;
+    }
+  }
+
+  if (pDriver->nUpdateRectCnt < DRV_SDL_UPDATE_RECT_MAX) {
+    pDriver->asUpdateRect[pDriver->nUpdateRectCnt] = rRect;
+    pDriver->nUpdateRectCnt++;
+    return;
+  }
+
+  // No free entries, so combine with the region that grows the least
+  uint8_t   nIndBest  = 0;
+  uint32_t  nGrowBest = 0xFFFFFFFF;
+  for (nInd=0;nInd<pDriver->nUpdateRectCnt;nInd++) {
+    gslc_tsRect rOld    = pDriver->asUpdateRect[nInd];
+    gslc_tsRect rUnion  = gslc_UnionRect(rOld,rRect);
+    uint32_t    nGrow   = (uint32_t)rUnion.w*rUnion.h - (uint32_t)rOld.w*rOld.h;
+    if (nGrow < nGrowBest) {
+      nGrowBest = nGrow;
+      nIndBest  = nInd;
+    }
+  }
+  pDriver->asUpdateRect[nIndBest] = gslc_UnionRect(pDriver->asUpdateRect[nIndBest],rRect);
+}
+
+#endif
+
+
+
+// -----------------------------------------------------------------------
+// Private Font Functions
+// -----------------------------------------------------------------------
+
+#if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+
+gslc_tsDrvGlyphAtlas* gslc_DrvGlyphAtlasGet(gslc_tsGui* pGui,TTF_Font* pFont,gslc_tsColor colTxt)
+{
+  gslc_tsDriver*        pDriver   = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvGlyphAtlas* pAtlas    = NULL;
+  uint8_t               nInd;
+  uint8_t               nIndEvict = 0;
+
+  pDriver->nGlyphUseCnt++;
+  for (nInd=0;nInd<DRV_SDL_GLYPH_ATLAS_MAX;nInd++) {
+    pAtlas = &pDriver->asGlyphAtlas[nInd];
+    if ((pAtlas->pFont == pFont) && gslc_ColorEqual(pAtlas->colTxt,colTxt)) {
+      pAtlas->nLastUse = pDriver->nGlyphUseCnt;
+      // An atlas without an image records glyphs that couldn't be cached
+      #if defined(DRV_DISP_SDL1)
+      if (pAtlas->pSurf == NULL) {
+      #else
+      if (pAtlas->pTex == NULL) {
+      #endif
+        pDriver->nGlyphMiss++;
+        return NULL;
+      }
+      pDriver->nGlyphHit++;
+      return pAtlas;
+    }
+    // Unused slots have never been used, so they are evicted first
+    if (pAtlas->nLastUse < pDriver->asGlyphAtlas[nIndEvict].nLastUse) {
+      nIndEvict = nInd;
+    }
+  }
+
+  // Not cached, so replace the least recently used atlas
+  pDriver->nGlyphMiss++;
+  pAtlas = &pDriver->asGlyphAtlas[nIndEvict];
+  gslc_DrvGlyphAtlasFree(pAtlas);
+  pAtlas->pFont     = pFont;
+  pAtlas->colTxt    = colTxt;
+  pAtlas->nLastUse  = pDriver->nGlyphUseCnt;
+  if (!gslc_DrvGlyphAtlasBuild(pGui,pAtlas,pFont,colTxt)) {
+    GSLC_DEBUG_PRINT("ERROR: DrvGlyphAtlasGet(%s) can't cache glyphs\n","");
+    return NULL;
+  }
+  return pAtlas;
+}
+
+bool gslc_DrvGlyphAtlasBuild(gslc_tsGui* pGui,gslc_tsDrvGlyphAtlas* pAtlas,TTF_Font* pFont,gslc_tsColor colTxt)
+{
+  char          acGlyph[2] = {0,0};
+  int           nGlyphW,nGlyphH;
+  int           nMinX,nMaxX,nMinY,nMaxY,nAdvance;
+  int16_t       nFontH    = TTF_FontHeight(pFont);
+  int16_t       nPackX    = 0;
+  int16_t       nPackY    = 0;
+  int16_t       nAtlasW   = 0;
+  uint8_t       nInd;
+
+  // Lay out the glyphs in rows of the atlas width
+  // - Each glyph region matches the surface that SDL_ttf renders for
+  //   the character alone, which places the glyph in the same way as
+  //   the first character of a string
+  for (nInd=0;nInd<DRV_SDL_GLYPH_CNT;nInd++) {
+    acGlyph[0] = DRV_SDL_GLYPH_FIRST + nInd;
+    if ((TTF_SizeText(pFont,acGlyph,&nGlyphW,&nGlyphH) != 0) ||
+        (TTF_GlyphMetrics(pFont,(uint16_t)acGlyph[0],&nMinX,&nMaxX,&nMinY,&nMaxY,&nAdvance) != 0)) {
+      return false;
+    }
+    if ((nPackX > 0) && (nPackX + nGlyphW > DRV_SDL_GLYPH_ATLAS_W)) {
+      nPackX  = 0;
+      nPackY += nFontH;
+    }
+    pAtlas->asGlyph[nInd]   = (SDL_Rect){nPackX,nPackY,nGlyphW,nFontH};
+    pAtlas->anOffsetX[nInd] = (nMinX < 0)? nMinX : 0;
+    pAtlas->anAdvance[nInd] = nAdvance;
+    nPackX += nGlyphW;
+    if (nPackX > nAtlasW) { nAtlasW = nPackX; }
+  }
+
+  // Render the glyphs onto a surface filled with a color key that
+  // can't match the text color
+  SDL_Surface*  pSurfAtlas;
+  SDL_Surface*  pSurfGlyph;
+  SDL_Rect      rDst;
+  uint32_t      nColKey;
+  pSurfAtlas = SDL_CreateRGBSurface(SDL_SWSURFACE,nAtlasW,nPackY+nFontH,32,
+    0x00FF0000,0x0000FF00,0x000000FF,0);
+  if (pSurfAtlas == NULL) {
+    return false;
+  }
+  nColKey = SDL_MapRGB(pSurfAtlas->format,(uint8_t)~colTxt.r,(uint8_t)~colTxt.g,(uint8_t)~colTxt.b);
+  SDL_FillRect(pSurfAtlas,NULL,nColKey);
+  for (nInd=0;nInd<DRV_SDL_GLYPH_CNT;nInd++) {
+    acGlyph[0] = DRV_SDL_GLYPH_FIRST + nInd;
+    pSurfGlyph = TTF_RenderText_Solid(pFont,acGlyph,gslc_DrvAdaptColor(colTxt));
+    if (pSurfGlyph == NULL) {
+      SDL_FreeSurface(pSurfAtlas);
+      return false;
+    }
+    rDst = pAtlas->asGlyph[nInd];
+    SDL_BlitSurface(pSurfGlyph,NULL,pSurfAtlas,&rDst);
+    SDL_FreeSurface(pSurfGlyph);
+  }
+
+  // Convert the atlas once into a form that is fast to blit
+#if defined(DRV_DISP_SDL1)
+  SDL_SetColorKey(pSurfAtlas,SDL_SRCCOLORKEY | SDL_RLEACCEL,nColKey);
+  pAtlas->pSurf = SDL_DisplayFormat(pSurfAtlas);
+  SDL_FreeSurface(pSurfAtlas);
+  return (pAtlas->pSurf != NULL);
 #endif
+#if defined(DRV_DISP_SDL2)
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_SetColorKey(pSurfAtlas,SDL_TRUE,nColKey);
+  pAtlas->pTex = SDL_CreateTextureFromSurface(pDriver->pRender,pSurfAtlas);
+  SDL_FreeSurface(pSurfAtlas);
+  return (pAtlas->pTex != NULL);
+#endif
+}
+
+void gslc_DrvGlyphAtlasFree(gslc_tsDrvGlyphAtlas* pAtlas)
+{
+#if defined(DRV_DISP_SDL1)
+  if (pAtlas->pSurf != NULL) {
+    SDL_FreeSurface(pAtlas->pSurf);
+    pAtlas->pSurf = NULL;
+  }
+#endif
+#if defined(DRV_DISP_SDL2)
+  if (pAtlas->pTex != NULL) {
+    SDL_DestroyTexture(pAtlas->pTex);
+    pAtlas->pTex = NULL;
+  }
+#endif
+  pAtlas->pFont = NULL;
+}
+
+void gslc_DrvGlyphCacheReset(gslc_tsGui* pGui)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint8_t         nInd;
+  for (nInd=0;nInd<DRV_SDL_GLYPH_ATLAS_MAX;nInd++) {
+    gslc_DrvGlyphAtlasFree(&pDriver->asGlyphAtlas[nInd]);
+    pDriver->asGlyphAtlas[nInd].nLastUse = 0;
+  }
+  pDriver->nGlyphUseCnt = 0;
+}
+
+#endif // DRV_SDL_GLYPH_ATLAS_MAX
 
 
 
@@ -48,6 +48,7 @@ extern "C" {
   #include <SDL/SDL.h>
   #include <SDL/SDL_getenv.h>
   #include <SDL/SDL_ttf.h>
+  #include "GUIslice_raster.h"
 #endif
 #if defined(DRV_DISP_SDL2)  
   #include <SDL2/SDL.h>
@@ -72,37 +73,98 @@ extern "C" {
   
 #if defined(DRV_DISP_SDL1)
   #define DRV_HAS_DRAW_POINTS         1 ///< Support gslc_DrvDrawPoints()  
-  #define DRV_HAS_DRAW_LINE           0 ///< Support gslc_DrvDrawLine()
-  #define DRV_HAS_DRAW_RECT_FRAME     0 ///< Support gslc_DrvDrawFrameRect()
+  #define DRV_HAS_DRAW_LINE           1 ///< Support gslc_DrvDrawLine()
+  #define DRV_HAS_DRAW_LINE_H         1 ///< Support gslc_DrvDrawLineH()
+  #define DRV_HAS_DRAW_LINE_V         1 ///< Support gslc_DrvDrawLineV()
+  #define DRV_HAS_DRAW_RECT_FRAME     1 ///< Support gslc_DrvDrawFrameRect()
   #define DRV_HAS_DRAW_RECT_FILL      1 ///< Support gslc_DrvDrawFillRect()
-  #define DRV_HAS_DRAW_CIRCLE_FRAME   0 ///< Support gslc_DrvDrawFrameCircle()
+  #define DRV_HAS_DRAW_CIRCLE_FRAME   1 ///< Support gslc_DrvDrawFrameCircle()
   #define DRV_HAS_DRAW_CIRCLE_FILL    0 ///< Support gslc_DrvDrawFillCircle()
+  #define DRV_HAS_DRAW_RECT_ROUND_FRAME 0 ///< Support gslc_DrvDrawFrameRoundRect()
+  #define DRV_HAS_DRAW_RECT_ROUND_FILL  0 ///< Support gslc_DrvDrawFillRoundRect()
+  #define DRV_HAS_DRAW_TRI_FILL       0 ///< Support gslc_DrvDrawFillTriangle()
+  #define DRV_HAS_DRAW_ROW565         0 ///< Support gslc_DrvDrawRow565()
+  #define DRV_HAS_DRAW_LINE_AA        1 ///< Support gslc_DrvDrawLineAA()
+  #define DRV_HAS_DRAW_CIRCLE_AA      1 ///< Support gslc_DrvDrawFrameCircleAA()
+  #define DRV_HAS_DRAW_RECT_FILL_ALPHA  1 ///< Support gslc_DrvDrawFillRectAlpha()
   #define DRV_HAS_DRAW_TEXT           1 ///< Support gslc_DrvDrawTxt()
+  #define DRV_HAS_COPY_RECT           1 ///< Support gslc_DrvCopyRectOut(), gslc_DrvCopyRectIn()
 #endif
   
 #if defined(DRV_DISP_SDL2)
   #define DRV_HAS_DRAW_POINTS         1 ///< Support gslc_DrvDrawPoints()
   #define DRV_HAS_DRAW_LINE           1 ///< Support gslc_DrvDrawLine()
+  #define DRV_HAS_DRAW_LINE_H         1 ///< Support gslc_DrvDrawLineH()
+  #define DRV_HAS_DRAW_LINE_V         1 ///< Support gslc_DrvDrawLineV()
   #define DRV_HAS_DRAW_RECT_FRAME     1 ///< Support gslc_DrvDrawFrameRect()
   #define DRV_HAS_DRAW_RECT_FILL      1 ///< Support gslc_DrvDrawFillRect()
   #define DRV_HAS_DRAW_CIRCLE_FRAME   0 ///< Support gslc_DrvDrawFrameCircle()
   #define DRV_HAS_DRAW_CIRCLE_FILL    0 ///< Support gslc_DrvDrawFillCircle()
+  #define DRV_HAS_DRAW_RECT_ROUND_FRAME 0 ///< Support gslc_DrvDrawFrameRoundRect()
+  #define DRV_HAS_DRAW_RECT_ROUND_FILL  0 ///< Support gslc_DrvDrawFillRoundRect()
+  #define DRV_HAS_DRAW_TRI_FILL       0 ///< Support gslc_DrvDrawFillTriangle()
+  #define DRV_HAS_DRAW_ROW565         0 ///< Support gslc_DrvDrawRow565()
+  #define DRV_HAS_DRAW_LINE_AA        0 ///< Support gslc_DrvDrawLineAA()
+  #define DRV_HAS_DRAW_CIRCLE_AA      0 ///< Support gslc_DrvDrawFrameCircleAA()
+  #define DRV_HAS_DRAW_RECT_FILL_ALPHA  1 ///< Support gslc_DrvDrawFillRectAlpha()
   #define DRV_HAS_DRAW_TEXT           1 ///< Support gslc_DrvDrawTxt()
+  // The renderer doesn't expose its pixels, so regions can't be copied
+  #define DRV_HAS_COPY_RECT           0 ///< Support gslc_DrvCopyRectOut(), gslc_DrvCopyRectIn()
 #endif  
   
+// =======================================================================
+// Glyph atlas
+// =======================================================================
+
+#define DRV_SDL_GLYPH_FIRST     32    ///< First character cached in a glyph atlas
+#define DRV_SDL_GLYPH_LAST      126   ///< Last character cached in a glyph atlas
+#define DRV_SDL_GLYPH_CNT       (DRV_SDL_GLYPH_LAST-DRV_SDL_GLYPH_FIRST+1)
+#define DRV_SDL_GLYPH_ATLAS_W   512   ///< Width of a glyph atlas (pixels)
+
+/// Glyph atlas
+/// - Holds the printable ASCII glyphs of one font rendered in one color
+/// - The glyphs are packed in rows that are each as tall as the font
+typedef struct {
+  TTF_Font*           pFont;            ///< Font of the glyphs (NULL if slot unused)
+  gslc_tsColor        colTxt;           ///< Color of the glyphs
+  #if defined(DRV_DISP_SDL1)
+  SDL_Surface*        pSurf;            ///< Atlas surface (NULL if the atlas couldn't be built)
+  #endif
+  #if defined(DRV_DISP_SDL2)
+  SDL_Texture*        pTex;             ///< Atlas texture (NULL if the atlas couldn't be built)
+  #endif
+  SDL_Rect            asGlyph[DRV_SDL_GLYPH_CNT];   ///< Region of each glyph within the atlas
+  int16_t             anOffsetX[DRV_SDL_GLYPH_CNT]; ///< X offset of each glyph region from the pen position
+  int16_t             anAdvance[DRV_SDL_GLYPH_CNT]; ///< Pen advance after each glyph
+  uint32_t            nLastUse;         ///< Use counter value at last draw (for eviction)
+} gslc_tsDrvGlyphAtlas;
+
 // =======================================================================
 // Driver-specific members
 // =======================================================================
 typedef struct {
   
+  gslc_tsColor        nColBkgnd;        ///< Background color (if not image-based)
+
   #if defined(DRV_DISP_SDL1)  
   SDL_Surface*        pSurfScreen;      ///< Surface ptr for screen
+  gslc_tsRaster       sRaster;          ///< Rasterizer for screen surface (includes clipping)
+  gslc_tsRect         asUpdateRect[DRV_SDL_UPDATE_RECT_MAX]; ///< Screen regions drawn since last page flip
+  uint8_t             nUpdateRectCnt;   ///< Number of screen regions drawn since last page flip
   #endif
 
   #if defined(DRV_DISP_SDL2)
   SDL_Window*         pWind;            ///< SDL2 Window
   SDL_Renderer*       pRender;          ///< SDL2 Rendering engine
+  SDL_Texture*        pTexTarget;       ///< SDL2 persistent render target (or NULL if not used)
+  #endif
+
+  #if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+  gslc_tsDrvGlyphAtlas asGlyphAtlas[DRV_SDL_GLYPH_ATLAS_MAX]; ///< Cached glyph atlases
+  uint32_t            nGlyphUseCnt;     ///< Counter of glyph atlas uses (for eviction)
   #endif
+  uint32_t            nGlyphHit;        ///< Number of text draws served from a glyph atlas
+  uint32_t            nGlyphMiss;       ///< Number of text draws rendered by SDL_ttf
 
   #if defined(DRV_TOUCH_TSLIB)
   struct tsdev*       pTsDev;           ///< Ptr to touchscreen device
@@ -154,6 +216,15 @@ bool gslc_DrvInit(gslc_tsGui* pGui);
 void gslc_DrvDestruct(gslc_tsGui* pGui);
 
 
+///
+/// Get the elapsed time since startup
+/// - Used for scheduling of gslc_Update()
+///
+/// \return Elapsed time in milliseconds
+///
+uint32_t gslc_DrvGetTicks(void);
+
+
 // -----------------------------------------------------------------------
 // Image/surface handling Functions
 // -----------------------------------------------------------------------
@@ -162,11 +233,22 @@ void gslc_DrvDestruct(gslc_tsGui* pGui);
 /// Load a bitmap (*.bmp) and create a new image resource.
 /// Transparency is enabled by GSLC_BMP_TRANS_EN
 /// through use of color (GSLC_BMP_TRANS_RGB).
+/// - Images in RAM or program memory can be BMP files or raw
+///   pixel arrays (GSLC_IMGREF_FMT_RAW16, GSLC_IMGREF_FMT_RAW24).
+///   SDL1 wraps a raw array in a surface without copying it when
+///   the array matches the display's pixel format, so the array must
+///   remain valid while the image is in use. Otherwise the array is
+///   converted once into a surface of its own.
+/// - Run-length encoded (GSLC_IMGREF_FMT_RLE16, GSLC_IMGREF_FMT_RLE8)
+///   and monochrome (GSLC_IMGREF_FMT_RAW1) arrays aren't loaded.
+///   They are decoded by gslc_DrvDrawImage() each time they are drawn
+///   (see gslc_DrvImageIsDirect), and can't be used as a background.
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  sImgRef:     Image reference
 ///
-/// \return Image pointer (surface/texture/path) or NULL if error
+/// \return Image pointer (surface/texture/path) or NULL if error or
+///         if the image is drawn directly
 /// 
 void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
 
@@ -218,6 +300,19 @@ bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
 
 
+///
+/// Get the size of an image loaded by gslc_DrvLoadImage()
+/// - Used to account for the image in the registry budget
+///   (see GSLC_IMG_CACHE_BYTES)
+///
+/// \param[in]  pGui:           Pointer to GUI
+/// \param[in]  pvImg:          Void ptr to image
+///
+/// \return Size of the image in bytes
+///
+uint32_t gslc_DrvGetImageBytes(gslc_tsGui* pGui,void* pvImg);
+
+
 /// 
 /// Release an image surface
 /// 
@@ -294,6 +389,21 @@ bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gsl
 ///  
 bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt);
 
+///
+/// Get the glyph cache statistics
+/// - A hit is a text draw composed from a cached glyph atlas
+/// - A miss is a text draw that required SDL_ttf to render glyphs,
+///   either to build an atlas or because the string contains
+///   characters outside of the cached range
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnHit:       Ptr to number of text draws served from the cache
+/// \param[out] pnMiss:      Ptr to number of text draws rendered by SDL_ttf
+///
+/// \return none
+///
+void gslc_DrvGetGlyphCacheStats(gslc_tsGui* pGui,uint32_t* pnHit,uint32_t* pnMiss);
+
 
 
 // -----------------------------------------------------------------------
@@ -378,6 +488,131 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
 
 
+///
+/// Draw a horizontal line (span)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          Line start (X coordinate)
+/// \param[in]  nY:          Line start (Y coordinate)
+/// \param[in]  nW:          Line length (pixels)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLineH(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nW,gslc_tsColor nCol);
+
+
+///
+/// Draw a vertical line (span)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          Line start (X coordinate)
+/// \param[in]  nY:          Line start (Y coordinate)
+/// \param[in]  nH:          Line length (pixels)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLineV(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nH,gslc_tsColor nCol);
+
+
+///
+/// Draw a framed circle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMidX:       Center of circle (X coordinate)
+/// \param[in]  nMidY:       Center of circle (Y coordinate)
+/// \param[in]  nRadius:     Radius of circle
+/// \param[in]  nCol:        Color RGB value to frame
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol);
+
+
+///
+/// Draw an anti-aliased line
+/// - Blends the line with the existing pixels
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         Line start (X coordinate)
+/// \param[in]  nY0:         Line start (Y coordinate)
+/// \param[in]  nX1:         Line finish (X coordinate)
+/// \param[in]  nY1:         Line finish (Y coordinate)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if blending isn't supported
+///
+bool gslc_DrvDrawLineAA(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
+
+
+///
+/// Draw an anti-aliased framed circle
+/// - Blends the circle with the existing pixels
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMidX:       Center of circle (X coordinate)
+/// \param[in]  nMidY:       Center of circle (Y coordinate)
+/// \param[in]  nRadius:     Radius of circle
+/// \param[in]  nCol:        Color RGB value to frame
+///
+/// \return true if success, false if blending isn't supported
+///
+bool gslc_DrvDrawFrameCircleAA(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol);
+
+
+///
+/// Draw a filled rectangle blended with the existing pixels
+/// - The opacity is taken from the transparency of the color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nCol:        Color RGB value and transparency to fill
+///
+/// \return true if success, false if blending isn't supported
+///
+bool gslc_DrvDrawFillRectAlpha(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Determine the number of bytes needed to hold a copy of
+/// a display region (see gslc_DrvCopyRectOut)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nW:          Width of region
+/// \param[in]  nH:          Height of region
+///
+/// \return Number of bytes or 0 if copying isn't supported
+///
+uint32_t gslc_DrvCopyRectSize(gslc_tsGui* pGui,uint16_t nW,uint16_t nH);
+
+
+///
+/// Copy the pixels of a display region to a buffer
+/// - The clipping region is ignored
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region to copy
+/// \param[out] pBuf:        Buffer of gslc_DrvCopyRectSize() bytes
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvCopyRectOut(gslc_tsGui* pGui,gslc_tsRect rRect,uint8_t* pBuf);
+
+
+///
+/// Copy pixels saved by gslc_DrvCopyRectOut() back to
+/// the display (clipped)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region to restore (same size as the copy)
+/// \param[in]  pBuf:        Buffer holding the copy
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvCopyRectIn(gslc_tsGui* pGui,gslc_tsRect rRect,const uint8_t* pBuf);
+
+
 ///
 /// Copy all of source image to destination screen at specified coordinate
 ///
@@ -401,6 +636,18 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
 void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);  
 
 
+///
+/// Restore a region of the screen from the background image
+/// - For a flat color background, the region is simply filled
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the screen to restore
+///
+/// \return none
+///
+void gslc_DrvDrawBkgndRect(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+
 // -----------------------------------------------------------------------
 // Touch Functions
 // -----------------------------------------------------------------------  
@@ -469,6 +716,31 @@ SDL_Color  gslc_DrvAdaptColor(gslc_tsColor sCol);
 // Private Drawing Functions
 // -----------------------------------------------------------------------
 
+///
+/// Determine whether an image is drawn directly from its array
+/// rather than loaded into a surface / texture
+/// - Run-length encoded and monochrome arrays in RAM or program memory
+///
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if drawn directly, false otherwise
+///
+bool gslc_DrvImageIsDirect(gslc_tsImgRef sImgRef);
+
+///
+/// Draw a monochrome bitmap (GSLC_IMGREF_FMT_RAW1)
+/// - Dimensions and output color are defined in the array header
+/// - Each run of set bits in a row is drawn as a span
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coordinate
+/// \param[in]  nDstY:       Destination Y coordinate
+/// \param[in]  pBitmap:     Pointer to image array
+///
+/// \return none
+///
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,const unsigned char* pBitmap);
+
 #if defined(DRV_DISP_SDL1)
 ///
 /// Lock an SDL surface so that direct pixel manipulation
@@ -504,6 +776,9 @@ void gslc_DrvScreenUnlock(gslc_tsGui* pGui);
 /// Convert an RGB color triplet into the surface pixel value.
 /// This is called to produce the native pixel value required by
 /// the raw pixel manipulation routines.
+/// - For 24-bit surfaces the value is in the byte order
+///   expected by the rasterizer (first byte in memory is
+///   the least significant)
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  nCol:        RGB value for conversion
@@ -557,10 +832,78 @@ void gslc_DrvDrawSetPixelRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint32_t nPi
 /// 
 void gslc_DrvPasteSurface(gslc_tsGui* pGui,int16_t nX, int16_t nY, void* pvSrc, void* pvDest);
 
+///
+/// Record a region of the screen surface that has been drawn
+/// so that the next page flip only needs to update the changed
+/// regions (SDL_UpdateRects) rather than the whole screen
+/// - The region is limited to the current clipping rect
+/// - Touching or overlapping regions are merged together
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  rRect:         Region of the screen that was drawn
+///
+/// \return none
+///
+void gslc_DrvUpdateRectAdd(gslc_tsGui* pGui,gslc_tsRect rRect);
+
 #endif // DRV_DISP_SDL1
 
 
 
+// -----------------------------------------------------------------------
+// Private Font Functions
+// -----------------------------------------------------------------------
+
+#if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+
+///
+/// Find the glyph atlas for a font and color, building it if
+/// it isn't cached yet
+/// - If all atlas slots are in use, the least recently used
+///   atlas is evicted
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFont:       Ptr to SDL_ttf font
+/// \param[in]  colTxt:      Color of text
+///
+/// \return Ptr to the atlas or NULL if the glyphs can't be cached
+///
+gslc_tsDrvGlyphAtlas* gslc_DrvGlyphAtlasGet(gslc_tsGui* pGui,TTF_Font* pFont,gslc_tsColor colTxt);
+
+///
+/// Render the glyphs of a font into a glyph atlas
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pAtlas:      Ptr to the atlas to fill
+/// \param[in]  pFont:       Ptr to SDL_ttf font
+/// \param[in]  colTxt:      Color of text
+///
+/// \return true if successful
+///
+bool gslc_DrvGlyphAtlasBuild(gslc_tsGui* pGui,gslc_tsDrvGlyphAtlas* pAtlas,TTF_Font* pFont,gslc_tsColor colTxt);
+
+///
+/// Release the image of a glyph atlas and mark its slot unused
+///
+/// \param[in]  pAtlas:      Ptr to the atlas
+///
+/// \return none
+///
+void gslc_DrvGlyphAtlasFree(gslc_tsDrvGlyphAtlas* pAtlas);
+
+///
+/// Release all cached glyph atlases
+/// - Called before the fonts or the renderer are destroyed
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvGlyphCacheReset(gslc_tsGui* pGui);
+
+#endif // DRV_SDL_GLYPH_ATLAS_MAX
+
+
 // -----------------------------------------------------------------------
 // Private Touchscreen Functions (if using SDL)
 // ----------------------------------------------------------------------- 
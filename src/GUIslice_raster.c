@@ -0,0 +1,814 @@
+// =======================================================================
+// GUIslice library (software rasterizer)
+// - Calvin Hass
+// - http://www.impulseadventure.com/elec/guislice-gui.html
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2017 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+
+
+// =======================================================================
+// Software rasterizer
+// =======================================================================
+
+// GUIslice library
+#include "GUIslice_raster.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+// Opacity for each level of pixel coverage used by the anti-aliased
+// primitives. The values are gamma corrected (gamma 2.2) so that the
+// light emitted by a pair of partially covered pixels matches that of
+// a single fully covered pixel.
+const uint8_t m_anRasterCovAlpha[GSLC_RASTER_COV_LEVELS] = {
+    0,  54,  73,  88, 101, 111, 121, 130, 138, 145, 152, 159, 166, 172, 178, 183,
+  189, 194, 199, 204, 209, 214, 218, 223, 227, 231, 235, 239, 243, 247, 251, 255,
+};
+
+
+// ------------------------------------------------------------------------
+// Pixel access for each format
+// - GSLC_RASTER_PLOT<bpp>() writes a pixel at an unclipped coordinate
+// - GSLC_RASTER_READ<bpp>() reads a pixel at an unclipped coordinate
+// ------------------------------------------------------------------------
+
+#define GSLC_RASTER_ADDR(pRaster,nX,nY,nBytes) \
+  ((pRaster)->pPixels + (int32_t)(nY)*(pRaster)->nPitch + (int32_t)(nX)*(nBytes))
+
+#define GSLC_RASTER_PUT8(pPix,nCol)   (*(uint8_t*)(pPix)  = (uint8_t)(nCol))
+#define GSLC_RASTER_PUT16(pPix,nCol)  (*(uint16_t*)(pPix) = (uint16_t)(nCol))
+#define GSLC_RASTER_PUT24(pPix,nCol)  { (pPix)[0] = (uint8_t)(nCol); \
+                                        (pPix)[1] = (uint8_t)((nCol) >> 8); \
+                                        (pPix)[2] = (uint8_t)((nCol) >> 16); }
+#define GSLC_RASTER_PUT32(pPix,nCol)  (*(uint32_t*)(pPix) = (uint32_t)(nCol))
+
+#define GSLC_RASTER_GET8(pPix)        (*(uint8_t*)(pPix))
+#define GSLC_RASTER_GET16(pPix)       (*(uint16_t*)(pPix))
+#define GSLC_RASTER_GET24(pPix)       ((uint32_t)(pPix)[0] | ((uint32_t)(pPix)[1] << 8) | ((uint32_t)(pPix)[2] << 16))
+#define GSLC_RASTER_GET32(pPix)       (*(uint32_t*)(pPix))
+
+#define GSLC_RASTER_PLOT1(pRaster,nX,nY,nCol) { \
+    uint8_t* pByte = GSLC_RASTER_ADDR(pRaster,0,nY,0) + ((nX) >> 3); \
+    if (nCol) { *pByte |= (0x80 >> ((nX) & 7)); } \
+    else      { *pByte &= ~(0x80 >> ((nX) & 7)); } }
+#define GSLC_RASTER_PLOT8(pRaster,nX,nY,nCol)   GSLC_RASTER_PUT8(GSLC_RASTER_ADDR(pRaster,nX,nY,1),nCol)
+#define GSLC_RASTER_PLOT16(pRaster,nX,nY,nCol)  GSLC_RASTER_PUT16(GSLC_RASTER_ADDR(pRaster,nX,nY,2),nCol)
+#define GSLC_RASTER_PLOT24(pRaster,nX,nY,nCol)  GSLC_RASTER_PUT24(GSLC_RASTER_ADDR(pRaster,nX,nY,3),nCol)
+#define GSLC_RASTER_PLOT32(pRaster,nX,nY,nCol)  GSLC_RASTER_PUT32(GSLC_RASTER_ADDR(pRaster,nX,nY,4),nCol)
+
+#define GSLC_RASTER_READ1(pRaster,nX,nY) \
+  ((*(GSLC_RASTER_ADDR(pRaster,0,nY,0) + ((nX) >> 3)) & (0x80 >> ((nX) & 7)))? 1 : 0)
+#define GSLC_RASTER_READ8(pRaster,nX,nY)        GSLC_RASTER_GET8(GSLC_RASTER_ADDR(pRaster,nX,nY,1))
+#define GSLC_RASTER_READ16(pRaster,nX,nY)       GSLC_RASTER_GET16(GSLC_RASTER_ADDR(pRaster,nX,nY,2))
+#define GSLC_RASTER_READ24(pRaster,nX,nY)       GSLC_RASTER_GET24(GSLC_RASTER_ADDR(pRaster,nX,nY,3))
+#define GSLC_RASTER_READ32(pRaster,nX,nY)       GSLC_RASTER_GET32(GSLC_RASTER_ADDR(pRaster,nX,nY,4))
+
+// Plot a pixel, testing against the clipping bounds (nCX0..nCY1) if bClip
+#define GSLC_RASTER_PLOT_CLIP(BPP,pRaster,nX,nY,nCol,bClip) { \
+    int16_t nPX = (nX); int16_t nPY = (nY); \
+    if (!(bClip) || ((nPX >= nCX0) && (nPX <= nCX1) && (nPY >= nCY0) && (nPY <= nCY1))) { \
+      GSLC_RASTER_PLOT##BPP(pRaster,nPX,nPY,nCol); } }
+
+
+// ------------------------------------------------------------------------
+// Format-specialized routines common to all formats
+// ------------------------------------------------------------------------
+
+#define GSLC_RASTER_IMPL_SHAPES(BPP) \
+\
+void gslc_RasterSetPixel##BPP(gslc_tsRaster* pRaster,int16_t nX,int16_t nY,uint32_t nColRaw) \
+{ \
+  GSLC_RASTER_PLOT##BPP(pRaster,nX,nY,nColRaw); \
+} \
+\
+uint32_t gslc_RasterGetPixel##BPP(gslc_tsRaster* pRaster,int16_t nX,int16_t nY) \
+{ \
+  return GSLC_RASTER_READ##BPP(pRaster,nX,nY); \
+} \
+\
+void gslc_RasterPoints##BPP(gslc_tsRaster* pRaster,gslc_tsPt* asPt,uint16_t nNumPt,uint32_t nColRaw) \
+{ \
+  int16_t   nCX0 = pRaster->rClip.x; \
+  int16_t   nCY0 = pRaster->rClip.y; \
+  int16_t   nCX1 = pRaster->rClip.x + pRaster->rClip.w - 1; \
+  int16_t   nCY1 = pRaster->rClip.y + pRaster->rClip.h - 1; \
+  uint16_t  nInd; \
+  for (nInd=0;nInd<nNumPt;nInd++) { \
+    GSLC_RASTER_PLOT_CLIP(BPP,pRaster,asPt[nInd].x,asPt[nInd].y,nColRaw,true); \
+  } \
+} \
+\
+void gslc_RasterLine##BPP(gslc_tsRaster* pRaster,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,uint32_t nColRaw) \
+{ \
+  int16_t nCX0  = pRaster->rClip.x; \
+  int16_t nCY0  = pRaster->rClip.y; \
+  int16_t nCX1  = pRaster->rClip.x + pRaster->rClip.w - 1; \
+  int16_t nCY1  = pRaster->rClip.y + pRaster->rClip.h - 1; \
+  int16_t nDX   = abs(nX1-nX0); \
+  int16_t nDY   = abs(nY1-nY0); \
+  int16_t nSX   = (nX0 < nX1)? 1 : -1; \
+  int16_t nSY   = (nY0 < nY1)? 1 : -1; \
+  int16_t nErr  = ( (nDX>nDY)? nDX : -nDY )/2; \
+  int16_t nE2; \
+  /* Only test each pixel if an endpoint lies outside the clip */ \
+  bool    bClip = !gslc_ClipPt(&pRaster->rClip,nX0,nY0) || !gslc_ClipPt(&pRaster->rClip,nX1,nY1); \
+  for (;;) { \
+    GSLC_RASTER_PLOT_CLIP(BPP,pRaster,nX0,nY0,nColRaw,bClip); \
+    if ( (nX0 == nX1) && (nY0 == nY1) ) break; \
+    nE2 = nErr; \
+    if (nE2 > -nDX) { nErr -= nDY; nX0 += nSX; } \
+    if (nE2 <  nDY) { nErr += nDX; nY0 += nSY; } \
+  } \
+} \
+\
+void gslc_RasterFrameCircle##BPP(gslc_tsRaster* pRaster,int16_t nMidX,int16_t nMidY,uint16_t nRadius,uint32_t nColRaw) \
+{ \
+  int16_t nCX0  = pRaster->rClip.x; \
+  int16_t nCY0  = pRaster->rClip.y; \
+  int16_t nCX1  = pRaster->rClip.x + pRaster->rClip.w - 1; \
+  int16_t nCY1  = pRaster->rClip.y + pRaster->rClip.h - 1; \
+  int16_t nX    = nRadius; \
+  int16_t nY    = 0; \
+  int16_t nErr  = 0; \
+  /* Only test each pixel if the circle extends beyond the clip */ \
+  bool    bClip = (nMidX-nX < nCX0) || (nMidX+nX > nCX1) || (nMidY-nX < nCY0) || (nMidY+nX > nCY1); \
+  while (nX >= nY) { \
+    GSLC_RASTER_PLOT_CLIP(BPP,pRaster,nMidX + nX,nMidY + nY,nColRaw,bClip); \
+    GSLC_RASTER_PLOT_CLIP(BPP,pRaster,nMidX + nY,nMidY + nX,nColRaw,bClip); \
+    GSLC_RASTER_PLOT_CLIP(BPP,pRaster,nMidX - nY,nMidY + nX,nColRaw,bClip); \
+    GSLC_RASTER_PLOT_CLIP(BPP,pRaster,nMidX - nX,nMidY + nY,nColRaw,bClip); \
+    GSLC_RASTER_PLOT_CLIP(BPP,pRaster,nMidX - nX,nMidY - nY,nColRaw,bClip); \
+    GSLC_RASTER_PLOT_CLIP(BPP,pRaster,nMidX - nY,nMidY - nX,nColRaw,bClip); \
+    GSLC_RASTER_PLOT_CLIP(BPP,pRaster,nMidX + nY,nMidY - nX,nColRaw,bClip); \
+    GSLC_RASTER_PLOT_CLIP(BPP,pRaster,nMidX + nX,nMidY - nY,nColRaw,bClip); \
+    nY    += 1; \
+    nErr  += 1 + 2*nY; \
+    if (2*(nErr-nX) + 1 > 0) { \
+      nX    -= 1; \
+      nErr  += 1 - 2*nX; \
+    } \
+  } \
+}
+
+
+// ------------------------------------------------------------------------
+// Format-specialized span routines for byte-aligned formats
+// - Rows are filled and copied by the vectorized kernels where
+//   available. The 24bpp format has no fill kernel, so its rect
+//   fills write the first row and then replicate it.
+// ------------------------------------------------------------------------
+
+#define GSLC_RASTER_FILL8(pPix,nW,nCol)   memset((pPix),(uint8_t)(nCol),(nW))
+#define GSLC_RASTER_FILL16(pPix,nW,nCol)  gslc_SimdFill16((uint16_t*)(pPix),(nW),(uint16_t)(nCol))
+#define GSLC_RASTER_FILL24(pPix,nW,nCol)  { uint8_t* pPut = (pPix); uint16_t nInd; \
+    for (nInd=0;nInd<(nW);nInd++) { GSLC_RASTER_PUT24(pPut,nCol); pPut += 3; } }
+#define GSLC_RASTER_FILL32(pPix,nW,nCol)  gslc_SimdFill32((uint32_t*)(pPix),(nW),(uint32_t)(nCol))
+
+#define GSLC_RASTER_FILLRECT8(pRow,nPitch,nW,nH,nCol)  { uint8_t* pPut = (pRow); uint16_t nInd; \
+    for (nInd=0;nInd<(nH);nInd++) { GSLC_RASTER_FILL8(pPut,nW,nCol); pPut += (nPitch); } }
+#define GSLC_RASTER_FILLRECT16(pRow,nPitch,nW,nH,nCol) gslc_SimdFillRect16((pRow),(nPitch),(nW),(nH),(uint16_t)(nCol))
+#define GSLC_RASTER_FILLRECT24(pRow,nPitch,nW,nH,nCol) { GSLC_RASTER_FILL24(pRow,nW,nCol); \
+    gslc_SimdCopyRect((pRow)+(nPitch),(nPitch),(pRow),0,(uint32_t)(nW)*3,(nH)-1); }
+#define GSLC_RASTER_FILLRECT32(pRow,nPitch,nW,nH,nCol) gslc_SimdFillRect32((pRow),(nPitch),(nW),(nH),(uint32_t)(nCol))
+
+#define GSLC_RASTER_IMPL_SPANS(BPP,NBYTES) \
+\
+void gslc_RasterFillSpan##BPP(gslc_tsRaster* pRaster,int16_t nX,int16_t nY,uint16_t nW,uint32_t nColRaw) \
+{ \
+  GSLC_RASTER_FILL##BPP(GSLC_RASTER_ADDR(pRaster,nX,nY,NBYTES),nW,nColRaw); \
+} \
+\
+void gslc_RasterFillRect##BPP(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint32_t nColRaw) \
+{ \
+  if ((rRect.w == 0) || (rRect.h == 0)) { return; } \
+  GSLC_RASTER_FILLRECT##BPP(GSLC_RASTER_ADDR(pRaster,rRect.x,rRect.y,NBYTES),pRaster->nPitch,rRect.w,rRect.h,nColRaw); \
+} \
+\
+void gslc_RasterBlit##BPP(gslc_tsRaster* pRaster,int16_t nDstX,int16_t nDstY,const uint8_t* pSrc,uint16_t nSrcPitch,uint16_t nSrcX,uint16_t nW,uint16_t nH) \
+{ \
+  gslc_SimdCopyRect(GSLC_RASTER_ADDR(pRaster,nDstX,nDstY,NBYTES),pRaster->nPitch, \
+    pSrc + (size_t)nSrcX*NBYTES,nSrcPitch,(uint32_t)nW*NBYTES,nH); \
+}
+
+
+// ------------------------------------------------------------------------
+// Format-specialized anti-aliased and blended routines
+// - The anti-aliased shapes are based on Wu's algorithm. The position of
+//   the ideal curve is tracked in fixed point and its fractional part
+//   selects the coverage of the two pixels that straddle it. The coverage
+//   is converted to opacity with m_anRasterCovAlpha[] and blended with
+//   the destination.
+// - The blended fill applies a single opacity to every pixel
+// ------------------------------------------------------------------------
+
+// Blend the source color over a destination pixel value
+// - When the channel layout permits (see gslc_RasterSetChannels), the
+//   outer channels and the middle channel are each blended as a group
+//   with a single multiply. The 16bpp formats move the middle channel
+//   into the upper half word so that all channels form one group.
+// - Requires the locals declared by GSLC_RASTER_BLEND_SETUP
+#define GSLC_RASTER_BLEND_SETUP(nCol) \
+  uint32_t  nMaskO  = pRaster->nBlendMaskO; \
+  uint32_t  nMaskM  = pRaster->nBlendMaskM; \
+  uint32_t  nSrcO   = (nCol) & nMaskO; \
+  uint32_t  nSrcM   = (nCol) & nMaskM; \
+  bool      bPacked = pRaster->bBlendPacked; \
+  (void)nSrcO; (void)nSrcM; (void)bPacked;  /* Unused by the 8bpp format */
+
+#define GSLC_RASTER_MIX8(nSrc,nDst,nAlpha) \
+  gslc_RasterBlendRaw(pRaster,nSrc,nDst,nAlpha)
+#define GSLC_RASTER_MIX16(nSrc,nDst,nAlpha) \
+  ((bPacked)? gslc_RasterMixSpread(nSrcO | (nSrcM << 16),nDst,nMaskO,nMaskM,nAlpha) \
+            : gslc_RasterBlendRaw(pRaster,nSrc,nDst,nAlpha))
+#define GSLC_RASTER_MIX24(nSrc,nDst,nAlpha) \
+  ((bPacked)? gslc_RasterMixGroups(nSrcO,nSrcM,nDst,nMaskO,nMaskM,nAlpha) \
+            : gslc_RasterBlendRaw(pRaster,nSrc,nDst,nAlpha))
+#define GSLC_RASTER_MIX32(nSrc,nDst,nAlpha)   GSLC_RASTER_MIX24(nSrc,nDst,nAlpha)
+
+// Blend a pixel over the destination, testing against the clipping bounds
+#define GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nX,nY,nCol,nCov) { \
+    int16_t nPX = (nX); int16_t nPY = (nY); \
+    if ((nPX >= nCX0) && (nPX <= nCX1) && (nPY >= nCY0) && (nPY <= nCY1)) { \
+      uint32_t nDst = GSLC_RASTER_READ##BPP(pRaster,nPX,nPY); \
+      nDst = GSLC_RASTER_MIX##BPP(nCol,nDst,m_anRasterCovAlpha[nCov]); \
+      GSLC_RASTER_PLOT##BPP(pRaster,nPX,nPY,nDst); } }
+
+// Blend a pixel in the first octant of a circle and its reflections
+// in the other octants, taking care not to blend any pixel twice
+#define GSLC_RASTER_BLEND_OCT(BPP,pRaster,nMidX,nMidY,nA,nB,nCol,nCov) { \
+    GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nMidX+(nA),nMidY+(nB),nCol,nCov); \
+    GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nMidX-(nA),nMidY+(nB),nCol,nCov); \
+    if ((nB) != 0) { \
+      GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nMidX+(nA),nMidY-(nB),nCol,nCov); \
+      GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nMidX-(nA),nMidY-(nB),nCol,nCov); } \
+    if ((nA) != (nB)) { \
+      GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nMidX+(nB),nMidY+(nA),nCol,nCov); \
+      GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nMidX+(nB),nMidY-(nA),nCol,nCov); \
+      if ((nB) != 0) { \
+        GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nMidX-(nB),nMidY+(nA),nCol,nCov); \
+        GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nMidX-(nB),nMidY-(nA),nCol,nCov); } } }
+
+#define GSLC_RASTER_IMPL_AA(BPP) \
+\
+void gslc_RasterLineAA##BPP(gslc_tsRaster* pRaster,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,uint32_t nColRaw) \
+{ \
+  int16_t   nCX0  = pRaster->rClip.x; \
+  int16_t   nCY0  = pRaster->rClip.y; \
+  int16_t   nCX1  = pRaster->rClip.x + pRaster->rClip.w - 1; \
+  int16_t   nCY1  = pRaster->rClip.y + pRaster->rClip.h - 1; \
+  GSLC_RASTER_BLEND_SETUP(nColRaw) \
+  int16_t   nTmp; \
+  /* Always step downwards */ \
+  if (nY0 > nY1) { \
+    nTmp = nX0; nX0 = nX1; nX1 = nTmp; \
+    nTmp = nY0; nY0 = nY1; nY1 = nTmp; \
+  } \
+  int16_t   nDX   = abs(nX1-nX0); \
+  int16_t   nDY   = nY1-nY0; \
+  int16_t   nSX   = (nX0 < nX1)? 1 : -1; \
+  uint16_t  nErrAcc = 0; \
+  uint16_t  nErrAdj,nErrPrev; \
+  uint8_t   nCov; \
+  /* Lines that are horizontal, vertical or diagonal have full coverage */ \
+  if ((nDX == 0) || (nDY == 0) || (nDX == nDY)) { \
+    gslc_RasterLine##BPP(pRaster,nX0,nY0,nX1,nY1,nColRaw); \
+    return; \
+  } \
+  /* The endpoints lie on the ideal line */ \
+  GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nX0,nY0,nColRaw,GSLC_RASTER_COV_LEVELS-1); \
+  GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nX1,nY1,nColRaw,GSLC_RASTER_COV_LEVELS-1); \
+  if (nDY > nDX) { \
+    /* Y-major: nErrAcc is the fractional X offset of the ideal line */ \
+    nErrAdj = (uint16_t)(((uint32_t)nDX << 16) / nDY); \
+    while (--nDY) { \
+      nErrPrev = nErrAcc; \
+      nErrAcc += nErrAdj; \
+      if (nErrAcc <= nErrPrev) { nX0 += nSX; } \
+      nY0++; \
+      nCov = nErrAcc >> (16 - GSLC_RASTER_COV_BITS); \
+      GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nX0,nY0,nColRaw,nCov ^ (GSLC_RASTER_COV_LEVELS-1)); \
+      GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nX0+nSX,nY0,nColRaw,nCov); \
+    } \
+  } else { \
+    /* X-major: nErrAcc is the fractional Y offset of the ideal line */ \
+    nErrAdj = (uint16_t)(((uint32_t)nDY << 16) / nDX); \
+    while (--nDX) { \
+      nErrPrev = nErrAcc; \
+      nErrAcc += nErrAdj; \
+      if (nErrAcc <= nErrPrev) { nY0++; } \
+      nX0 += nSX; \
+      nCov = nErrAcc >> (16 - GSLC_RASTER_COV_BITS); \
+      GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nX0,nY0,nColRaw,nCov ^ (GSLC_RASTER_COV_LEVELS-1)); \
+      GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nX0,nY0+1,nColRaw,nCov); \
+    } \
+  } \
+} \
+\
+void gslc_RasterFrameCircleAA##BPP(gslc_tsRaster* pRaster,int16_t nMidX,int16_t nMidY,uint16_t nRadius,uint32_t nColRaw) \
+{ \
+  int16_t   nCX0  = pRaster->rClip.x; \
+  int16_t   nCY0  = pRaster->rClip.y; \
+  int16_t   nCX1  = pRaster->rClip.x + pRaster->rClip.w - 1; \
+  int16_t   nCY1  = pRaster->rClip.y + pRaster->rClip.h - 1; \
+  GSLC_RASTER_BLEND_SETUP(nColRaw) \
+  uint32_t  nRadSq = (uint32_t)nRadius*nRadius; \
+  uint32_t  nXFx; \
+  int16_t   nX,nY; \
+  uint8_t   nCov; \
+  if (nRadius == 0) { \
+    GSLC_RASTER_BLEND_CLIP(BPP,pRaster,nMidX,nMidY,nColRaw,GSLC_RASTER_COV_LEVELS-1); \
+    return; \
+  } \
+  /* Walk the octant from the X axis to the diagonal. The ideal X */ \
+  /* coordinate is calculated with GSLC_RASTER_COV_BITS of fraction. */ \
+  for (nY=0;;nY++) { \
+    nXFx  = gslc_SqrtInt((nRadSq - (uint32_t)nY*nY) << (2*GSLC_RASTER_COV_BITS)); \
+    nX    = nXFx >> GSLC_RASTER_COV_BITS; \
+    if (nX < nY) { break; } \
+    nCov  = nXFx & (GSLC_RASTER_COV_LEVELS-1); \
+    GSLC_RASTER_BLEND_OCT(BPP,pRaster,nMidX,nMidY,nX,nY,nColRaw,nCov ^ (GSLC_RASTER_COV_LEVELS-1)); \
+    if (nCov != 0) { \
+      GSLC_RASTER_BLEND_OCT(BPP,pRaster,nMidX,nMidY,nX+1,nY,nColRaw,nCov); \
+    } \
+  } \
+} \
+\
+void gslc_RasterFillRectAlpha##BPP(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint32_t nColRaw,uint8_t nAlpha) \
+{ \
+  GSLC_RASTER_BLEND_SETUP(nColRaw) \
+  uint8_t*  pRow  = GSLC_RASTER_ADDR(pRaster,rRect.x,rRect.y,(BPP/8)); \
+  uint8_t*  pPix; \
+  uint16_t  nRow,nCol; \
+  uint32_t  nDst; \
+  for (nRow=0;nRow<rRect.h;nRow++) { \
+    pPix = pRow; \
+    for (nCol=0;nCol<rRect.w;nCol++) { \
+      nDst = GSLC_RASTER_GET##BPP(pPix); \
+      nDst = GSLC_RASTER_MIX##BPP(nColRaw,nDst,nAlpha); \
+      GSLC_RASTER_PUT##BPP(pPix,nDst); \
+      pPix += (BPP/8); \
+    } \
+    pRow += pRaster->nPitch; \
+  } \
+}
+
+
+GSLC_RASTER_IMPL_SHAPES(1)
+GSLC_RASTER_IMPL_SHAPES(8)
+GSLC_RASTER_IMPL_SHAPES(16)
+GSLC_RASTER_IMPL_SHAPES(24)
+GSLC_RASTER_IMPL_SHAPES(32)
+
+GSLC_RASTER_IMPL_SPANS(8,1)
+GSLC_RASTER_IMPL_SPANS(16,2)
+GSLC_RASTER_IMPL_SPANS(24,3)
+GSLC_RASTER_IMPL_SPANS(32,4)
+
+GSLC_RASTER_IMPL_AA(8)
+GSLC_RASTER_IMPL_AA(16)
+GSLC_RASTER_IMPL_AA(24)
+GSLC_RASTER_IMPL_AA(32)
+
+
+// ------------------------------------------------------------------------
+// Span routines for the 1bpp format
+// - Whole bytes within a span are written at once
+// ------------------------------------------------------------------------
+
+void gslc_RasterFillSpan1(gslc_tsRaster* pRaster,int16_t nX,int16_t nY,uint16_t nW,uint32_t nColRaw)
+{
+  uint8_t*  pRow  = GSLC_RASTER_ADDR(pRaster,0,nY,0);
+  int16_t   nX1   = nX + nW - 1;
+  int16_t   nB0   = nX >> 3;
+  int16_t   nB1   = nX1 >> 3;
+  uint8_t   nMask0 = 0xFF >> (nX & 7);
+  uint8_t   nMask1 = 0xFF << (7 - (nX1 & 7));
+
+  if (nW == 0) { return; }
+  if (nB0 == nB1) {
+    nMask0 &= nMask1;
+    pRow[nB0] = (nColRaw)? (pRow[nB0] | nMask0) : (pRow[nB0] & ~nMask0);
+    return;
+  }
+  pRow[nB0] = (nColRaw)? (pRow[nB0] | nMask0) : (pRow[nB0] & ~nMask0);
+  if (nB1 > nB0+1) {
+    memset(&pRow[nB0+1],(nColRaw)? 0xFF : 0x00,nB1-nB0-1);
+  }
+  pRow[nB1] = (nColRaw)? (pRow[nB1] | nMask1) : (pRow[nB1] & ~nMask1);
+}
+
+void gslc_RasterFillRect1(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint32_t nColRaw)
+{
+  uint16_t  nRow;
+  for (nRow=0;nRow<rRect.h;nRow++) {
+    gslc_RasterFillSpan1(pRaster,rRect.x,rRect.y+nRow,rRect.w,nColRaw);
+  }
+}
+
+void gslc_RasterBlit1(gslc_tsRaster* pRaster,int16_t nDstX,int16_t nDstY,const uint8_t* pSrc,uint16_t nSrcPitch,uint16_t nSrcX,uint16_t nW,uint16_t nH)
+{
+  uint16_t  nRow,nCol;
+  uint16_t  nSX;
+  for (nRow=0;nRow<nH;nRow++) {
+    for (nCol=0;nCol<nW;nCol++) {
+      nSX = nSrcX + nCol;
+      GSLC_RASTER_PLOT1(pRaster,nDstX+nCol,nDstY+nRow,pSrc[nSX >> 3] & (0x80 >> (nSX & 7)));
+    }
+    pSrc += nSrcPitch;
+  }
+}
+
+
+// =======================================================================
+// Public APIs
+// =======================================================================
+
+bool gslc_RasterInit(gslc_tsRaster* pRaster,uint8_t* pPixels,uint16_t nPitch,int16_t nW,int16_t nH,gslc_teRasterFmt eFmt)
+{
+  if (pRaster == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: RasterInit(%s) called with NULL ptr\n","");
+    return false;
+  }
+  pRaster->pPixels  = pPixels;
+  pRaster->nPitch   = nPitch;
+  pRaster->nW       = nW;
+  pRaster->nH       = nH;
+  pRaster->eFmt     = eFmt;
+  gslc_RasterSetClip(pRaster,NULL);
+  gslc_RasterSetChannels(pRaster,0,0,0,0,0,0);
+  gslc_SimdInit();
+  if (eFmt == GSLC_RASTER_FMT_NONE) {
+    GSLC_DEBUG_PRINT("ERROR: RasterInit(%s) unsupported pixel format\n","");
+    return false;
+  }
+  return true;
+}
+
+void gslc_RasterSetBuf(gslc_tsRaster* pRaster,uint8_t* pPixels)
+{
+  pRaster->pPixels = pPixels;
+}
+
+gslc_teRasterFmt gslc_RasterGetFmt(uint8_t nBpp)
+{
+  switch (nBpp) {
+    case 1:   return GSLC_RASTER_FMT_1;
+    case 8:   return GSLC_RASTER_FMT_8;
+    case 16:  return GSLC_RASTER_FMT_16;
+    case 24:  return GSLC_RASTER_FMT_24;
+    case 32:  return GSLC_RASTER_FMT_32;
+    default:  return GSLC_RASTER_FMT_NONE;
+  }
+}
+
+void gslc_RasterSetClip(gslc_tsRaster* pRaster,gslc_tsRect* pRect)
+{
+  gslc_tsRect rBuf = {0,0,pRaster->nW,pRaster->nH};
+  pRaster->rClip = rBuf;
+  if (pRect != NULL) {
+    pRaster->rClip = *pRect;
+    if (!gslc_ClipRect(&rBuf,&pRaster->rClip)) {
+      pRaster->rClip = (gslc_tsRect){0,0,0,0};
+    }
+  }
+}
+
+void gslc_RasterSetChannels(gslc_tsRaster* pRaster,uint8_t nShiftR,uint8_t nBitsR,
+  uint8_t nShiftG,uint8_t nBitsG,uint8_t nShiftB,uint8_t nBitsB)
+{
+  uint8_t   nLo,nMid,nHi,nTmp;
+  uint8_t   nMixBits;
+  uint32_t  anMask[3];
+  uint8_t   nInd;
+
+  pRaster->anChanShift[0] = nShiftR;
+  pRaster->anChanShift[1] = nShiftG;
+  pRaster->anChanShift[2] = nShiftB;
+  pRaster->anChanBits[0]  = nBitsR;
+  pRaster->anChanBits[1]  = nBitsG;
+  pRaster->anChanBits[2]  = nBitsB;
+  pRaster->nBlendMaskO    = 0;
+  pRaster->nBlendMaskM    = 0;
+  pRaster->bBlendPacked   = false;
+  if (!gslc_RasterCanBlend(pRaster)) {
+    return;
+  }
+
+  // Order the channels by bit position
+  nLo = 0; nMid = 1; nHi = 2;
+  if (pRaster->anChanShift[nLo]  > pRaster->anChanShift[nMid]) { nTmp = nLo;  nLo  = nMid; nMid = nTmp; }
+  if (pRaster->anChanShift[nMid] > pRaster->anChanShift[nHi])  { nTmp = nMid; nMid = nHi;  nHi  = nTmp; }
+  if (pRaster->anChanShift[nLo]  > pRaster->anChanShift[nMid]) { nTmp = nLo;  nLo  = nMid; nMid = nTmp; }
+  for (nInd=0;nInd<3;nInd++) {
+    anMask[nInd] = (((uint32_t)1 << pRaster->anChanBits[nInd]) - 1) << pRaster->anChanShift[nInd];
+  }
+  pRaster->nBlendMaskO = anMask[nLo] | anMask[nHi];
+  pRaster->nBlendMaskM = anMask[nMid];
+
+  // The grouped blend multiplies each channel in place, so every
+  // channel needs enough clear bits above it within its group to
+  // hold the product with the opacity
+  uint8_t nTopLo  = pRaster->anChanShift[nLo]  + pRaster->anChanBits[nLo];
+  uint8_t nTopMid = pRaster->anChanShift[nMid] + pRaster->anChanBits[nMid];
+  uint8_t nTopHi  = pRaster->anChanShift[nHi]  + pRaster->anChanBits[nHi];
+  if (pRaster->eFmt == GSLC_RASTER_FMT_16) {
+    // The middle channel is moved up by 16 bits and the
+    // opacity is reduced to five bits
+    nMixBits = 5;
+    pRaster->bBlendPacked = (nTopLo + nMixBits <= pRaster->anChanShift[nHi]) &&
+      (nTopHi + nMixBits <= pRaster->anChanShift[nMid] + 16) && (nTopMid + 16 + nMixBits <= 32);
+  } else if ((pRaster->eFmt == GSLC_RASTER_FMT_24) || (pRaster->eFmt == GSLC_RASTER_FMT_32)) {
+    nMixBits = 8;
+    pRaster->bBlendPacked = (nTopLo + nMixBits <= pRaster->anChanShift[nHi]) &&
+      (nTopHi + nMixBits <= 32) && (nTopMid + nMixBits <= 32);
+  }
+}
+
+bool gslc_RasterCanBlend(gslc_tsRaster* pRaster)
+{
+  if (pRaster->eFmt == GSLC_RASTER_FMT_1) {
+    return false;
+  }
+  return (pRaster->anChanBits[0] != 0) && (pRaster->anChanBits[1] != 0) && (pRaster->anChanBits[2] != 0);
+}
+
+uint32_t gslc_RasterBlendRaw(gslc_tsRaster* pRaster,uint32_t nSrc,uint32_t nDst,uint8_t nAlpha)
+{
+  uint32_t  nOut = nDst;
+  uint32_t  nMask,nChanSrc,nChanDst;
+  uint8_t   nChan;
+  if (nAlpha == 0)    { return nDst; }
+  if (nAlpha == 255)  { return nSrc; }
+  for (nChan=0;nChan<3;nChan++) {
+    nMask     = ((uint32_t)1 << pRaster->anChanBits[nChan]) - 1;
+    nChanSrc  = (nSrc >> pRaster->anChanShift[nChan]) & nMask;
+    nChanDst  = (nDst >> pRaster->anChanShift[nChan]) & nMask;
+    nChanDst  = (nChanSrc*nAlpha + nChanDst*(255-nAlpha) + 127) / 255;
+    nOut      = (nOut & ~(nMask << pRaster->anChanShift[nChan])) | (nChanDst << pRaster->anChanShift[nChan]);
+  }
+  return nOut;
+}
+
+uint32_t gslc_RasterMixSpread(uint32_t nSrcSpread,uint32_t nDst,uint32_t nMaskO,uint32_t nMaskM,uint8_t nAlpha)
+{
+  uint32_t nMask = nMaskO | (nMaskM << 16);
+  uint32_t nMix  = (nDst & nMaskO) | ((nDst & nMaskM) << 16);
+  nMix = ((((nSrcSpread - nMix) * (uint32_t)((nAlpha + 4) >> 3)) >> 5) + nMix) & nMask;
+  return (nDst & ~(nMaskO | nMaskM)) | (nMix & nMaskO) | ((nMix >> 16) & nMaskM);
+}
+
+uint32_t gslc_RasterMixGroups(uint32_t nSrcO,uint32_t nSrcM,uint32_t nDst,uint32_t nMaskO,uint32_t nMaskM,uint8_t nAlpha)
+{
+  uint32_t nAlpha8 = nAlpha + (nAlpha >> 7);
+  uint32_t nDstO   = nDst & nMaskO;
+  uint32_t nDstM   = nDst & nMaskM;
+  nDstO = ((((nSrcO - nDstO) * nAlpha8) >> 8) + nDstO) & nMaskO;
+  nDstM = ((((nSrcM - nDstM) * nAlpha8) >> 8) + nDstM) & nMaskM;
+  return (nDst & ~(nMaskO | nMaskM)) | nDstO | nDstM;
+}
+
+void gslc_RasterSetPixel(gslc_tsRaster* pRaster,int16_t nX,int16_t nY,uint32_t nColRaw)
+{
+  if (!gslc_ClipPt(&pRaster->rClip,nX,nY)) { return; }
+  switch (pRaster->eFmt) {
+    case GSLC_RASTER_FMT_1:   gslc_RasterSetPixel1(pRaster,nX,nY,nColRaw);  break;
+    case GSLC_RASTER_FMT_8:   gslc_RasterSetPixel8(pRaster,nX,nY,nColRaw);  break;
+    case GSLC_RASTER_FMT_16:  gslc_RasterSetPixel16(pRaster,nX,nY,nColRaw); break;
+    case GSLC_RASTER_FMT_24:  gslc_RasterSetPixel24(pRaster,nX,nY,nColRaw); break;
+    case GSLC_RASTER_FMT_32:  gslc_RasterSetPixel32(pRaster,nX,nY,nColRaw); break;
+    default: break;
+  }
+}
+
+uint32_t gslc_RasterGetPixel(gslc_tsRaster* pRaster,int16_t nX,int16_t nY)
+{
+  if ((nX < 0) || (nY < 0) || (nX >= pRaster->nW) || (nY >= pRaster->nH)) {
+    return 0;
+  }
+  switch (pRaster->eFmt) {
+    case GSLC_RASTER_FMT_1:   return gslc_RasterGetPixel1(pRaster,nX,nY);
+    case GSLC_RASTER_FMT_8:   return gslc_RasterGetPixel8(pRaster,nX,nY);
+    case GSLC_RASTER_FMT_16:  return gslc_RasterGetPixel16(pRaster,nX,nY);
+    case GSLC_RASTER_FMT_24:  return gslc_RasterGetPixel24(pRaster,nX,nY);
+    case GSLC_RASTER_FMT_32:  return gslc_RasterGetPixel32(pRaster,nX,nY);
+    default:                  return 0;
+  }
+}
+
+void gslc_RasterPoints(gslc_tsRaster* pRaster,gslc_tsPt* asPt,uint16_t nNumPt,uint32_t nColRaw)
+{
+  switch (pRaster->eFmt) {
+    case GSLC_RASTER_FMT_1:   gslc_RasterPoints1(pRaster,asPt,nNumPt,nColRaw);  break;
+    case GSLC_RASTER_FMT_8:   gslc_RasterPoints8(pRaster,asPt,nNumPt,nColRaw);  break;
+    case GSLC_RASTER_FMT_16:  gslc_RasterPoints16(pRaster,asPt,nNumPt,nColRaw); break;
+    case GSLC_RASTER_FMT_24:  gslc_RasterPoints24(pRaster,asPt,nNumPt,nColRaw); break;
+    case GSLC_RASTER_FMT_32:  gslc_RasterPoints32(pRaster,asPt,nNumPt,nColRaw); break;
+    default: break;
+  }
+}
+
+void gslc_RasterFillSpan(gslc_tsRaster* pRaster,int16_t nX,int16_t nY,uint16_t nW,uint32_t nColRaw)
+{
+  gslc_RasterFillRect(pRaster,(gslc_tsRect){nX,nY,nW,1},nColRaw);
+}
+
+void gslc_RasterFillRect(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint32_t nColRaw)
+{
+  if ((rRect.w == 0) || (rRect.h == 0)) { return; }
+  if (!gslc_ClipRect(&pRaster->rClip,&rRect)) { return; }
+  switch (pRaster->eFmt) {
+    case GSLC_RASTER_FMT_1:   gslc_RasterFillRect1(pRaster,rRect,nColRaw);  break;
+    case GSLC_RASTER_FMT_8:   gslc_RasterFillRect8(pRaster,rRect,nColRaw);  break;
+    case GSLC_RASTER_FMT_16:  gslc_RasterFillRect16(pRaster,rRect,nColRaw); break;
+    case GSLC_RASTER_FMT_24:  gslc_RasterFillRect24(pRaster,rRect,nColRaw); break;
+    case GSLC_RASTER_FMT_32:  gslc_RasterFillRect32(pRaster,rRect,nColRaw); break;
+    default: break;
+  }
+}
+
+void gslc_RasterFrameRect(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint32_t nColRaw)
+{
+  if ((rRect.w == 0) || (rRect.h == 0)) { return; }
+  int16_t nX1 = rRect.x + rRect.w - 1;
+  int16_t nY1 = rRect.y + rRect.h - 1;
+  // Each edge is clipped independently
+  gslc_RasterFillRect(pRaster,(gslc_tsRect){rRect.x,rRect.y,rRect.w,1},nColRaw);
+  gslc_RasterFillRect(pRaster,(gslc_tsRect){rRect.x,nY1,rRect.w,1},nColRaw);
+  if (rRect.h > 2) {
+    gslc_RasterFillRect(pRaster,(gslc_tsRect){rRect.x,rRect.y+1,1,rRect.h-2},nColRaw);
+    gslc_RasterFillRect(pRaster,(gslc_tsRect){nX1,rRect.y+1,1,rRect.h-2},nColRaw);
+  }
+}
+
+void gslc_RasterLine(gslc_tsRaster* pRaster,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,uint32_t nColRaw)
+{
+  // Skip lines that are entirely outside of the clipping region.
+  // The endpoints are not moved to the clip boundary so that the
+  // visible pixels are identical to those of the unclipped line.
+  gslc_tsRect rBound;
+  rBound.x = (nX0 < nX1)? nX0 : nX1;
+  rBound.y = (nY0 < nY1)? nY0 : nY1;
+  rBound.w = abs(nX1-nX0)+1;
+  rBound.h = abs(nY1-nY0)+1;
+  if (!gslc_IsRectOverlap(rBound,pRaster->rClip)) { return; }
+  switch (pRaster->eFmt) {
+    case GSLC_RASTER_FMT_1:   gslc_RasterLine1(pRaster,nX0,nY0,nX1,nY1,nColRaw);  break;
+    case GSLC_RASTER_FMT_8:   gslc_RasterLine8(pRaster,nX0,nY0,nX1,nY1,nColRaw);  break;
+    case GSLC_RASTER_FMT_16:  gslc_RasterLine16(pRaster,nX0,nY0,nX1,nY1,nColRaw); break;
+    case GSLC_RASTER_FMT_24:  gslc_RasterLine24(pRaster,nX0,nY0,nX1,nY1,nColRaw); break;
+    case GSLC_RASTER_FMT_32:  gslc_RasterLine32(pRaster,nX0,nY0,nX1,nY1,nColRaw); break;
+    default: break;
+  }
+}
+
+void gslc_RasterFrameCircle(gslc_tsRaster* pRaster,int16_t nMidX,int16_t nMidY,uint16_t nRadius,uint32_t nColRaw)
+{
+  // Skip circles that are entirely outside of the clipping region
+  gslc_tsRect rBound = {nMidX-nRadius,nMidY-nRadius,2*nRadius+1,2*nRadius+1};
+  if (!gslc_IsRectOverlap(rBound,pRaster->rClip)) { return; }
+  switch (pRaster->eFmt) {
+    case GSLC_RASTER_FMT_1:   gslc_RasterFrameCircle1(pRaster,nMidX,nMidY,nRadius,nColRaw);  break;
+    case GSLC_RASTER_FMT_8:   gslc_RasterFrameCircle8(pRaster,nMidX,nMidY,nRadius,nColRaw);  break;
+    case GSLC_RASTER_FMT_16:  gslc_RasterFrameCircle16(pRaster,nMidX,nMidY,nRadius,nColRaw); break;
+    case GSLC_RASTER_FMT_24:  gslc_RasterFrameCircle24(pRaster,nMidX,nMidY,nRadius,nColRaw); break;
+    case GSLC_RASTER_FMT_32:  gslc_RasterFrameCircle32(pRaster,nMidX,nMidY,nRadius,nColRaw); break;
+    default: break;
+  }
+}
+
+void gslc_RasterLineAA(gslc_tsRaster* pRaster,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,uint32_t nColRaw)
+{
+  // Skip lines that are entirely outside of the clipping region,
+  // allowing for the pixels blended beside the line
+  gslc_tsRect rBound;
+  rBound.x = ((nX0 < nX1)? nX0 : nX1) - 1;
+  rBound.y = ((nY0 < nY1)? nY0 : nY1) - 1;
+  rBound.w = abs(nX1-nX0)+3;
+  rBound.h = abs(nY1-nY0)+3;
+  if (!gslc_IsRectOverlap(rBound,pRaster->rClip)) { return; }
+  switch (pRaster->eFmt) {
+    case GSLC_RASTER_FMT_8:   gslc_RasterLineAA8(pRaster,nX0,nY0,nX1,nY1,nColRaw);  break;
+    case GSLC_RASTER_FMT_16:  gslc_RasterLineAA16(pRaster,nX0,nY0,nX1,nY1,nColRaw); break;
+    case GSLC_RASTER_FMT_24:  gslc_RasterLineAA24(pRaster,nX0,nY0,nX1,nY1,nColRaw); break;
+    case GSLC_RASTER_FMT_32:  gslc_RasterLineAA32(pRaster,nX0,nY0,nX1,nY1,nColRaw); break;
+    default: break;
+  }
+}
+
+void gslc_RasterFillRectAlpha(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint32_t nColRaw,uint8_t nAlpha)
+{
+  if ((rRect.w == 0) || (rRect.h == 0) || (nAlpha == 0)) { return; }
+  if (!gslc_ClipRect(&pRaster->rClip,&rRect)) { return; }
+  switch (pRaster->eFmt) {
+    case GSLC_RASTER_FMT_8:   gslc_RasterFillRectAlpha8(pRaster,rRect,nColRaw,nAlpha);  break;
+    case GSLC_RASTER_FMT_16:  gslc_RasterFillRectAlpha16(pRaster,rRect,nColRaw,nAlpha); break;
+    case GSLC_RASTER_FMT_24:  gslc_RasterFillRectAlpha24(pRaster,rRect,nColRaw,nAlpha); break;
+    case GSLC_RASTER_FMT_32:  gslc_RasterFillRectAlpha32(pRaster,rRect,nColRaw,nAlpha); break;
+    default: break;
+  }
+}
+
+void gslc_RasterFrameCircleAA(gslc_tsRaster* pRaster,int16_t nMidX,int16_t nMidY,uint16_t nRadius,uint32_t nColRaw)
+{
+  // Skip circles that are entirely outside of the clipping region,
+  // allowing for the pixels blended outside the circle
+  gslc_tsRect rBound = {nMidX-nRadius-1,nMidY-nRadius-1,2*nRadius+3,2*nRadius+3};
+  if (!gslc_IsRectOverlap(rBound,pRaster->rClip)) { return; }
+  // The fixed point calculation is limited to a radius of 2047
+  if (nRadius >= 2048) {
+    gslc_RasterFrameCircle(pRaster,nMidX,nMidY,nRadius,nColRaw);
+    return;
+  }
+  switch (pRaster->eFmt) {
+    case GSLC_RASTER_FMT_8:   gslc_RasterFrameCircleAA8(pRaster,nMidX,nMidY,nRadius,nColRaw);  break;
+    case GSLC_RASTER_FMT_16:  gslc_RasterFrameCircleAA16(pRaster,nMidX,nMidY,nRadius,nColRaw); break;
+    case GSLC_RASTER_FMT_24:  gslc_RasterFrameCircleAA24(pRaster,nMidX,nMidY,nRadius,nColRaw); break;
+    case GSLC_RASTER_FMT_32:  gslc_RasterFrameCircleAA32(pRaster,nMidX,nMidY,nRadius,nColRaw); break;
+    default: break;
+  }
+}
+
+void gslc_RasterBlit(gslc_tsRaster* pRaster,int16_t nDstX,int16_t nDstY,const uint8_t* pSrc,uint16_t nSrcPitch,uint16_t nSrcW,uint16_t nSrcH)
+{
+  gslc_tsRect rDst = {nDstX,nDstY,nSrcW,nSrcH};
+  if ((nSrcW == 0) || (nSrcH == 0)) { return; }
+  if (!gslc_ClipRect(&pRaster->rClip,&rDst)) { return; }
+
+  // Skip the source rows and columns that were clipped
+  uint16_t nSrcX = rDst.x - nDstX;
+  pSrc += (size_t)(rDst.y - nDstY) * nSrcPitch;
+  switch (pRaster->eFmt) {
+    case GSLC_RASTER_FMT_1:   gslc_RasterBlit1(pRaster,rDst.x,rDst.y,pSrc,nSrcPitch,nSrcX,rDst.w,rDst.h);  break;
+    case GSLC_RASTER_FMT_8:   gslc_RasterBlit8(pRaster,rDst.x,rDst.y,pSrc,nSrcPitch,nSrcX,rDst.w,rDst.h);  break;
+    case GSLC_RASTER_FMT_16:  gslc_RasterBlit16(pRaster,rDst.x,rDst.y,pSrc,nSrcPitch,nSrcX,rDst.w,rDst.h); break;
+    case GSLC_RASTER_FMT_24:  gslc_RasterBlit24(pRaster,rDst.x,rDst.y,pSrc,nSrcPitch,nSrcX,rDst.w,rDst.h); break;
+    case GSLC_RASTER_FMT_32:  gslc_RasterBlit32(pRaster,rDst.x,rDst.y,pSrc,nSrcPitch,nSrcX,rDst.w,rDst.h); break;
+    default: break;
+  }
+}
+
+uint16_t gslc_RasterRowBytes(gslc_tsRaster* pRaster,uint16_t nW)
+{
+  switch (pRaster->eFmt) {
+    case GSLC_RASTER_FMT_1:   return (nW+7)/8;
+    case GSLC_RASTER_FMT_8:   return nW;
+    case GSLC_RASTER_FMT_16:  return nW*2;
+    case GSLC_RASTER_FMT_24:  return nW*3;
+    case GSLC_RASTER_FMT_32:  return nW*4;
+    default:                  return 0;
+  }
+}
+
+bool gslc_RasterCopyOut(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint8_t* pDst)
+{
+  gslc_tsRect rBuf = {0,0,pRaster->nW,pRaster->nH};
+  uint16_t    nRowBytes = gslc_RasterRowBytes(pRaster,rRect.w);
+  uint16_t    nRow,nCol;
+  if ((rRect.w == 0) || (rRect.h == 0) || (!gslc_IsRectInRect(rRect,rBuf))) {
+    return false;
+  }
+  if (pRaster->eFmt == GSLC_RASTER_FMT_1) {
+    // Realign the bits so that each row starts at the first bit
+    for (nRow=0;nRow<rRect.h;nRow++) {
+      memset(pDst,0,nRowBytes);
+      for (nCol=0;nCol<rRect.w;nCol++) {
+        if (gslc_RasterGetPixel1(pRaster,rRect.x+nCol,rRect.y+nRow)) {
+          pDst[nCol >> 3] |= 0x80 >> (nCol & 7);
+        }
+      }
+      pDst += nRowBytes;
+    }
+    return true;
+  }
+  const uint8_t* pSrc = GSLC_RASTER_ADDR(pRaster,0,rRect.y,0) + gslc_RasterRowBytes(pRaster,rRect.x);
+  for (nRow=0;nRow<rRect.h;nRow++) {
+    gslc_SimdCopy(pDst,pSrc,nRowBytes);
+    pDst += nRowBytes;
+    pSrc += pRaster->nPitch;
+  }
+  return true;
+}
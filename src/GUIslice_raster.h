@@ -0,0 +1,437 @@
+#ifndef _GUISLICE_RASTER_H_
+#define _GUISLICE_RASTER_H_
+
+// =======================================================================
+// GUIslice library (software rasterizer)
+// - Calvin Hass
+// - http://www.impulseadventure.com/elec/guislice-gui.html
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2017 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+
+
+// =======================================================================
+// Software rasterizer
+// - Draws graphics primitives directly into a pixel buffer
+// - Used by the drivers that render in software (SDL1, in-memory)
+// - The drawing routines are specialized for each pixel format at
+//   compile time. The format is resolved once per primitive so
+//   that the inner pixel loops contain no format dispatch.
+// =======================================================================
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include "GUIslice.h"
+#include "GUIslice_simd.h"
+
+
+/// Pixel formats supported by the rasterizer
+/// - Raw pixel values are passed as uint32_t in the native
+///   pixel layout of the buffer
+typedef enum {
+  GSLC_RASTER_FMT_NONE = 0, ///< Unsupported format
+  GSLC_RASTER_FMT_1,        ///< 1bpp monochrome, eight pixels per byte (MSB is leftmost)
+  GSLC_RASTER_FMT_8,        ///< 8bpp, one byte per pixel
+  GSLC_RASTER_FMT_16,       ///< 16bpp, one native-endian uint16_t per pixel
+  GSLC_RASTER_FMT_24,       ///< 24bpp, three bytes per pixel (least significant byte first)
+  GSLC_RASTER_FMT_32,       ///< 32bpp, one native-endian uint32_t per pixel
+} gslc_teRasterFmt;
+
+/// Number of bits of coverage used by the anti-aliased primitives
+#define GSLC_RASTER_COV_BITS  5
+/// Number of coverage levels used by the anti-aliased primitives
+#define GSLC_RASTER_COV_LEVELS  (1 << GSLC_RASTER_COV_BITS)
+
+
+/// Raster target
+typedef struct {
+  uint8_t*          pPixels;    ///< Pointer to top-left pixel of buffer
+  uint16_t          nPitch;     ///< Bytes per row of buffer
+  int16_t           nW;         ///< Width of buffer (pixels)
+  int16_t           nH;         ///< Height of buffer (pixels)
+  gslc_teRasterFmt  eFmt;       ///< Pixel format of buffer
+  gslc_tsRect       rClip;      ///< Clipping region (always within the buffer)
+  uint8_t           anChanShift[3]; ///< Bit position of the R,G,B channels in a raw pixel
+  uint8_t           anChanBits[3];  ///< Bit width of the R,G,B channels (0 if blending unsupported)
+  uint32_t          nBlendMaskO;    ///< Mask of the lowest and highest channels
+  uint32_t          nBlendMaskM;    ///< Mask of the middle channel
+  bool              bBlendPacked;   ///< Channels can be blended in groups (see gslc_RasterSetChannels)
+} gslc_tsRaster;
+
+
+// =======================================================================
+// Public APIs
+// - These functions perform clipping and then dispatch to the
+//   routine specialized for the pixel format of the raster
+// =======================================================================
+
+///
+/// Initialize a raster target
+/// - The clipping region is reset to the entire buffer
+/// - Selects the vectorized kernels used for fills and copies
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  pPixels:     Pointer to pixel buffer
+/// \param[in]  nPitch:      Bytes per row of pixel buffer
+/// \param[in]  nW:          Width of pixel buffer
+/// \param[in]  nH:          Height of pixel buffer
+/// \param[in]  eFmt:        Pixel format
+///
+/// \return true if success, false if the format is not supported
+///
+bool gslc_RasterInit(gslc_tsRaster* pRaster,uint8_t* pPixels,uint16_t nPitch,int16_t nW,int16_t nH,gslc_teRasterFmt eFmt);
+
+///
+/// Update the pixel buffer of a raster target
+/// - Used if the buffer can move (eg. after a surface lock)
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  pPixels:     Pointer to pixel buffer
+///
+/// \return none
+///
+void gslc_RasterSetBuf(gslc_tsRaster* pRaster,uint8_t* pPixels);
+
+///
+/// Get the pixel format for a bit depth
+///
+/// \param[in]  nBpp:        Bits per pixel
+///
+/// \return Pixel format or GSLC_RASTER_FMT_NONE if not supported
+///
+gslc_teRasterFmt gslc_RasterGetFmt(uint8_t nBpp);
+
+///
+/// Set the clipping region
+/// - The region is constrained to the buffer
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  pRect:       Clipping region or NULL for the entire buffer
+///
+/// \return none
+///
+void gslc_RasterSetClip(gslc_tsRaster* pRaster,gslc_tsRect* pRect);
+
+///
+/// Describe the color channels of a raw pixel
+/// - Required by the blending (anti-aliased) primitives, which
+///   are unavailable until the channels have been described
+/// - Not supported by the 1bpp format
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  nShiftR:     Bit position of red channel
+/// \param[in]  nBitsR:      Bit width of red channel
+/// \param[in]  nShiftG:     Bit position of green channel
+/// \param[in]  nBitsG:      Bit width of green channel
+/// \param[in]  nShiftB:     Bit position of blue channel
+/// \param[in]  nBitsB:      Bit width of blue channel
+///
+/// \return none
+///
+void gslc_RasterSetChannels(gslc_tsRaster* pRaster,uint8_t nShiftR,uint8_t nBitsR,
+  uint8_t nShiftG,uint8_t nBitsG,uint8_t nShiftB,uint8_t nBitsB);
+
+///
+/// Determine whether the raster supports blending
+///
+/// \param[in]  pRaster:     Pointer to raster
+///
+/// \return true if the anti-aliased primitives are available
+///
+bool gslc_RasterCanBlend(gslc_tsRaster* pRaster);
+
+///
+/// Set a single pixel (clipped)
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  nX:          X coordinate
+/// \param[in]  nY:          Y coordinate
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_RasterSetPixel(gslc_tsRaster* pRaster,int16_t nX,int16_t nY,uint32_t nColRaw);
+
+///
+/// Get a single pixel
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  nX:          X coordinate
+/// \param[in]  nY:          Y coordinate
+///
+/// \return Raw pixel value or 0 if outside the buffer
+///
+uint32_t gslc_RasterGetPixel(gslc_tsRaster* pRaster,int16_t nX,int16_t nY);
+
+///
+/// Set an array of pixels (clipped)
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  asPt:        Array of points
+/// \param[in]  nNumPt:      Number of points in array
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_RasterPoints(gslc_tsRaster* pRaster,gslc_tsPt* asPt,uint16_t nNumPt,uint32_t nColRaw);
+
+///
+/// Fill a horizontal span (clipped)
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  nX:          X coordinate of leftmost pixel
+/// \param[in]  nY:          Y coordinate
+/// \param[in]  nW:          Width of span
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_RasterFillSpan(gslc_tsRaster* pRaster,int16_t nX,int16_t nY,uint16_t nW,uint32_t nColRaw);
+
+///
+/// Fill a rectangle (clipped)
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  rRect:       Rectangle to fill
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_RasterFillRect(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint32_t nColRaw);
+
+///
+/// Frame a rectangle (clipped)
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  rRect:       Rectangle to frame
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_RasterFrameRect(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint32_t nColRaw);
+
+///
+/// Draw a line (clipped)
+/// - Uses the same stepping as the core line emulation
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  nX0:         Line start (X coordinate)
+/// \param[in]  nY0:         Line start (Y coordinate)
+/// \param[in]  nX1:         Line finish (X coordinate)
+/// \param[in]  nY1:         Line finish (Y coordinate)
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_RasterLine(gslc_tsRaster* pRaster,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,uint32_t nColRaw);
+
+///
+/// Frame a circle (clipped)
+/// - Uses the same stepping as the core circle emulation
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  nMidX:       Center of circle (X coordinate)
+/// \param[in]  nMidY:       Center of circle (Y coordinate)
+/// \param[in]  nRadius:     Radius of circle
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_RasterFrameCircle(gslc_tsRaster* pRaster,int16_t nMidX,int16_t nMidY,uint16_t nRadius,uint32_t nColRaw);
+
+///
+/// Draw an anti-aliased line (clipped)
+/// - Uses Wu's algorithm: each step blends the pair of pixels
+///   that straddle the ideal line according to their coverage
+/// - Requires blending support (see gslc_RasterCanBlend())
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  nX0:         Line start (X coordinate)
+/// \param[in]  nY0:         Line start (Y coordinate)
+/// \param[in]  nX1:         Line finish (X coordinate)
+/// \param[in]  nY1:         Line finish (Y coordinate)
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_RasterLineAA(gslc_tsRaster* pRaster,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,uint32_t nColRaw);
+
+///
+/// Frame an anti-aliased circle (clipped)
+/// - Uses Wu's algorithm: each step blends the pair of pixels
+///   that straddle the ideal circle according to their coverage
+/// - Requires blending support (see gslc_RasterCanBlend())
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  nMidX:       Center of circle (X coordinate)
+/// \param[in]  nMidY:       Center of circle (Y coordinate)
+/// \param[in]  nRadius:     Radius of circle
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_RasterFrameCircleAA(gslc_tsRaster* pRaster,int16_t nMidX,int16_t nMidY,uint16_t nRadius,uint32_t nColRaw);
+
+///
+/// Blend a filled rectangle with the existing pixels (clipped)
+/// - Requires blending support (see gslc_RasterCanBlend())
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nColRaw:     Raw pixel value
+/// \param[in]  nAlpha:      Opacity of the fill (0 = invisible, 255 = opaque)
+///
+/// \return none
+///
+void gslc_RasterFillRectAlpha(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint32_t nColRaw,uint8_t nAlpha);
+
+///
+/// Copy a block of pixels into the raster (clipped)
+/// - The source must have the same pixel format as the raster
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  nDstX:       Destination X coordinate
+/// \param[in]  nDstY:       Destination Y coordinate
+/// \param[in]  pSrc:        Pointer to top-left source pixel
+/// \param[in]  nSrcPitch:   Bytes per row of source
+/// \param[in]  nSrcW:       Width of source (pixels)
+/// \param[in]  nSrcH:       Height of source (pixels)
+///
+/// \return none
+///
+void gslc_RasterBlit(gslc_tsRaster* pRaster,int16_t nDstX,int16_t nDstY,const uint8_t* pSrc,uint16_t nSrcPitch,uint16_t nSrcW,uint16_t nSrcH);
+
+///
+/// Determine the number of bytes needed to store a row of pixels
+/// in the raster's pixel format
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  nW:          Width of row (pixels)
+///
+/// \return Number of bytes
+///
+uint16_t gslc_RasterRowBytes(gslc_tsRaster* pRaster,uint16_t nW);
+
+///
+/// Copy a block of pixels out of the raster
+/// - The block is stored in the raster's pixel format with rows of
+///   gslc_RasterRowBytes() bytes, so that it can be restored with
+///   gslc_RasterBlit()
+/// - The clipping region is ignored
+///
+/// \param[in]  pRaster:     Pointer to raster
+/// \param[in]  rRect:       Region to copy
+/// \param[out] pDst:        Pointer to destination buffer
+///
+/// \return true if success, false if the region isn't within the buffer
+///
+bool gslc_RasterCopyOut(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint8_t* pDst);
+
+
+// =======================================================================
+// Private Functions
+// - Format-specialized routines, generated for each pixel format
+//   (suffix is the bits per pixel). They expect the coordinates to
+//   have been clipped already, with the exception of the points,
+//   line and circle routines which test each pixel against the clip.
+// - The blit source starts at column nSrcX of the row at pSrc
+// =======================================================================
+
+#define GSLC_RASTER_DECLARE(BPP) \
+  void      gslc_RasterSetPixel##BPP(gslc_tsRaster* pRaster,int16_t nX,int16_t nY,uint32_t nColRaw); \
+  uint32_t  gslc_RasterGetPixel##BPP(gslc_tsRaster* pRaster,int16_t nX,int16_t nY); \
+  void      gslc_RasterPoints##BPP(gslc_tsRaster* pRaster,gslc_tsPt* asPt,uint16_t nNumPt,uint32_t nColRaw); \
+  void      gslc_RasterFillSpan##BPP(gslc_tsRaster* pRaster,int16_t nX,int16_t nY,uint16_t nW,uint32_t nColRaw); \
+  void      gslc_RasterFillRect##BPP(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint32_t nColRaw); \
+  void      gslc_RasterLine##BPP(gslc_tsRaster* pRaster,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,uint32_t nColRaw); \
+  void      gslc_RasterFrameCircle##BPP(gslc_tsRaster* pRaster,int16_t nMidX,int16_t nMidY,uint16_t nRadius,uint32_t nColRaw); \
+  void      gslc_RasterBlit##BPP(gslc_tsRaster* pRaster,int16_t nDstX,int16_t nDstY,const uint8_t* pSrc,uint16_t nSrcPitch,uint16_t nSrcX,uint16_t nW,uint16_t nH);
+
+GSLC_RASTER_DECLARE(1)
+GSLC_RASTER_DECLARE(8)
+GSLC_RASTER_DECLARE(16)
+GSLC_RASTER_DECLARE(24)
+GSLC_RASTER_DECLARE(32)
+
+// Anti-aliased routines (not available for the 1bpp format)
+#define GSLC_RASTER_DECLARE_AA(BPP) \
+  void      gslc_RasterLineAA##BPP(gslc_tsRaster* pRaster,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,uint32_t nColRaw); \
+  void      gslc_RasterFrameCircleAA##BPP(gslc_tsRaster* pRaster,int16_t nMidX,int16_t nMidY,uint16_t nRadius,uint32_t nColRaw); \
+  void      gslc_RasterFillRectAlpha##BPP(gslc_tsRaster* pRaster,gslc_tsRect rRect,uint32_t nColRaw,uint8_t nAlpha);
+
+GSLC_RASTER_DECLARE_AA(8)
+GSLC_RASTER_DECLARE_AA(16)
+GSLC_RASTER_DECLARE_AA(24)
+GSLC_RASTER_DECLARE_AA(32)
+
+///
+/// Blend a raw pixel value over another
+///
+/// \param[in]  pRaster:     Pointer to raster (describes the channels)
+/// \param[in]  nSrc:        Raw pixel value to blend
+/// \param[in]  nDst:        Raw pixel value of the destination
+/// \param[in]  nAlpha:      Opacity of nSrc (0..255)
+///
+/// \return Blended raw pixel value
+///
+uint32_t gslc_RasterBlendRaw(gslc_tsRaster* pRaster,uint32_t nSrc,uint32_t nDst,uint8_t nAlpha);
+
+///
+/// Blend a 16bpp raw pixel value over another, with the channels
+/// spread across a 32-bit word so that they are blended together
+/// - The middle channel is moved up by 16 bits
+///
+/// \param[in]  nSrcSpread:  Spread raw pixel value to blend
+/// \param[in]  nDst:        Raw pixel value of the destination
+/// \param[in]  nMaskO:      Mask of the lowest and highest channels
+/// \param[in]  nMaskM:      Mask of the middle channel
+/// \param[in]  nAlpha:      Opacity of the source (0..255)
+///
+/// \return Blended raw pixel value
+///
+uint32_t gslc_RasterMixSpread(uint32_t nSrcSpread,uint32_t nDst,uint32_t nMaskO,uint32_t nMaskM,uint8_t nAlpha);
+
+///
+/// Blend a raw pixel value over another, with the outer channels
+/// and the middle channel each blended as a group
+///
+/// \param[in]  nSrcO:       Outer channels of the raw pixel value to blend
+/// \param[in]  nSrcM:       Middle channel of the raw pixel value to blend
+/// \param[in]  nDst:        Raw pixel value of the destination
+/// \param[in]  nMaskO:      Mask of the lowest and highest channels
+/// \param[in]  nMaskM:      Mask of the middle channel
+/// \param[in]  nAlpha:      Opacity of the source (0..255)
+///
+/// \return Blended raw pixel value
+///
+uint32_t gslc_RasterMixGroups(uint32_t nSrcO,uint32_t nSrcM,uint32_t nDst,uint32_t nMaskO,uint32_t nMaskM,uint8_t nAlpha);
+
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // _GUISLICE_RASTER_H_
@@ -0,0 +1,509 @@
+// =======================================================================
+// GUIslice library (vectorized pixel kernels)
+// - Calvin Hass
+// - http://www.impulseadventure.com/elec/guislice-gui.html
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2017 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+
+
+// GUIslice library
+#include "GUIslice_simd.h"
+
+#include <string.h>
+
+#if defined(GSLC_SIMD_X86)
+  #include <immintrin.h>
+#endif
+#if defined(GSLC_SIMD_NEON)
+  #include <arm_neon.h>
+  #if defined(__arm__) && defined(__linux__)
+    #include <sys/auxv.h>
+    #ifndef HWCAP_NEON
+      #define HWCAP_NEON (1 << 12)
+    #endif
+  #endif
+#endif
+
+
+// Active kernels
+// - Defaults to the scalar kernels until gslc_SimdInit() is called
+static gslc_tsSimd m_sSimd = {
+  { GSLC_SIMD_NONE, GSLC_SIMD_NONE, GSLC_SIMD_NONE },
+  &gslc_SimdFill16_C,
+  &gslc_SimdFill32_C,
+  &gslc_SimdCopy_C,
+};
+
+// Order of preference of the instruction sets for each kernel
+// - Based on tests/test-simd. On x86 the AVX2 copy was the fastest
+//   for 16bpp rows and level with memcpy() for 32bpp rows, while
+//   the SSE2 copy was level with memcpy() for both, so the copy
+//   only prefers AVX2 over the C library.
+// - The list ends with GSLC_SIMD_NONE, which is always supported
+static const gslc_teSimd m_aaeSimdPref[GSLC_SIMD_K_CNT][GSLC_SIMD_CNT] = {
+  { GSLC_SIMD_AVX2, GSLC_SIMD_SSE2, GSLC_SIMD_NEON, GSLC_SIMD_NONE }, // GSLC_SIMD_K_FILL16
+  { GSLC_SIMD_AVX2, GSLC_SIMD_SSE2, GSLC_SIMD_NEON, GSLC_SIMD_NONE }, // GSLC_SIMD_K_FILL32
+  { GSLC_SIMD_AVX2, GSLC_SIMD_NONE, GSLC_SIMD_NONE, GSLC_SIMD_NONE }, // GSLC_SIMD_K_COPY
+};
+
+
+// =======================================================================
+// Public APIs
+// =======================================================================
+
+void gslc_SimdInit(void)
+{
+  int16_t nKernel;
+  for (nKernel=0;nKernel<GSLC_SIMD_K_CNT;nKernel++) {
+    gslc_SimdSelectKernel((gslc_teSimdKernel)nKernel,gslc_SimdGetDefault((gslc_teSimdKernel)nKernel));
+  }
+}
+
+bool gslc_SimdIsSupported(gslc_teSimd eSimd)
+{
+  switch (eSimd) {
+    case GSLC_SIMD_NONE:
+      return true;
+
+#if defined(GSLC_SIMD_X86)
+    case GSLC_SIMD_SSE2:
+    #if defined(__x86_64__)
+      // SSE2 is part of the x86-64 baseline
+      return true;
+    #else
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("sse2");
+    #endif
+
+    case GSLC_SIMD_AVX2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+#endif // GSLC_SIMD_X86
+
+#if defined(GSLC_SIMD_NEON)
+    case GSLC_SIMD_NEON:
+    #if defined(__arm__) && defined(__linux__)
+      // NEON is optional on 32-bit ARM, so confirm with the kernel
+      return (getauxval(AT_HWCAP) & HWCAP_NEON) != 0;
+    #else
+      // NEON is mandatory on AArch64
+      return true;
+    #endif
+#endif // GSLC_SIMD_NEON
+
+    default:
+      return false;
+  }
+}
+
+bool gslc_SimdSelect(gslc_teSimd eSimd)
+{
+  int16_t nKernel;
+  if (!gslc_SimdIsSupported(eSimd)) {
+    return false;
+  }
+  for (nKernel=0;nKernel<GSLC_SIMD_K_CNT;nKernel++) {
+    gslc_SimdSelectKernel((gslc_teSimdKernel)nKernel,eSimd);
+  }
+  return true;
+}
+
+bool gslc_SimdSelectKernel(gslc_teSimdKernel eKernel,gslc_teSimd eSimd)
+{
+  GSLC_CB_SIMD_FILL16 pfuncFill16 = &gslc_SimdFill16_C;
+  GSLC_CB_SIMD_FILL32 pfuncFill32 = &gslc_SimdFill32_C;
+  GSLC_CB_SIMD_COPY   pfuncCopy   = &gslc_SimdCopy_C;
+  if ((eKernel >= GSLC_SIMD_K_CNT) || (!gslc_SimdIsSupported(eSimd))) {
+    return false;
+  }
+  switch (eSimd) {
+#if defined(GSLC_SIMD_X86)
+    case GSLC_SIMD_SSE2:
+      pfuncFill16 = &gslc_SimdFill16_SSE2;
+      pfuncFill32 = &gslc_SimdFill32_SSE2;
+      pfuncCopy   = &gslc_SimdCopy_SSE2;
+      break;
+    case GSLC_SIMD_AVX2:
+      pfuncFill16 = &gslc_SimdFill16_AVX2;
+      pfuncFill32 = &gslc_SimdFill32_AVX2;
+      pfuncCopy   = &gslc_SimdCopy_AVX2;
+      break;
+#endif
+#if defined(GSLC_SIMD_NEON)
+    case GSLC_SIMD_NEON:
+      pfuncFill16 = &gslc_SimdFill16_NEON;
+      pfuncFill32 = &gslc_SimdFill32_NEON;
+      pfuncCopy   = &gslc_SimdCopy_NEON;
+      break;
+#endif
+    default:
+      break;
+  }
+  switch (eKernel) {
+    case GSLC_SIMD_K_FILL16:  m_sSimd.pfuncFill16 = pfuncFill16; break;
+    case GSLC_SIMD_K_FILL32:  m_sSimd.pfuncFill32 = pfuncFill32; break;
+    case GSLC_SIMD_K_COPY:    m_sSimd.pfuncCopy   = pfuncCopy;   break;
+    default:                  break;
+  }
+  m_sSimd.aeSimd[eKernel] = eSimd;
+  return true;
+}
+
+gslc_teSimd gslc_SimdGetActive(gslc_teSimdKernel eKernel)
+{
+  if (eKernel >= GSLC_SIMD_K_CNT) {
+    return GSLC_SIMD_NONE;
+  }
+  return m_sSimd.aeSimd[eKernel];
+}
+
+gslc_teSimd gslc_SimdGetDefault(gslc_teSimdKernel eKernel)
+{
+  int16_t nInd;
+  if (eKernel >= GSLC_SIMD_K_CNT) {
+    return GSLC_SIMD_NONE;
+  }
+  for (nInd=0;nInd<GSLC_SIMD_CNT;nInd++) {
+    if (gslc_SimdIsSupported(m_aaeSimdPref[eKernel][nInd])) {
+      return m_aaeSimdPref[eKernel][nInd];
+    }
+  }
+  return GSLC_SIMD_NONE;
+}
+
+const char* gslc_SimdGetName(gslc_teSimd eSimd)
+{
+  switch (eSimd) {
+    case GSLC_SIMD_NONE:  return "Scalar";
+    case GSLC_SIMD_SSE2:  return "SSE2";
+    case GSLC_SIMD_AVX2:  return "AVX2";
+    case GSLC_SIMD_NEON:  return "NEON";
+    default:              return "?";
+  }
+}
+
+void gslc_SimdFill16(uint16_t* pDst,uint32_t nCnt,uint16_t nVal)
+{
+  (*m_sSimd.pfuncFill16)(pDst,nCnt,nVal);
+}
+
+void gslc_SimdFill32(uint32_t* pDst,uint32_t nCnt,uint32_t nVal)
+{
+  (*m_sSimd.pfuncFill32)(pDst,nCnt,nVal);
+}
+
+void gslc_SimdFillRect16(uint8_t* pDst,uint32_t nPitch,uint32_t nW,uint32_t nH,uint16_t nVal)
+{
+  GSLC_CB_SIMD_FILL16 pfuncFill16 = m_sSimd.pfuncFill16;
+  for (;nH > 0;nH--,pDst += nPitch) {
+    (*pfuncFill16)((uint16_t*)pDst,nW,nVal);
+  }
+}
+
+void gslc_SimdFillRect32(uint8_t* pDst,uint32_t nPitch,uint32_t nW,uint32_t nH,uint32_t nVal)
+{
+  GSLC_CB_SIMD_FILL32 pfuncFill32 = m_sSimd.pfuncFill32;
+  for (;nH > 0;nH--,pDst += nPitch) {
+    (*pfuncFill32)((uint32_t*)pDst,nW,nVal);
+  }
+}
+
+void gslc_SimdCopy(uint8_t* pDst,const uint8_t* pSrc,uint32_t nLen)
+{
+  (*m_sSimd.pfuncCopy)(pDst,pSrc,nLen);
+}
+
+void gslc_SimdCopyRect(uint8_t* pDst,uint32_t nDstPitch,const uint8_t* pSrc,uint32_t nSrcPitch,uint32_t nLen,uint32_t nH)
+{
+  GSLC_CB_SIMD_COPY pfuncCopy = m_sSimd.pfuncCopy;
+  for (;nH > 0;nH--,pDst += nDstPitch,pSrc += nSrcPitch) {
+    (*pfuncCopy)(pDst,pSrc,nLen);
+  }
+}
+
+
+// =======================================================================
+// Scalar kernels
+// =======================================================================
+
+void gslc_SimdFill16_C(uint16_t* pDst,uint32_t nCnt,uint16_t nVal)
+{
+  while (nCnt--) {
+    *pDst++ = nVal;
+  }
+}
+
+void gslc_SimdFill32_C(uint32_t* pDst,uint32_t nCnt,uint32_t nVal)
+{
+  while (nCnt--) {
+    *pDst++ = nVal;
+  }
+}
+
+void gslc_SimdCopy_C(uint8_t* pDst,const uint8_t* pSrc,uint32_t nLen)
+{
+  memcpy(pDst,pSrc,nLen);
+}
+
+
+// =======================================================================
+// x86 kernels
+// - Runs shorter than one vector are handed to the scalar kernels
+// - Otherwise the first vector is written unaligned, the main loop
+//   continues from the next vector boundary with aligned stores and
+//   a final unaligned store ends on the last element. The first and
+//   last stores may overlap the aligned ones, which is harmless for
+//   fills and for non-overlapping copies.
+// - Pixel pointers that aren't aligned to the pixel size can't reach
+//   a vector boundary, so those use the scalar kernels
+// =======================================================================
+
+#if defined(GSLC_SIMD_X86)
+
+__attribute__((target("sse2")))
+void gslc_SimdFill16_SSE2(uint16_t* pDst,uint32_t nCnt,uint16_t nVal)
+{
+  __m128i   vVal = _mm_set1_epi16((short)nVal);
+  uint16_t* pEnd = pDst + nCnt;
+  uint32_t  nSkip;
+  if ((nCnt < 8) || ((uintptr_t)pDst & 1)) {
+    gslc_SimdFill16_C(pDst,nCnt,nVal);
+    return;
+  }
+  _mm_storeu_si128((__m128i*)pDst,vVal);
+  nSkip = (16 - ((uintptr_t)pDst & 15)) / 2;
+  pDst += nSkip;
+  nCnt -= nSkip;
+  for (;nCnt >= 32;nCnt -= 32,pDst += 32) {
+    _mm_store_si128((__m128i*)(pDst+ 0),vVal);
+    _mm_store_si128((__m128i*)(pDst+ 8),vVal);
+    _mm_store_si128((__m128i*)(pDst+16),vVal);
+    _mm_store_si128((__m128i*)(pDst+24),vVal);
+  }
+  for (;nCnt >= 8;nCnt -= 8,pDst += 8) {
+    _mm_store_si128((__m128i*)pDst,vVal);
+  }
+  _mm_storeu_si128((__m128i*)(pEnd-8),vVal);
+}
+
+__attribute__((target("sse2")))
+void gslc_SimdFill32_SSE2(uint32_t* pDst,uint32_t nCnt,uint32_t nVal)
+{
+  __m128i   vVal = _mm_set1_epi32((int)nVal);
+  uint32_t* pEnd = pDst + nCnt;
+  uint32_t  nSkip;
+  if ((nCnt < 4) || ((uintptr_t)pDst & 3)) {
+    gslc_SimdFill32_C(pDst,nCnt,nVal);
+    return;
+  }
+  _mm_storeu_si128((__m128i*)pDst,vVal);
+  nSkip = (16 - ((uintptr_t)pDst & 15)) / 4;
+  pDst += nSkip;
+  nCnt -= nSkip;
+  for (;nCnt >= 16;nCnt -= 16,pDst += 16) {
+    _mm_store_si128((__m128i*)(pDst+ 0),vVal);
+    _mm_store_si128((__m128i*)(pDst+ 4),vVal);
+    _mm_store_si128((__m128i*)(pDst+ 8),vVal);
+    _mm_store_si128((__m128i*)(pDst+12),vVal);
+  }
+  for (;nCnt >= 4;nCnt -= 4,pDst += 4) {
+    _mm_store_si128((__m128i*)pDst,vVal);
+  }
+  _mm_storeu_si128((__m128i*)(pEnd-4),vVal);
+}
+
+__attribute__((target("sse2")))
+void gslc_SimdCopy_SSE2(uint8_t* pDst,const uint8_t* pSrc,uint32_t nLen)
+{
+  __m128i   vLast;
+  uint8_t*  pEnd = pDst + nLen;
+  uint32_t  nSkip;
+  if (nLen < 16) {
+    gslc_SimdCopy_C(pDst,pSrc,nLen);
+    return;
+  }
+  vLast = _mm_loadu_si128((const __m128i*)(pSrc+nLen-16));
+  _mm_storeu_si128((__m128i*)pDst,_mm_loadu_si128((const __m128i*)pSrc));
+  nSkip = 16 - ((uintptr_t)pDst & 15);
+  pDst += nSkip;
+  pSrc += nSkip;
+  nLen -= nSkip;
+  for (;nLen >= 64;nLen -= 64,pDst += 64,pSrc += 64) {
+    __m128i v0 = _mm_loadu_si128((const __m128i*)(pSrc+ 0));
+    __m128i v1 = _mm_loadu_si128((const __m128i*)(pSrc+16));
+    __m128i v2 = _mm_loadu_si128((const __m128i*)(pSrc+32));
+    __m128i v3 = _mm_loadu_si128((const __m128i*)(pSrc+48));
+    _mm_store_si128((__m128i*)(pDst+ 0),v0);
+    _mm_store_si128((__m128i*)(pDst+16),v1);
+    _mm_store_si128((__m128i*)(pDst+32),v2);
+    _mm_store_si128((__m128i*)(pDst+48),v3);
+  }
+  for (;nLen >= 16;nLen -= 16,pDst += 16,pSrc += 16) {
+    _mm_store_si128((__m128i*)pDst,_mm_loadu_si128((const __m128i*)pSrc));
+  }
+  _mm_storeu_si128((__m128i*)(pEnd-16),vLast);
+}
+
+__attribute__((target("avx2")))
+void gslc_SimdFill16_AVX2(uint16_t* pDst,uint32_t nCnt,uint16_t nVal)
+{
+  __m256i   vVal = _mm256_set1_epi16((short)nVal);
+  uint16_t* pEnd = pDst + nCnt;
+  uint32_t  nSkip;
+  if ((nCnt < 16) || ((uintptr_t)pDst & 1)) {
+    gslc_SimdFill16_SSE2(pDst,nCnt,nVal);
+    return;
+  }
+  _mm256_storeu_si256((__m256i*)pDst,vVal);
+  nSkip = (32 - ((uintptr_t)pDst & 31)) / 2;
+  pDst += nSkip;
+  nCnt -= nSkip;
+  for (;nCnt >= 64;nCnt -= 64,pDst += 64) {
+    _mm256_store_si256((__m256i*)(pDst+ 0),vVal);
+    _mm256_store_si256((__m256i*)(pDst+16),vVal);
+    _mm256_store_si256((__m256i*)(pDst+32),vVal);
+    _mm256_store_si256((__m256i*)(pDst+48),vVal);
+  }
+  for (;nCnt >= 16;nCnt -= 16,pDst += 16) {
+    _mm256_store_si256((__m256i*)pDst,vVal);
+  }
+  _mm256_storeu_si256((__m256i*)(pEnd-16),vVal);
+}
+
+__attribute__((target("avx2")))
+void gslc_SimdFill32_AVX2(uint32_t* pDst,uint32_t nCnt,uint32_t nVal)
+{
+  __m256i   vVal = _mm256_set1_epi32((int)nVal);
+  uint32_t* pEnd = pDst + nCnt;
+  uint32_t  nSkip;
+  if ((nCnt < 8) || ((uintptr_t)pDst & 3)) {
+    gslc_SimdFill32_SSE2(pDst,nCnt,nVal);
+    return;
+  }
+  _mm256_storeu_si256((__m256i*)pDst,vVal);
+  nSkip = (32 - ((uintptr_t)pDst & 31)) / 4;
+  pDst += nSkip;
+  nCnt -= nSkip;
+  for (;nCnt >= 32;nCnt -= 32,pDst += 32) {
+    _mm256_store_si256((__m256i*)(pDst+ 0),vVal);
+    _mm256_store_si256((__m256i*)(pDst+ 8),vVal);
+    _mm256_store_si256((__m256i*)(pDst+16),vVal);
+    _mm256_store_si256((__m256i*)(pDst+24),vVal);
+  }
+  for (;nCnt >= 8;nCnt -= 8,pDst += 8) {
+    _mm256_store_si256((__m256i*)pDst,vVal);
+  }
+  _mm256_storeu_si256((__m256i*)(pEnd-8),vVal);
+}
+
+__attribute__((target("avx2")))
+void gslc_SimdCopy_AVX2(uint8_t* pDst,const uint8_t* pSrc,uint32_t nLen)
+{
+  __m256i   vLast;
+  uint8_t*  pEnd = pDst + nLen;
+  uint32_t  nSkip;
+  if (nLen < 32) {
+    gslc_SimdCopy_SSE2(pDst,pSrc,nLen);
+    return;
+  }
+  vLast = _mm256_loadu_si256((const __m256i*)(pSrc+nLen-32));
+  _mm256_storeu_si256((__m256i*)pDst,_mm256_loadu_si256((const __m256i*)pSrc));
+  nSkip = 32 - ((uintptr_t)pDst & 31);
+  pDst += nSkip;
+  pSrc += nSkip;
+  nLen -= nSkip;
+  for (;nLen >= 128;nLen -= 128,pDst += 128,pSrc += 128) {
+    __m256i v0 = _mm256_loadu_si256((const __m256i*)(pSrc+ 0));
+    __m256i v1 = _mm256_loadu_si256((const __m256i*)(pSrc+32));
+    __m256i v2 = _mm256_loadu_si256((const __m256i*)(pSrc+64));
+    __m256i v3 = _mm256_loadu_si256((const __m256i*)(pSrc+96));
+    _mm256_store_si256((__m256i*)(pDst+ 0),v0);
+    _mm256_store_si256((__m256i*)(pDst+32),v1);
+    _mm256_store_si256((__m256i*)(pDst+64),v2);
+    _mm256_store_si256((__m256i*)(pDst+96),v3);
+  }
+  for (;nLen >= 32;nLen -= 32,pDst += 32,pSrc += 32) {
+    _mm256_store_si256((__m256i*)pDst,_mm256_loadu_si256((const __m256i*)pSrc));
+  }
+  _mm256_storeu_si256((__m256i*)(pEnd-32),vLast);
+}
+
+#endif // GSLC_SIMD_X86
+
+
+// =======================================================================
+// ARM kernels
+// - NEON stores have no alignment penalty that is worth the
+//   extra head handling, so these use plain loops
+// =======================================================================
+
+#if defined(GSLC_SIMD_NEON)
+
+void gslc_SimdFill16_NEON(uint16_t* pDst,uint32_t nCnt,uint16_t nVal)
+{
+  uint16x8_t vVal = vdupq_n_u16(nVal);
+  for (;nCnt >= 32;nCnt -= 32,pDst += 32) {
+    vst1q_u16(pDst+ 0,vVal);
+    vst1q_u16(pDst+ 8,vVal);
+    vst1q_u16(pDst+16,vVal);
+    vst1q_u16(pDst+24,vVal);
+  }
+  for (;nCnt >= 8;nCnt -= 8,pDst += 8) {
+    vst1q_u16(pDst,vVal);
+  }
+  gslc_SimdFill16_C(pDst,nCnt,nVal);
+}
+
+void gslc_SimdFill32_NEON(uint32_t* pDst,uint32_t nCnt,uint32_t nVal)
+{
+  uint32x4_t vVal = vdupq_n_u32(nVal);
+  for (;nCnt >= 16;nCnt -= 16,pDst += 16) {
+    vst1q_u32(pDst+ 0,vVal);
+    vst1q_u32(pDst+ 4,vVal);
+    vst1q_u32(pDst+ 8,vVal);
+    vst1q_u32(pDst+12,vVal);
+  }
+  for (;nCnt >= 4;nCnt -= 4,pDst += 4) {
+    vst1q_u32(pDst,vVal);
+  }
+  gslc_SimdFill32_C(pDst,nCnt,nVal);
+}
+
+void gslc_SimdCopy_NEON(uint8_t* pDst,const uint8_t* pSrc,uint32_t nLen)
+{
+  for (;nLen >= 64;nLen -= 64,pDst += 64,pSrc += 64) {
+    vst1q_u8(pDst+ 0,vld1q_u8(pSrc+ 0));
+    vst1q_u8(pDst+16,vld1q_u8(pSrc+16));
+    vst1q_u8(pDst+32,vld1q_u8(pSrc+32));
+    vst1q_u8(pDst+48,vld1q_u8(pSrc+48));
+  }
+  for (;nLen >= 16;nLen -= 16,pDst += 16,pSrc += 16) {
+    vst1q_u8(pDst,vld1q_u8(pSrc));
+  }
+  gslc_SimdCopy_C(pDst,pSrc,nLen);
+}
+
+#endif // GSLC_SIMD_NEON
@@ -0,0 +1,277 @@
+#ifndef _GUISLICE_SIMD_H_
+#define _GUISLICE_SIMD_H_
+
+// =======================================================================
+// GUIslice library (vectorized pixel kernels)
+// - Calvin Hass
+// - http://www.impulseadventure.com/elec/guislice-gui.html
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2017 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+
+
+// =======================================================================
+// Vectorized pixel kernels
+// - Solid fills of 16-bit and 32-bit pixels and opaque copies used
+//   by the software rasterizer for rect fills and image blits
+// - Each kernel is selected separately at runtime according to the
+//   instruction set extensions reported by the CPU (SSE2 / AVX2 on
+//   x86, NEON on ARM). A vector version is only preferred where it
+//   measured faster than the others in tests/test-simd, so some
+//   kernels keep the scalar version even when the CPU offers more.
+// - The scalar copy is memcpy() since the C library versions are
+//   already vectorized for most CPUs
+// - Set GSLC_SIMD_EN to 0 in GUIslice_config.h to build only the
+//   scalar kernels
+// =======================================================================
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include "GUIslice.h"
+
+
+// Determine which kernel sets can be compiled for the target
+// - The x86 kernels rely on the GCC/Clang target attribute so that
+//   no special compiler flags are required
+#if (GSLC_SIMD_EN) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define GSLC_SIMD_X86
+#endif
+#if (GSLC_SIMD_EN) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+  #define GSLC_SIMD_NEON
+#endif
+
+
+/// Instruction set used by the kernels
+typedef enum {
+  GSLC_SIMD_NONE = 0,   ///< Portable scalar code
+  GSLC_SIMD_SSE2,       ///< x86 SSE2 (128-bit)
+  GSLC_SIMD_AVX2,       ///< x86 AVX2 (256-bit)
+  GSLC_SIMD_NEON,       ///< ARM NEON (128-bit)
+  GSLC_SIMD_CNT         ///< Number of instruction sets
+} gslc_teSimd;
+
+/// Kernels that can be selected separately
+typedef enum {
+  GSLC_SIMD_K_FILL16 = 0, ///< 16-bit solid fill
+  GSLC_SIMD_K_FILL32,     ///< 32-bit solid fill
+  GSLC_SIMD_K_COPY,       ///< Opaque copy
+  GSLC_SIMD_K_CNT         ///< Number of kernels
+} gslc_teSimdKernel;
+
+
+/// Callback function for 16-bit solid fill
+typedef void (*GSLC_CB_SIMD_FILL16)(uint16_t* pDst,uint32_t nCnt,uint16_t nVal);
+
+/// Callback function for 32-bit solid fill
+typedef void (*GSLC_CB_SIMD_FILL32)(uint32_t* pDst,uint32_t nCnt,uint32_t nVal);
+
+/// Callback function for opaque copy
+typedef void (*GSLC_CB_SIMD_COPY)(uint8_t* pDst,const uint8_t* pSrc,uint32_t nLen);
+
+
+/// Active kernels
+typedef struct {
+  gslc_teSimd           aeSimd[GSLC_SIMD_K_CNT]; ///< Instruction set of each kernel
+  GSLC_CB_SIMD_FILL16   pfuncFill16;  ///< 16-bit solid fill
+  GSLC_CB_SIMD_FILL32   pfuncFill32;  ///< 32-bit solid fill
+  GSLC_CB_SIMD_COPY     pfuncCopy;    ///< Opaque copy
+} gslc_tsSimd;
+
+
+// =======================================================================
+// Public APIs
+// =======================================================================
+
+///
+/// Select the fastest supported version of each kernel
+/// - Called by gslc_RasterInit(). Until then the scalar
+///   kernels are active.
+///
+/// \return none
+///
+void gslc_SimdInit(void);
+
+///
+/// Determine whether the CPU and build support an instruction set
+///
+/// \param[in]  eSimd:       Instruction set
+///
+/// \return true if supported, false otherwise
+///
+bool gslc_SimdIsSupported(gslc_teSimd eSimd);
+
+///
+/// Select the version of every kernel for an instruction set
+/// - Mainly used for benchmarking and debugging
+///
+/// \param[in]  eSimd:       Instruction set
+///
+/// \return true if success, false if not supported
+///
+bool gslc_SimdSelect(gslc_teSimd eSimd);
+
+///
+/// Select the version of a single kernel
+///
+/// \param[in]  eKernel:     Kernel
+/// \param[in]  eSimd:       Instruction set
+///
+/// \return true if success, false if not supported
+///
+bool gslc_SimdSelectKernel(gslc_teSimdKernel eKernel,gslc_teSimd eSimd);
+
+///
+/// Get the instruction set of an active kernel
+///
+/// \param[in]  eKernel:     Kernel
+///
+/// \return Instruction set
+///
+gslc_teSimd gslc_SimdGetActive(gslc_teSimdKernel eKernel);
+
+///
+/// Get the instruction set that gslc_SimdInit() selects for a kernel
+///
+/// \param[in]  eKernel:     Kernel
+///
+/// \return Instruction set
+///
+gslc_teSimd gslc_SimdGetDefault(gslc_teSimdKernel eKernel);
+
+///
+/// Get the name of an instruction set
+///
+/// \param[in]  eSimd:       Instruction set
+///
+/// \return Name string
+///
+const char* gslc_SimdGetName(gslc_teSimd eSimd);
+
+///
+/// Fill a run of 16-bit pixels with a value
+///
+/// \param[in]  pDst:        Pointer to first pixel
+/// \param[in]  nCnt:        Number of pixels
+/// \param[in]  nVal:        Pixel value
+///
+/// \return none
+///
+void gslc_SimdFill16(uint16_t* pDst,uint32_t nCnt,uint16_t nVal);
+
+///
+/// Fill a run of 32-bit pixels with a value
+///
+/// \param[in]  pDst:        Pointer to first pixel
+/// \param[in]  nCnt:        Number of pixels
+/// \param[in]  nVal:        Pixel value
+///
+/// \return none
+///
+void gslc_SimdFill32(uint32_t* pDst,uint32_t nCnt,uint32_t nVal);
+
+///
+/// Fill a rectangle of 16-bit pixels with a value
+///
+/// \param[in]  pDst:        Pointer to top-left pixel
+/// \param[in]  nPitch:      Distance between rows (in bytes)
+/// \param[in]  nW:          Width (in pixels)
+/// \param[in]  nH:          Height (in rows)
+/// \param[in]  nVal:        Pixel value
+///
+/// \return none
+///
+void gslc_SimdFillRect16(uint8_t* pDst,uint32_t nPitch,uint32_t nW,uint32_t nH,uint16_t nVal);
+
+///
+/// Fill a rectangle of 32-bit pixels with a value
+///
+/// \param[in]  pDst:        Pointer to top-left pixel
+/// \param[in]  nPitch:      Distance between rows (in bytes)
+/// \param[in]  nW:          Width (in pixels)
+/// \param[in]  nH:          Height (in rows)
+/// \param[in]  nVal:        Pixel value
+///
+/// \return none
+///
+void gslc_SimdFillRect32(uint8_t* pDst,uint32_t nPitch,uint32_t nW,uint32_t nH,uint32_t nVal);
+
+///
+/// Copy a run of bytes (non-overlapping)
+///
+/// \param[in]  pDst:        Pointer to destination
+/// \param[in]  pSrc:        Pointer to source
+/// \param[in]  nLen:        Number of bytes
+///
+/// \return none
+///
+void gslc_SimdCopy(uint8_t* pDst,const uint8_t* pSrc,uint32_t nLen);
+
+///
+/// Copy a rectangle of bytes (non-overlapping)
+///
+/// \param[in]  pDst:        Pointer to destination top-left
+/// \param[in]  nDstPitch:   Distance between destination rows (in bytes)
+/// \param[in]  pSrc:        Pointer to source top-left
+/// \param[in]  nSrcPitch:   Distance between source rows (in bytes)
+/// \param[in]  nLen:        Number of bytes in each row
+/// \param[in]  nH:          Height (in rows)
+///
+/// \return none
+///
+void gslc_SimdCopyRect(uint8_t* pDst,uint32_t nDstPitch,const uint8_t* pSrc,uint32_t nSrcPitch,uint32_t nLen,uint32_t nH);
+
+
+// =======================================================================
+// Private Functions
+// - Kernel implementations for each instruction set
+// - No alignment is required for any of the pointers
+// =======================================================================
+
+void gslc_SimdFill16_C(uint16_t* pDst,uint32_t nCnt,uint16_t nVal);
+void gslc_SimdFill32_C(uint32_t* pDst,uint32_t nCnt,uint32_t nVal);
+void gslc_SimdCopy_C(uint8_t* pDst,const uint8_t* pSrc,uint32_t nLen);
+
+#if defined(GSLC_SIMD_X86)
+void gslc_SimdFill16_SSE2(uint16_t* pDst,uint32_t nCnt,uint16_t nVal);
+void gslc_SimdFill32_SSE2(uint32_t* pDst,uint32_t nCnt,uint32_t nVal);
+void gslc_SimdCopy_SSE2(uint8_t* pDst,const uint8_t* pSrc,uint32_t nLen);
+void gslc_SimdFill16_AVX2(uint16_t* pDst,uint32_t nCnt,uint16_t nVal);
+void gslc_SimdFill32_AVX2(uint32_t* pDst,uint32_t nCnt,uint32_t nVal);
+void gslc_SimdCopy_AVX2(uint8_t* pDst,const uint8_t* pSrc,uint32_t nLen);
+#endif // GSLC_SIMD_X86
+
+#if defined(GSLC_SIMD_NEON)
+void gslc_SimdFill16_NEON(uint16_t* pDst,uint32_t nCnt,uint16_t nVal);
+void gslc_SimdFill32_NEON(uint32_t* pDst,uint32_t nCnt,uint32_t nVal);
+void gslc_SimdCopy_NEON(uint8_t* pDst,const uint8_t* pSrc,uint32_t nLen);
+#endif // GSLC_SIMD_NEON
+
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // _GUISLICE_SIMD_H_
@@ -157,8 +157,8 @@ int main( int argc, char* args[] )
   if (!gslc_Init(&m_gui,&m_drv,m_asPage,MAX_PAGE,m_asFont,MAX_FONT)) { exit(1); }
 
   // Load Fonts
-  gslc_FontAdd(&m_gui,E_FONT_BTN,FONT_DROID_SANS,12);
-  gslc_FontAdd(&m_gui,E_FONT_TXT,FONT_DROID_SANS,10);
+  gslc_FontAdd(&m_gui,E_FONT_BTN,GSLC_FONTREF_FNAME,FONT_DROID_SANS,12);
+  gslc_FontAdd(&m_gui,E_FONT_TXT,GSLC_FONTREF_FNAME,FONT_DROID_SANS,10);
 
 
   // -----------------------------------
@@ -0,0 +1,86 @@
+//
+// GUIslice test for the SDL glyph atlas
+// - Calvin Hass
+// - http://www.impulseadventure.com/elec/
+//
+// This program draws strings through the glyph atlas of the SDL
+// driver and confirms that the cache statistics advance as
+// expected. This includes an empty string, which has no glyphs and
+// must return without indexing the atlas.
+// SDL's dummy video driver is used so no display is required.
+//
+// Usage: test-glyph [font.ttf]
+//
+
+#include "GUIslice.h"
+#include "GUIslice_drv.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define FONT_DROID_SANS "/usr/share/fonts/truetype/droid/DroidSans.ttf"
+
+enum {E_FONT_TXT};
+
+#define MAX_PAGE            1
+#define MAX_FONT            1
+
+gslc_tsGui                  m_gui;
+gslc_tsDriver               m_drv;
+gslc_tsPage                 m_asPage[MAX_PAGE];
+gslc_tsFont                 m_asFont[MAX_FONT];
+
+bool                        m_bOk = true;
+
+// Define debug message function
+static int16_t DebugOut(char ch) { fputc(ch,stderr); return 0; }
+
+// Draw a string and confirm the change in the cache statistics
+void CheckTxt(const char* pStr,uint32_t nHitExp,uint32_t nMissExp)
+{
+  uint32_t  nHit0,nMiss0,nHit1,nMiss1;
+  bool      bRet;
+
+  gslc_DrvGetGlyphCacheStats(&m_gui,&nHit0,&nMiss0);
+  bRet = gslc_DrvDrawTxt(&m_gui,10,10,&m_asFont[E_FONT_TXT],pStr,GSLC_TXT_DEFAULT,GSLC_COL_WHITE);
+  gslc_DrvGetGlyphCacheStats(&m_gui,&nHit1,&nMiss1);
+  if ((!bRet) || (nHit1-nHit0 != nHitExp) || (nMiss1-nMiss0 != nMissExp)) {
+    printf("FAIL: \"%s\" ret=%u hit=%u (exp %u) miss=%u (exp %u)\n",pStr,(unsigned)bRet,
+      (unsigned)(nHit1-nHit0),(unsigned)nHitExp,(unsigned)(nMiss1-nMiss0),(unsigned)nMissExp);
+    m_bOk = false;
+  } else {
+    printf("OK:   \"%s\"\n",pStr);
+  }
+}
+
+int main( int argc, char* args[] )
+{
+  const char* pFontPath = (argc > 1)? args[1] : FONT_DROID_SANS;
+
+  gslc_InitDebug(&DebugOut);
+  setenv((char*)"SDL_VIDEODRIVER",(char*)"dummy",1);
+  if (!gslc_Init(&m_gui,&m_drv,m_asPage,MAX_PAGE,m_asFont,MAX_FONT)) { exit(1); }
+  if (!gslc_FontAdd(&m_gui,E_FONT_TXT,GSLC_FONTREF_FNAME,pFontPath,12)) {
+    printf("ERROR: Unable to load font %s\n",pFontPath);
+    gslc_Quit(&m_gui);
+    return 1;
+  }
+
+  #if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+  // Strings without glyphs never reach the atlas
+  CheckTxt("",0,0);
+  // The first draw builds the atlas, then later draws reuse it
+  CheckTxt("Hello",0,1);
+  CheckTxt("",0,0);
+  CheckTxt("World",1,0);
+  // Characters outside the cached range go to SDL_ttf
+  CheckTxt("Caf\xe9",0,1);
+  #else
+  CheckTxt("",0,0);
+  CheckTxt("Hello",0,1);
+  #endif
+
+  gslc_Quit(&m_gui);
+  printf("%s\n",(m_bOk)? "PASS" : "FAIL");
+  return (m_bOk)? 0 : 1;
+}
@@ -0,0 +1,619 @@
+//
+// GUIslice rendering tests for the in-memory framebuffer driver
+// - Calvin Hass
+// - http://www.impulseadventure.com/elec/
+//
+// This program renders each drawing feature into the framebuffer
+// of the MEM driver and compares the result against a reference
+// rendered in another way, such as an equivalent primitive, the
+// unclipped drawing or the expected pixels computed here. No
+// display is required.
+//
+// Features that are disabled in GUIslice_config.h are only checked
+// for correct output (eg. the element cache and image registry).
+//
+// Usage: test-mem
+//
+
+#include "GUIslice.h"
+#include "GUIslice_drv.h"
+
+#include <libgen.h>      // For path parsing
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum {E_PG_MAIN,E_PG_ALT,E_PG_IMG};
+enum {E_FONT_BMP};
+
+#define MAX_PAGE            3
+#define MAX_ELEM_PG_MAIN    2
+#define MAX_ELEM_PG_ALT     2
+#define MAX_ELEM_PG_IMG     4
+#define MAX_FONT            1
+
+#define MAX_PATH            255
+#define IMG_BTN             "/res/btn-exit32x32.bmp"
+#define IMG_BTN_SEL         "/res/btn-exit_sel32x32.bmp"
+
+gslc_tsGui                  m_gui;
+gslc_tsDriver               m_drv;
+gslc_tsPage                 m_asPage[MAX_PAGE];
+gslc_tsElem                 m_asPageElem[MAX_ELEM_PG_MAIN];
+gslc_tsElemRef              m_asPageElemRef[MAX_ELEM_PG_MAIN];
+gslc_tsElem                 m_asAltElem[MAX_ELEM_PG_ALT];
+gslc_tsElemRef              m_asAltElemRef[MAX_ELEM_PG_ALT];
+gslc_tsElem                 m_asImgElem[MAX_ELEM_PG_IMG];
+gslc_tsElemRef              m_asImgElemRef[MAX_ELEM_PG_IMG];
+gslc_tsFont                 m_asFont[MAX_FONT];
+
+// Reference frame for comparisons
+gslc_tsColor*               m_pRef = NULL;
+
+// Directory of the executable (to locate the test images)
+const char*                 m_strPath = ".";
+
+// Number of calls to the custom drawing function
+uint32_t                    m_nDrawCnt = 0;
+
+// Bitmap font with two glyphs ('A' and 'B')
+// - 'B' is offset from the cursor to exercise the glyph offsets
+const uint8_t m_anFontBits[] = {
+  // 'A': 5x7
+  0x22,0xA3,0x1F,0xC6,0x31,0x80,
+  // 'B': 4x6
+  0xE9,0x9E,0x9E,
+};
+const gslc_tsFontBmpGlyph m_asFontGlyph[] = {
+  {0,5,7,6, 0,-7},
+  {6,4,6,6, 1,-6},
+};
+const gslc_tsFontBmp m_sFontBmp = {m_anFontBits,m_asFontGlyph,'A','B',9};
+
+// Raw RGB565 test image (GSLC_IMGREF_FMT_RAW16)
+#define IMG_W   19
+#define IMG_H   11
+uint16_t m_anImgRaw[2 + IMG_W*IMG_H];
+// Run-length encoded versions of the same image
+uint8_t  m_anImgRle16[4 + IMG_W*IMG_H*3];
+uint8_t  m_anImgRle8[6 + 8*2 + IMG_W*IMG_H*2];
+// Palette of the test image
+const uint16_t m_anImgPal[] = {0x0000,0xFFFF,0xF800,0x07E0,0x001F,0x8410};
+
+
+// -----------------------------------------------------------------------
+// Helpers
+// -----------------------------------------------------------------------
+
+bool ColEq(gslc_tsColor nCol1,gslc_tsColor nCol2)
+{
+  return (nCol1.r == nCol2.r) && (nCol1.g == nCol2.g) && (nCol1.b == nCol2.b);
+}
+
+void Clear(gslc_tsColor nCol)
+{
+  gslc_SetClipRect(&m_gui,NULL);
+  gslc_DrawFillRect(&m_gui,(gslc_tsRect){0,0,m_gui.nDispW,m_gui.nDispH},nCol);
+}
+
+// Save the framebuffer as the reference frame
+void Snap()
+{
+  int16_t nX,nY;
+  for (nY=0;nY<m_gui.nDispH;nY++) {
+    for (nX=0;nX<m_gui.nDispW;nX++) {
+      m_pRef[nY*m_gui.nDispW + nX] = gslc_DrvMemGetPixel(&m_gui,nX,nY);
+    }
+  }
+}
+
+// Count the pixels that differ from the reference frame
+// - Within rRect, or outside of it if bOutside is set
+uint32_t DiffRect(gslc_tsRect rRect,bool bOutside)
+{
+  int16_t   nX,nY;
+  uint32_t  nDiff = 0;
+  bool      bIn;
+  for (nY=0;nY<m_gui.nDispH;nY++) {
+    for (nX=0;nX<m_gui.nDispW;nX++) {
+      // Note that gslc_IsInRect() includes the far edges
+      bIn = (nX >= rRect.x) && (nX < rRect.x+rRect.w) && (nY >= rRect.y) && (nY < rRect.y+rRect.h);
+      if (bIn == bOutside) {
+        continue;
+      }
+      if (!ColEq(gslc_DrvMemGetPixel(&m_gui,nX,nY),m_pRef[nY*m_gui.nDispW + nX])) {
+        nDiff++;
+      }
+    }
+  }
+  return nDiff;
+}
+
+// Count the pixels that differ from the reference frame
+uint32_t Diff()
+{
+  return DiffRect((gslc_tsRect){0,0,0,0},true);
+}
+
+// Count the pixels of a color
+uint32_t CountCol(gslc_tsColor nCol)
+{
+  int16_t   nX,nY;
+  uint32_t  nCnt = 0;
+  for (nY=0;nY<m_gui.nDispH;nY++) {
+    for (nX=0;nX<m_gui.nDispW;nX++) {
+      if (ColEq(gslc_DrvMemGetPixel(&m_gui,nX,nY),nCol)) {
+        nCnt++;
+      }
+    }
+  }
+  return nCnt;
+}
+
+bool Check(const char* pName,bool bOk)
+{
+  printf("%-6s %s\n",(bOk)? "OK" : "FAIL",pName);
+  return bOk;
+}
+
+void DrawScene()
+{
+  gslc_DrawLine(&m_gui,5,5,300,220,GSLC_COL_WHITE);
+  gslc_DrawLine(&m_gui,310,10,20,200,GSLC_COL_YELLOW);
+  gslc_DrawFrameRect(&m_gui,(gslc_tsRect){40,30,120,90},GSLC_COL_RED);
+  gslc_DrawFillCircle(&m_gui,150,100,45,GSLC_COL_BLUE);
+  gslc_DrawArc(&m_gui,80,150,20,60,30,250,GSLC_COL_GREEN);
+  gslc_DrawLineAA(&m_gui,30,120,250,40,GSLC_COL_ORANGE);
+  gslc_DrawFrameCircleAA(&m_gui,200,120,50,GSLC_COL_WHITE);
+  gslc_FontDrawTxt(&m_gui,60,60,gslc_FontGet(&m_gui,E_FONT_BMP),"ABBA",GSLC_TXT_DEFAULT,GSLC_COL_WHITE);
+}
+
+// Encode the test image in the run-length encoded formats
+void MakeImages()
+{
+  uint32_t  nInd,nRun,nLit,nPos16,nPos8;
+  uint16_t  nPix;
+  uint8_t   nPal;
+  const uint32_t nCnt = IMG_W*IMG_H;
+
+  m_anImgRaw[0] = IMG_W;
+  m_anImgRaw[1] = IMG_H;
+  for (nInd=0;nInd<nCnt;nInd++) {
+    // Long runs at the top, then mostly single pixels
+    nPal = (nInd < 2*IMG_W)? 3 : ((nInd*7 + nInd/5) % 6);
+    m_anImgRaw[2+nInd] = m_anImgPal[nPal];
+  }
+
+  nPos16 = 0;
+  nPos8  = 0;
+  m_anImgRle16[nPos16++] = 0; m_anImgRle16[nPos16++] = IMG_W;
+  m_anImgRle16[nPos16++] = 0; m_anImgRle16[nPos16++] = IMG_H;
+  m_anImgRle8[nPos8++]   = 0; m_anImgRle8[nPos8++]   = IMG_W;
+  m_anImgRle8[nPos8++]   = 0; m_anImgRle8[nPos8++]   = IMG_H;
+  m_anImgRle8[nPos8++]   = sizeof(m_anImgPal)/sizeof(m_anImgPal[0]);
+  for (nPal=0;nPal<sizeof(m_anImgPal)/sizeof(m_anImgPal[0]);nPal++) {
+    m_anImgRle8[nPos8++] = m_anImgPal[nPal] >> 8;
+    m_anImgRle8[nPos8++] = m_anImgPal[nPal] & 0xFF;
+  }
+  nInd = 0;
+  while (nInd < nCnt) {
+    for (nRun=1;(nInd+nRun < nCnt) && (nRun < 128);nRun++) {
+      if (m_anImgRaw[2+nInd+nRun] != m_anImgRaw[2+nInd]) { break; }
+    }
+    if (nRun > 1) {
+      nPix = m_anImgRaw[2+nInd];
+      m_anImgRle16[nPos16++] = 0x80 | (nRun-1);
+      m_anImgRle16[nPos16++] = nPix >> 8;
+      m_anImgRle16[nPos16++] = nPix & 0xFF;
+      m_anImgRle8[nPos8++]   = 0x80 | (nRun-1);
+      for (nPal=0;m_anImgPal[nPal]!=nPix;nPal++) { }
+      m_anImgRle8[nPos8++]   = nPal;
+      nInd += nRun;
+      continue;
+    }
+    // Literal packet up to the next run
+    for (nLit=1;(nInd+nLit < nCnt) && (nLit < 128);nLit++) {
+      if ((nInd+nLit+1 < nCnt) && (m_anImgRaw[2+nInd+nLit+1] == m_anImgRaw[2+nInd+nLit])) { break; }
+    }
+    m_anImgRle16[nPos16++] = nLit-1;
+    m_anImgRle8[nPos8++]   = nLit-1;
+    for (nRun=0;nRun<nLit;nRun++) {
+      nPix = m_anImgRaw[2+nInd+nRun];
+      m_anImgRle16[nPos16++] = nPix >> 8;
+      m_anImgRle16[nPos16++] = nPix & 0xFF;
+      for (nPal=0;m_anImgPal[nPal]!=nPix;nPal++) { }
+      m_anImgRle8[nPos8++]   = nPal;
+    }
+    nInd += nLit;
+  }
+}
+
+// Custom drawing function for the element cache test
+bool CbDrawCached(void* pvGui,void* pvElem)
+{
+  gslc_tsGui*   pGui  = (gslc_tsGui*)(pvGui);
+  gslc_tsElem*  pElem = (gslc_tsElem*)(pvElem);
+  gslc_tsRect   rElem = pElem->rElem;
+  int16_t       nInd;
+
+  m_nDrawCnt++;
+  gslc_DrawFillRect(pGui,rElem,GSLC_COL_BLUE_DK2);
+  for (nInd=0;nInd<rElem.w;nInd+=4) {
+    gslc_DrawLine(pGui,rElem.x+nInd,rElem.y,rElem.x+rElem.w-1-nInd,rElem.y+rElem.h-1,
+      (gslc_tsColor){(uint8_t)(nInd*5),200,(uint8_t)nInd});
+  }
+  gslc_ElemSetRedraw(pElem,false);
+  return true;
+}
+
+
+// -----------------------------------------------------------------------
+// Tests
+// -----------------------------------------------------------------------
+
+// Drawing with a clipping region matches the unclipped drawing
+// within the region and leaves the rest untouched
+bool TestClip()
+{
+  gslc_tsRect rClip = {50,40,130,110};
+
+  Clear(GSLC_COL_BLACK);
+  DrawScene();
+  Snap();
+  Clear(GSLC_COL_BLACK);
+  gslc_SetClipRect(&m_gui,&rClip);
+  DrawScene();
+  gslc_SetClipRect(&m_gui,NULL);
+  if (DiffRect(rClip,false) != 0) {
+    return false;
+  }
+  Clear(GSLC_COL_BLACK);
+  Snap();
+  gslc_SetClipRect(&m_gui,&rClip);
+  DrawScene();
+  gslc_SetClipRect(&m_gui,NULL);
+  return (DiffRect(rClip,true) == 0);
+}
+
+// Arcs cover the same pixels as the circle fills and frames
+bool TestArc()
+{
+  uint16_t  nRadius;
+  int16_t   nAng;
+  bool      bOk = true;
+
+  for (nRadius=0;(nRadius<80) && bOk;nRadius++) {
+    Clear(GSLC_COL_BLACK);
+    gslc_DrawRoundFill(&m_gui,(gslc_tsRect){160,120,1,1},nRadius,GSLC_COL_WHITE);
+    Snap();
+    Clear(GSLC_COL_BLACK);
+    gslc_DrawArc(&m_gui,160,120,0,nRadius,0,360,GSLC_COL_WHITE);
+    bOk &= (Diff() == 0);
+    // The quarters combine into the full circle
+    Clear(GSLC_COL_BLACK);
+    for (nAng=0;nAng<360;nAng+=90) {
+      gslc_DrawArc(&m_gui,160,120,0,nRadius,nAng,nAng+90,GSLC_COL_WHITE);
+    }
+    bOk &= (Diff() == 0);
+
+    Clear(GSLC_COL_BLACK);
+    gslc_DrawRoundFrame(&m_gui,(gslc_tsRect){160,120,1,1},nRadius,GSLC_COL_WHITE);
+    Snap();
+    Clear(GSLC_COL_BLACK);
+    gslc_DrawArc(&m_gui,160,120,nRadius,nRadius,0,360,GSLC_COL_WHITE);
+    bOk &= (Diff() == 0);
+  }
+
+  Clear(GSLC_COL_BLACK);
+  gslc_DrawArc(&m_gui,160,120,0,1,0,360,GSLC_COL_WHITE);
+  bOk &= (CountCol(GSLC_COL_WHITE) == 5);
+  Clear(GSLC_COL_BLACK);
+  gslc_DrawArc(&m_gui,160,120,0,43,0,360,GSLC_COL_WHITE);
+  bOk &= (CountCol(GSLC_COL_WHITE) == 5785);
+  // A radius much larger than the display covers all of it
+  Clear(GSLC_COL_BLACK);
+  gslc_DrawArc(&m_gui,160,120,0,65535,0,360,GSLC_COL_WHITE);
+  bOk &= (CountCol(GSLC_COL_WHITE) == (uint32_t)m_gui.nDispW*m_gui.nDispH);
+  return bOk;
+}
+
+// Anti-aliased primitives are symmetric and match the plain
+// primitives where no smoothing is required
+bool TestAA()
+{
+  int16_t   nDX,nDY;
+  bool      bOk = true;
+
+  // Horizontal and vertical lines need no smoothing
+  Clear(GSLC_COL_BLACK);
+  gslc_DrawLine(&m_gui,10,20,200,20,GSLC_COL_WHITE);
+  gslc_DrawLine(&m_gui,30,40,30,200,GSLC_COL_WHITE);
+  Snap();
+  Clear(GSLC_COL_BLACK);
+  gslc_DrawLineAA(&m_gui,10,20,200,20,GSLC_COL_WHITE);
+  gslc_DrawLineAA(&m_gui,30,40,30,200,GSLC_COL_WHITE);
+  bOk &= (Diff() == 0);
+
+  // The direction of a line doesn't change its pixels
+  Clear(GSLC_COL_BLACK);
+  gslc_DrawLineAA(&m_gui,17,33,290,150,GSLC_COL_WHITE);
+  Snap();
+  Clear(GSLC_COL_BLACK);
+  gslc_DrawLineAA(&m_gui,290,150,17,33,GSLC_COL_WHITE);
+  bOk &= (Diff() == 0);
+
+  // Circles are symmetric about both axes
+  Clear(GSLC_COL_BLACK);
+  gslc_DrawFrameCircleAA(&m_gui,160,120,57,GSLC_COL_WHITE);
+  for (nDY=-60;nDY<=60;nDY++) {
+    for (nDX=-60;nDX<=60;nDX++) {
+      gslc_tsColor nCol = gslc_DrvMemGetPixel(&m_gui,160+nDX,120+nDY);
+      bOk &= ColEq(nCol,gslc_DrvMemGetPixel(&m_gui,160-nDX,120+nDY));
+      bOk &= ColEq(nCol,gslc_DrvMemGetPixel(&m_gui,160+nDX,120-nDY));
+    }
+  }
+  bOk &= ColEq(gslc_DrvMemGetPixel(&m_gui,160+57,120),GSLC_COL_WHITE);
+  bOk &= ColEq(gslc_DrvMemGetPixel(&m_gui,160,120),GSLC_COL_BLACK);
+  return bOk;
+}
+
+// Semi-transparent fills blend with the existing pixels
+bool TestAlpha()
+{
+  gslc_tsRect   rFill = {40,30,100,70};
+  gslc_tsColor  colBkgnd = GSLC_COL_BLUE;
+  gslc_tsColor  colFill  = GSLC_COL_WHITE;
+  gslc_tsColor  colBlend,colPix;
+  int16_t       nX,nY;
+  bool          bOk = true;
+
+  // Opaque fill
+  Clear(colBkgnd);
+  gslc_DrawFillRect(&m_gui,rFill,colFill);
+  Snap();
+  Clear(colBkgnd);
+  colFill.transp = 0;
+  gslc_DrawFillRect(&m_gui,rFill,colFill);
+  bOk &= (Diff() == 0);
+
+  // Invisible fill
+  Clear(colBkgnd);
+  Snap();
+  colFill.transp = 255;
+  gslc_DrawFillRect(&m_gui,rFill,colFill);
+  bOk &= (Diff() == 0);
+
+  // Half transparent fill is uniform, lies between the two colors
+  // and leaves the surrounding pixels untouched
+  colFill.transp = 128;
+  gslc_DrawFillRect(&m_gui,rFill,colFill);
+  bOk &= (DiffRect(rFill,true) == 0);
+  colBlend = gslc_DrvMemGetPixel(&m_gui,rFill.x,rFill.y);
+  for (nY=rFill.y;nY<rFill.y+rFill.h;nY++) {
+    for (nX=rFill.x;nX<rFill.x+rFill.w;nX++) {
+      colPix = gslc_DrvMemGetPixel(&m_gui,nX,nY);
+      bOk &= ColEq(colPix,colBlend);
+    }
+  }
+  bOk &= (colBlend.r > 0x60) && (colBlend.r < 0xA0);
+  bOk &= (colBlend.g > 0x60) && (colBlend.g < 0xA0);
+  bOk &= (colBlend.b >= 0xF0);
+  return bOk;
+}
+
+// Cached elements are restored without calling their drawing
+// function and look the same as when they were drawn
+bool TestElemCache()
+{
+  gslc_tsElem*  pElem;
+  uint32_t      nDrawCnt;
+  bool          bOk = true;
+
+  gslc_SetPageCur(&m_gui,E_PG_MAIN);
+  pElem = gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,E_PG_MAIN,(gslc_tsRect){30,30,120,90});
+  gslc_ElemSetDrawFunc(pElem,&CbDrawCached);
+  gslc_ElemSetCacheEn(&m_gui,pElem,true);
+  gslc_Update(&m_gui);
+  Snap();
+  nDrawCnt = m_nDrawCnt;
+
+  // Switching pages redraws the element from its cache
+  gslc_SetPageCur(&m_gui,E_PG_ALT);
+  gslc_Update(&m_gui);
+  gslc_SetPageCur(&m_gui,E_PG_MAIN);
+  gslc_Update(&m_gui);
+  bOk &= (Diff() == 0);
+  #if (GSLC_ELEM_CACHE_MAX > 0)
+  bOk &= (m_nDrawCnt == nDrawCnt);
+  #endif
+
+  // An explicit redraw calls the drawing function again
+  nDrawCnt = m_nDrawCnt;
+  gslc_ElemSetRedraw(pElem,true);
+  gslc_Update(&m_gui);
+  bOk &= (Diff() == 0);
+  bOk &= (m_nDrawCnt == nDrawCnt+1);
+
+  gslc_ElemSetCacheEn(&m_gui,pElem,false);
+  return bOk;
+}
+
+// Bitmap fonts are drawn with their glyph offsets and scale
+bool TestFontBmp()
+{
+  gslc_tsFont*  pFont = gslc_FontGet(&m_gui,E_FONT_BMP);
+  const char*   pStr  = "ABA";
+  int16_t       nTxtX = 40;
+  int16_t       nTxtY = 50;
+  int16_t       nCursorX,nBaseY,nX,nY;
+  uint16_t      nScale = pFont->nSize;
+  uint16_t      nRow,nCol,nBit;
+  const gslc_tsFontBmpGlyph* pGlyph;
+
+  // Draw the expected glyphs one pixel at a time
+  Clear(GSLC_COL_BLACK);
+  nCursorX = nTxtX;
+  nBaseY   = nTxtY + pFont->nAscent*nScale;
+  for (;*pStr!='\0';pStr++) {
+    pGlyph = &m_asFontGlyph[*pStr - 'A'];
+    for (nRow=0;nRow<pGlyph->nHeight;nRow++) {
+      for (nCol=0;nCol<pGlyph->nWidth;nCol++) {
+        nBit = nRow*pGlyph->nWidth + nCol;
+        if (!(m_anFontBits[pGlyph->nBitmapOffset + nBit/8] & (0x80 >> (nBit%8)))) {
+          continue;
+        }
+        nX = nCursorX + (pGlyph->nOffsetX + nCol)*nScale;
+        nY = nBaseY + (pGlyph->nOffsetY + nRow)*nScale;
+        gslc_DrawFillRect(&m_gui,(gslc_tsRect){nX,nY,nScale,nScale},GSLC_COL_WHITE);
+      }
+    }
+    nCursorX += pGlyph->nAdvanceX*nScale;
+  }
+  Snap();
+
+  Clear(GSLC_COL_BLACK);
+  gslc_FontDrawTxt(&m_gui,nTxtX,nTxtY,pFont,"ABA",GSLC_TXT_DEFAULT,GSLC_COL_WHITE);
+  return (Diff() == 0) && (CountCol(GSLC_COL_WHITE) > 0);
+}
+
+// Image elements show the image they were created with, even when
+// they share the registry or the caller reuses the path buffer
+bool TestImgCache()
+{
+  char          acPathBtn[MAX_PATH];
+  char          acPathSel[MAX_PATH];
+  char          acPath[MAX_PATH];
+  gslc_tsRect   rImg1 = {20,20,32,32};
+  gslc_tsRect   rImg2 = {70,20,32,32};
+  gslc_tsRect   rImg3 = {120,20,32,32};
+  gslc_tsImgRef sImgRef;
+  bool          bOk = true;
+
+  snprintf(acPathBtn,MAX_PATH,"%s%s",m_strPath,IMG_BTN);
+  snprintf(acPathSel,MAX_PATH,"%s%s",m_strPath,IMG_BTN_SEL);
+
+  // Draw the expected images directly
+  gslc_SetPageCur(&m_gui,E_PG_ALT);
+  gslc_Update(&m_gui);
+  Clear(GSLC_COL_BLACK);
+  sImgRef = gslc_GetImageFromFile(acPathBtn,GSLC_IMGREF_FMT_BMP16);
+  sImgRef.pvImgRaw = gslc_DrvLoadImage(&m_gui,sImgRef);
+  bOk &= (sImgRef.pvImgRaw != NULL);
+  gslc_DrvDrawImage(&m_gui,rImg1.x,rImg1.y,sImgRef);
+  gslc_DrvDrawImage(&m_gui,rImg3.x,rImg3.y,sImgRef);
+  gslc_DrvImageDestruct(sImgRef.pvImgRaw);
+  sImgRef = gslc_GetImageFromFile(acPathSel,GSLC_IMGREF_FMT_BMP16);
+  sImgRef.pvImgRaw = gslc_DrvLoadImage(&m_gui,sImgRef);
+  bOk &= (sImgRef.pvImgRaw != NULL);
+  gslc_DrvDrawImage(&m_gui,rImg2.x,rImg2.y,sImgRef);
+  gslc_DrvImageDestruct(sImgRef.pvImgRaw);
+  Snap();
+
+  // The path buffer is reused for each element
+  gslc_SetPageCur(&m_gui,E_PG_IMG);
+  gslc_SetBkgndColor(&m_gui,GSLC_COL_BLACK);
+  strcpy(acPath,acPathBtn);
+  gslc_ElemCreateImg(&m_gui,GSLC_ID_AUTO,E_PG_IMG,rImg1,gslc_GetImageFromFile(acPath,GSLC_IMGREF_FMT_BMP16));
+  strcpy(acPath,acPathSel);
+  gslc_ElemCreateImg(&m_gui,GSLC_ID_AUTO,E_PG_IMG,rImg2,gslc_GetImageFromFile(acPath,GSLC_IMGREF_FMT_BMP16));
+  strcpy(acPath,acPathBtn);
+  gslc_ElemCreateImg(&m_gui,GSLC_ID_AUTO,E_PG_IMG,rImg3,gslc_GetImageFromFile(acPath,GSLC_IMGREF_FMT_BMP16));
+  memset(acPath,0,sizeof(acPath));
+  gslc_Update(&m_gui);
+  #if (GSLC_IMG_CACHE_MAX > 0)
+  {
+    uint32_t nLoad,nHit,nBytes;
+    gslc_GetImgCacheStats(&m_gui,&nLoad,&nHit,&nBytes);
+    printf("       Image registry: %u loads, %u hits, %u bytes\n",(unsigned)nLoad,(unsigned)nHit,(unsigned)nBytes);
+  }
+  #endif
+  bOk &= (DiffRect(rImg1,false) == 0);
+  bOk &= (DiffRect(rImg2,false) == 0);
+  bOk &= (DiffRect(rImg3,false) == 0);
+  return bOk;
+}
+
+// Run-length encoded images match the raw image, including when
+// they are clipped
+bool TestRle()
+{
+  gslc_tsRect   rClip = {25,22,11,6};
+  uint8_t       nPass;
+  bool          bOk = true;
+
+  for (nPass=0;nPass<2;nPass++) {
+    Clear(GSLC_COL_BLACK);
+    if (nPass == 1) {
+      gslc_SetClipRect(&m_gui,&rClip);
+    }
+    gslc_DrvDrawImage(&m_gui,20,20,gslc_GetImageFromRam((unsigned char*)m_anImgRaw,GSLC_IMGREF_FMT_RAW16));
+    gslc_SetClipRect(&m_gui,NULL);
+    Snap();
+
+    Clear(GSLC_COL_BLACK);
+    if (nPass == 1) {
+      gslc_SetClipRect(&m_gui,&rClip);
+    }
+    gslc_DrvDrawImage(&m_gui,20,20,gslc_GetImageFromRam(m_anImgRle16,GSLC_IMGREF_FMT_RLE16));
+    gslc_SetClipRect(&m_gui,NULL);
+    bOk &= (Diff() == 0);
+
+    Clear(GSLC_COL_BLACK);
+    if (nPass == 1) {
+      gslc_SetClipRect(&m_gui,&rClip);
+    }
+    gslc_DrvDrawImage(&m_gui,20,20,gslc_GetImageFromRam(m_anImgRle8,GSLC_IMGREF_FMT_RLE8));
+    gslc_SetClipRect(&m_gui,NULL);
+    bOk &= (Diff() == 0);
+  }
+  return bOk;
+}
+
+// Drawing an empty string leaves the display untouched
+bool TestTxtEmpty()
+{
+  bool bOk = true;
+  Clear(GSLC_COL_GRAY);
+  Snap();
+  bOk &= gslc_DrvDrawTxt(&m_gui,10,10,NULL,"",GSLC_TXT_DEFAULT,GSLC_COL_WHITE);
+  bOk &= gslc_FontDrawTxt(&m_gui,10,10,gslc_FontGet(&m_gui,E_FONT_BMP),"",GSLC_TXT_DEFAULT,GSLC_COL_WHITE);
+  return bOk && (Diff() == 0);
+}
+
+
+int main( int argc, char* args[] )
+{
+  bool bOk = true;
+
+  if (argc > 0) {
+    m_strPath = dirname(args[0]);
+  }
+  if (!gslc_Init(&m_gui,&m_drv,m_asPage,MAX_PAGE,m_asFont,MAX_FONT)) { exit(1); }
+  gslc_PageAdd(&m_gui,E_PG_MAIN,m_asPageElem,MAX_ELEM_PG_MAIN,m_asPageElemRef,MAX_ELEM_PG_MAIN);
+  gslc_PageAdd(&m_gui,E_PG_ALT,m_asAltElem,MAX_ELEM_PG_ALT,m_asAltElemRef,MAX_ELEM_PG_ALT);
+  gslc_PageAdd(&m_gui,E_PG_IMG,m_asImgElem,MAX_ELEM_PG_IMG,m_asImgElemRef,MAX_ELEM_PG_IMG);
+  gslc_SetPageCur(&m_gui,E_PG_MAIN);
+  if (!gslc_FontAdd(&m_gui,E_FONT_BMP,GSLC_FONTREF_PTR,&m_sFontBmp,2)) { exit(1); }
+
+  m_pRef = (gslc_tsColor*)malloc(sizeof(gslc_tsColor) * m_gui.nDispW * m_gui.nDispH);
+  if (m_pRef == NULL) {
+    fprintf(stderr,"ERROR: Unable to allocate reference frame\n");
+    return 1;
+  }
+  MakeImages();
+
+  bOk &= Check("Clipping",TestClip());
+  bOk &= Check("Arcs",TestArc());
+  bOk &= Check("Anti-aliasing",TestAA());
+  bOk &= Check("Alpha fills",TestAlpha());
+  bOk &= Check("Bitmap fonts",TestFontBmp());
+  bOk &= Check("Run-length encoded images",TestRle());
+  bOk &= Check("Empty text",TestTxtEmpty());
+  bOk &= Check("Element cache",TestElemCache());
+  bOk &= Check("Image registry",TestImgCache());
+
+  gslc_Quit(&m_gui);
+  free(m_pRef);
+  printf("%s\n",(bOk)? "PASS" : "FAIL");
+  return (bOk)? 0 : 1;
+}
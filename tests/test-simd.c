@@ -0,0 +1,273 @@
+//
+// GUIslice benchmark for the vectorized pixel kernels
+// - Calvin Hass
+// - http://www.impulseadventure.com/elec/
+//
+// This program confirms that each vectorized kernel supported on
+// this CPU produces the same output as the scalar version, over a
+// range of short lengths and unaligned pointers. It then compares
+// the throughput of the span fill, rect fill and copy kernels and
+// marks the version that gslc_SimdInit() selects by default.
+// No display is required.
+//
+// Usage: test-simd [width height]
+//
+
+#include "GUIslice_simd.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Default frame size (pixels)
+#define BENCH_W     800
+#define BENCH_H     480
+
+// Minimum time to spend on each measurement (seconds)
+#define BENCH_TIME  0.25
+
+// Offset applied to rows so that the kernels are also
+// exercised with unaligned pointers and odd lengths
+#define BENCH_SKEW  3
+
+// Size of the rectangles drawn by the rect fill benchmark
+// - Typical of a button or text box
+#define BENCH_RECT_W  45
+#define BENCH_RECT_H  21
+
+// Longest run and largest offset (bytes) covered by the
+// correctness checks
+#define CHECK_LEN   160
+#define CHECK_OFFS  32
+
+typedef enum {
+  E_BENCH_FILL16, E_BENCH_FILL32,
+  E_BENCH_RECT16, E_BENCH_RECT32,
+  E_BENCH_COPY16, E_BENCH_COPY32,
+  E_BENCH_CNT
+} teBench;
+
+const char* m_acBenchName[E_BENCH_CNT] = {
+  "Fill 16bpp", "Fill 32bpp",
+  "Rect 16bpp", "Rect 32bpp",
+  "Copy 16bpp", "Copy 32bpp",
+};
+
+// Kernel exercised by each benchmark
+const gslc_teSimdKernel m_aeBenchKernel[E_BENCH_CNT] = {
+  GSLC_SIMD_K_FILL16, GSLC_SIMD_K_FILL32,
+  GSLC_SIMD_K_FILL16, GSLC_SIMD_K_FILL32,
+  GSLC_SIMD_K_COPY,   GSLC_SIMD_K_COPY,
+};
+
+uint8_t*  m_pBufDst = NULL;
+uint8_t*  m_pBufRef = NULL;
+uint8_t*  m_pBufSrc = NULL;
+uint32_t  m_nW      = BENCH_W;
+uint32_t  m_nH      = BENCH_H;
+uint32_t  m_nPitch  = 0;
+
+double GetTime()
+{
+  struct timespec sTime;
+  clock_gettime(CLOCK_MONOTONIC,&sTime);
+  return (double)sTime.tv_sec + (double)sTime.tv_nsec / 1e9;
+}
+
+// Render one frame with the active kernels
+// - Returns the number of pixels written
+uint32_t DrawFrame(teBench eBench,uint32_t nVal)
+{
+  uint32_t  nRow,nSkew,nX,nY;
+  uint32_t  nPix = 0;
+  switch (eBench) {
+    case E_BENCH_FILL16:
+    case E_BENCH_FILL32:
+    case E_BENCH_COPY16:
+    case E_BENCH_COPY32:
+      for (nRow=0;nRow<m_nH;nRow++) {
+        nSkew = nRow % BENCH_SKEW;
+        uint8_t*        pDst = m_pBufDst + nRow*m_nPitch + nSkew*2;
+        const uint8_t*  pSrc = m_pBufSrc + nRow*m_nPitch + (BENCH_SKEW-1-nSkew)*2;
+        if (eBench == E_BENCH_FILL16) {
+          gslc_SimdFill16((uint16_t*)pDst,m_nW-nSkew,(uint16_t)nVal);
+        } else if (eBench == E_BENCH_FILL32) {
+          gslc_SimdFill32((uint32_t*)pDst,m_nW-nSkew,nVal);
+        } else if (eBench == E_BENCH_COPY16) {
+          gslc_SimdCopy(pDst,pSrc,(m_nW-nSkew)*2);
+        } else {
+          gslc_SimdCopy(pDst,pSrc,(m_nW-nSkew)*4);
+        }
+        nPix += m_nW-nSkew;
+      }
+      break;
+
+    case E_BENCH_RECT16:
+    case E_BENCH_RECT32:
+      // Tile the frame with rectangles that start at varying offsets
+      for (nY=0;nY+BENCH_RECT_H<=m_nH;nY+=BENCH_RECT_H) {
+        for (nX=nY%BENCH_SKEW;nX+BENCH_RECT_W<=m_nW;nX+=BENCH_RECT_W) {
+          if (eBench == E_BENCH_RECT16) {
+            gslc_SimdFillRect16(m_pBufDst + nY*m_nPitch + nX*2,m_nPitch,BENCH_RECT_W,BENCH_RECT_H,(uint16_t)nVal);
+          } else {
+            gslc_SimdFillRect32(m_pBufDst + nY*m_nPitch + nX*4,m_nPitch,BENCH_RECT_W,BENCH_RECT_H,nVal);
+          }
+          nPix += BENCH_RECT_W*BENCH_RECT_H;
+        }
+      }
+      break;
+
+    default:
+      break;
+  }
+  return nPix;
+}
+
+// Return the number of megapixels per second
+double Measure(teBench eBench)
+{
+  uint32_t  nFrames = 0;
+  double    fPix    = 0;
+  double    fStart  = GetTime();
+  double    fElapsed;
+  do {
+    fPix += DrawFrame(eBench,0x12345678 + nFrames);
+    nFrames++;
+    fElapsed = GetTime() - fStart;
+  } while (fElapsed < BENCH_TIME);
+  return fPix / fElapsed / 1e6;
+}
+
+// Run one kernel over short runs at every offset and compare
+// the whole buffer against the scalar kernel
+// - Also detects writes before or after the run
+bool CheckKernel(gslc_teSimdKernel eKernel,gslc_teSimd eSimd)
+{
+  uint32_t  nBufSz = CHECK_OFFS + CHECK_LEN*4 + CHECK_OFFS;
+  uint32_t  nDstOffs,nSrcOffs,nLen,nPass;
+  uint32_t  nStep = (eKernel == GSLC_SIMD_K_FILL16)? 2 : (eKernel == GSLC_SIMD_K_FILL32)? 4 : 1;
+  for (nDstOffs=0;nDstOffs<CHECK_OFFS;nDstOffs+=nStep) {
+    for (nSrcOffs=0;nSrcOffs<((eKernel == GSLC_SIMD_K_COPY)? CHECK_OFFS : 1);nSrcOffs++) {
+      for (nLen=0;nLen<=CHECK_LEN;nLen++) {
+        for (nPass=0;nPass<2;nPass++) {
+          uint8_t* pBuf = (nPass == 0)? m_pBufRef : m_pBufDst;
+          gslc_SimdSelectKernel(eKernel,(nPass == 0)? GSLC_SIMD_NONE : eSimd);
+          memset(pBuf,0xEE,nBufSz);
+          switch (eKernel) {
+            case GSLC_SIMD_K_FILL16:
+              gslc_SimdFill16((uint16_t*)(pBuf+nDstOffs),nLen,0xA5C3);
+              break;
+            case GSLC_SIMD_K_FILL32:
+              gslc_SimdFill32((uint32_t*)(pBuf+nDstOffs),nLen,0xA5C3E187);
+              break;
+            case GSLC_SIMD_K_COPY:
+              gslc_SimdCopy(pBuf+nDstOffs,m_pBufSrc+nSrcOffs,nLen);
+              break;
+            default:
+              break;
+          }
+        }
+        if (memcmp(m_pBufRef,m_pBufDst,nBufSz) != 0) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* args[])
+{
+  uint32_t    nBufSz,nInd;
+  int         nBench,nSimd;
+  double      afScalar[E_BENCH_CNT];
+  double      afBest[E_BENCH_CNT];
+  double      afDefault[E_BENCH_CNT];
+  double      fRate;
+  bool        bOk = true;
+
+  if (argc == 3) {
+    m_nW = (uint32_t)atoi(args[1]);
+    m_nH = (uint32_t)atoi(args[2]);
+    if ((m_nW <= BENCH_SKEW) || (m_nH == 0)) {
+      fprintf(stderr,"ERROR: Invalid frame size\n");
+      return 1;
+    }
+  }
+
+  m_nPitch  = m_nW*4 + 64;
+  nBufSz    = m_nPitch * m_nH;
+  if (nBufSz < CHECK_OFFS*2 + CHECK_LEN*4) {
+    nBufSz = CHECK_OFFS*2 + CHECK_LEN*4;
+  }
+  m_pBufDst = (uint8_t*)malloc(nBufSz);
+  m_pBufRef = (uint8_t*)malloc(nBufSz);
+  m_pBufSrc = (uint8_t*)malloc(nBufSz);
+  if ((m_pBufDst == NULL) || (m_pBufRef == NULL) || (m_pBufSrc == NULL)) {
+    fprintf(stderr,"ERROR: Unable to allocate buffers\n");
+    return 1;
+  }
+  for (nInd=0;nInd<nBufSz;nInd++) {
+    m_pBufSrc[nInd] = (uint8_t)(nInd*7 + (nInd>>8));
+  }
+  memset(m_pBufDst,0,nBufSz);
+
+  printf("Frame size %ux%u, rects %ux%u\n",m_nW,m_nH,BENCH_RECT_W,BENCH_RECT_H);
+  printf("%-8s","");
+  for (nBench=0;nBench<E_BENCH_CNT;nBench++) {
+    printf("  %-19s",m_acBenchName[nBench]);
+  }
+  printf("\n");
+
+  for (nSimd=GSLC_SIMD_NONE;nSimd<GSLC_SIMD_CNT;nSimd++) {
+    if (!gslc_SimdIsSupported((gslc_teSimd)nSimd)) {
+      continue;
+    }
+    printf("%-8s",gslc_SimdGetName((gslc_teSimd)nSimd));
+    for (nBench=0;nBench<E_BENCH_CNT;nBench++) {
+      gslc_teSimdKernel eKernel = m_aeBenchKernel[nBench];
+      // Confirm the output matches the scalar kernel
+      if ((nSimd != GSLC_SIMD_NONE) && (!CheckKernel(eKernel,(gslc_teSimd)nSimd))) {
+        printf("  %-19s","MISMATCH");
+        bOk = false;
+        continue;
+      }
+
+      gslc_SimdSelectKernel(eKernel,(gslc_teSimd)nSimd);
+      fRate = Measure((teBench)nBench);
+      if (nSimd == GSLC_SIMD_NONE) {
+        afScalar[nBench] = fRate;
+        afBest[nBench]   = fRate;
+        printf("  %7.1f MPix/s      ",fRate);
+      } else {
+        afBest[nBench] = (fRate > afBest[nBench])? fRate : afBest[nBench];
+        printf("  %7.1f MPix/s x%.2f",fRate,fRate/afScalar[nBench]);
+      }
+      if (gslc_SimdGetDefault(eKernel) == (gslc_teSimd)nSimd) {
+        afDefault[nBench] = fRate;
+        printf("*");
+      } else {
+        printf(" ");
+      }
+    }
+    printf("\n");
+  }
+  printf("(* = default kernel)\n");
+
+  // Report any default that measured clearly slower than another
+  // version. Timings are noisy on a loaded system, so this is
+  // only a warning.
+  for (nBench=0;nBench<E_BENCH_CNT;nBench++) {
+    if (afDefault[nBench] < afBest[nBench]*0.9) {
+      printf("NOTE: Default %s kernel (%s) was %.0f%% slower than the fastest\n",
+        m_acBenchName[nBench],gslc_SimdGetName(gslc_SimdGetDefault(m_aeBenchKernel[nBench])),
+        100.0*(1.0 - afDefault[nBench]/afBest[nBench]));
+    }
+  }
+
+  free(m_pBufDst);
+  free(m_pBufRef);
+  free(m_pBufSrc);
+  return (bOk)? 0 : 1;
+}
@@ -0,0 +1,446 @@
+//
+// GUIslice Library Tools
+// - Calvin Hass
+// - http://www.impulseadventure.com/elec/guislice-gui.html
+// - Image converter: Convert a BMP file into a C array that can be
+//   drawn directly by the GUIslice drivers
+//
+// Usage:
+//   gslc-imgconv [-f format] [-n name] [-c RRGGBB] [-p colors] [-o output.c] input.bmp
+//
+//   -f format   Output format (default: rgb565)
+//               - rgb565: GSLC_IMGREF_FMT_RAW16 (uint16_t array)
+//               - rgb888: GSLC_IMGREF_FMT_RAW24
+//               - mono:   GSLC_IMGREF_FMT_RAW1 (pixels brighter than 50% are set)
+//               - rle16:  GSLC_IMGREF_FMT_RLE16
+//               - rle8:   GSLC_IMGREF_FMT_RLE8 (falls back to rle16 if the
+//                         image has more colors than the palette can hold)
+//   -n name     Name of the array (default: img_ followed by the file name)
+//   -c RRGGBB   Color of a mono image (default: FFFFFF)
+//   -p colors   Largest rle8 palette, 1..256 (default: 16). This must not
+//               exceed GSLC_IMG_RLE_PAL_MAX in GUIslice_config.h.
+//   -o file     Output file (default: standard output)
+//
+// The input must be an uncompressed 16-bit (RGB555), 24-bit or 32-bit BMP,
+// or a 16-bit BMP with RGB555 or RGB565 bitfields. Pixels matching
+// GSLC_BMP_TRANS_RGB (default: FF00FF) are carried through unchanged so that
+// the drivers can treat them as transparent.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <ctype.h>
+
+// Transparent color assumed for the mono format (see GSLC_BMP_TRANS_RGB)
+#define IMGCONV_TRANS_R   0xFF
+#define IMGCONV_TRANS_G   0x00
+#define IMGCONV_TRANS_B   0xFF
+
+// Largest palette of an RLE8 image accepted by the default
+// configuration (see GSLC_IMG_RLE_PAL_MAX)
+// - Raised with the -p option
+#define IMGCONV_PAL_DEF   16
+
+// Longest packet of an RLE image
+#define IMGCONV_RLE_PKT   128
+
+typedef struct {
+  int       nW;           ///< Image width
+  int       nH;           ///< Image height
+  uint8_t*  pRgb;         ///< Pixels as R,G,B bytes, top row first
+} tsImg;
+
+typedef struct {
+  FILE*     pFile;        ///< Output file
+  int       nCnt;         ///< Values written to the current line
+} tsOut;
+
+
+// Read a little-endian value from the BMP headers
+uint32_t ReadLE(const uint8_t* pBuf,int nBytes)
+{
+  uint32_t  nVal = 0;
+  int       nInd;
+  for (nInd=nBytes-1;nInd>=0;nInd--) {
+    nVal = (nVal << 8) | pBuf[nInd];
+  }
+  return nVal;
+}
+
+bool LoadBmp(const char* pFname,tsImg* pImg)
+{
+  FILE*     pFile;
+  uint8_t   anHdr[54];
+  uint8_t   anMask[12];
+  uint8_t*  pRow;
+  uint32_t  nOffset,nComp,nRowSz;
+  uint32_t  nMaskR,nMaskG,nMaskB;
+  int32_t   nH;
+  int       nBpp,nRow,nCol,nSrcRow;
+  bool      bFlip = true;
+  bool      b565  = false;
+
+  pFile = fopen(pFname,"rb");
+  if (pFile == NULL) {
+    fprintf(stderr,"ERROR: Can't open [%s]\n",pFname);
+    return false;
+  }
+  if ((fread(anHdr,1,sizeof(anHdr),pFile) != sizeof(anHdr)) || (anHdr[0] != 'B') || (anHdr[1] != 'M')) {
+    fprintf(stderr,"ERROR: [%s] is not a BMP file\n",pFname);
+    fclose(pFile);
+    return false;
+  }
+  nOffset = ReadLE(&anHdr[10],4);
+  pImg->nW = (int32_t)ReadLE(&anHdr[18],4);
+  nH      = (int32_t)ReadLE(&anHdr[22],4);
+  nBpp    = ReadLE(&anHdr[28],2);
+  nComp   = ReadLE(&anHdr[30],4);
+  // Only uncompressed images (16-bit is RGB555), or images with
+  // bitfields that describe RGB555 / RGB565 (16-bit) or RGB888 (32-bit)
+  if ((nComp == 3) && ((nBpp == 16) || (nBpp == 32))) {
+    // The masks follow the 40-byte header (or are part of a larger one)
+    if (fread(anMask,1,sizeof(anMask),pFile) != sizeof(anMask)) {
+      fprintf(stderr,"ERROR: [%s] is truncated\n",pFname);
+      fclose(pFile);
+      return false;
+    }
+    nMaskR = ReadLE(&anMask[0],4);
+    nMaskG = ReadLE(&anMask[4],4);
+    nMaskB = ReadLE(&anMask[8],4);
+    b565 = (nBpp == 16) && (nMaskR == 0xF800) && (nMaskG == 0x07E0) && (nMaskB == 0x001F);
+    if (!b565 &&
+        !((nBpp == 16) && (nMaskR == 0x7C00) && (nMaskG == 0x03E0) && (nMaskB == 0x001F)) &&
+        !((nBpp == 32) && (nMaskR == 0xFF0000) && (nMaskG == 0x00FF00) && (nMaskB == 0x0000FF))) {
+      fprintf(stderr,"ERROR: [%s] has an unsupported bitfield layout (only RGB555, RGB565 and RGB888)\n",pFname);
+      fclose(pFile);
+      return false;
+    }
+  } else if (((nBpp != 16) && (nBpp != 24) && (nBpp != 32)) || (nComp != 0)) {
+    fprintf(stderr,"ERROR: [%s] must be an uncompressed 16-bit, 24-bit or 32-bit BMP\n",pFname);
+    fclose(pFile);
+    return false;
+  }
+  if (nH < 0) {
+    nH    = -nH;
+    bFlip = false;
+  }
+  pImg->nH = nH;
+  if ((pImg->nW <= 0) || (pImg->nH <= 0) || (pImg->nW > 0xFFFF) || (pImg->nH > 0xFFFF)) {
+    fprintf(stderr,"ERROR: [%s] has unsupported dimensions\n",pFname);
+    fclose(pFile);
+    return false;
+  }
+
+  nRowSz      = ((uint32_t)pImg->nW * (nBpp/8) + 3) & ~3;
+  pRow        = (uint8_t*)malloc(nRowSz);
+  pImg->pRgb  = (uint8_t*)malloc((size_t)pImg->nW * pImg->nH * 3);
+  if ((pRow == NULL) || (pImg->pRgb == NULL)) {
+    fprintf(stderr,"ERROR: Out of memory\n");
+    free(pRow);
+    free(pImg->pRgb);
+    pImg->pRgb = NULL;
+    fclose(pFile);
+    return false;
+  }
+  for (nRow=0;nRow<pImg->nH;nRow++) {
+    nSrcRow = (bFlip)? pImg->nH-1-nRow : nRow;
+    if ((fseek(pFile,nOffset + (long)nSrcRow*nRowSz,SEEK_SET) != 0) || (fread(pRow,1,nRowSz,pFile) != nRowSz)) {
+      fprintf(stderr,"ERROR: [%s] is truncated\n",pFname);
+      free(pRow);
+      free(pImg->pRgb);
+      pImg->pRgb = NULL;
+      fclose(pFile);
+      return false;
+    }
+    // BMP pixels are stored as B,G,R(,X) or as little-endian
+    // RGB555 / RGB565 words
+    for (nCol=0;nCol<pImg->nW;nCol++) {
+      uint8_t* pSrc = &pRow[nCol*(nBpp/8)];
+      uint8_t* pDst = &pImg->pRgb[((size_t)nRow*pImg->nW + nCol)*3];
+      if ((nBpp == 16) && (!b565)) {
+        // Expand each 5-bit channel to the full 8-bit range
+        uint16_t nCol555 = (uint16_t)ReadLE(pSrc,2);
+        pDst[0] = ((nCol555 >> 7) & 0xF8) | ((nCol555 >> 12) & 0x07);
+        pDst[1] = ((nCol555 >> 2) & 0xF8) | ((nCol555 >> 7) & 0x07);
+        pDst[2] = ((nCol555 << 3) & 0xF8) | ((nCol555 >> 2) & 0x07);
+      } else if (nBpp == 16) {
+        // Expand to the full 8-bit range so that the RGB565 value
+        // is recovered exactly by GetPixel565()
+        uint16_t nCol565 = (uint16_t)ReadLE(pSrc,2);
+        pDst[0] = ((nCol565 >> 8) & 0xF8) | (nCol565 >> 13);
+        pDst[1] = ((nCol565 >> 3) & 0xFC) | ((nCol565 >> 9) & 0x03);
+        pDst[2] = ((nCol565 << 3) & 0xF8) | ((nCol565 >> 2) & 0x07);
+      } else {
+        pDst[0] = pSrc[2];
+        pDst[1] = pSrc[1];
+        pDst[2] = pSrc[0];
+      }
+    }
+  }
+  free(pRow);
+  fclose(pFile);
+  return true;
+}
+
+uint16_t GetPixel565(const tsImg* pImg,int nInd)
+{
+  const uint8_t* pPix = &pImg->pRgb[nInd*3];
+  return ((pPix[0] & 0xF8) << 8) | ((pPix[1] & 0xFC) << 3) | (pPix[2] >> 3);
+}
+
+// Write values as a comma-separated list, a fixed number per line
+void OutVal(tsOut* pOut,uint32_t nVal,bool bWord)
+{
+  int nPerLine = (bWord)? 8 : 12;
+  if (pOut->nCnt == 0) {
+    fprintf(pOut->pFile,"  ");
+  }
+  fprintf(pOut->pFile,(bWord)? "0x%04X," : "0x%02X,",(unsigned)nVal);
+  if (++pOut->nCnt >= nPerLine) {
+    fprintf(pOut->pFile,"\n");
+    pOut->nCnt = 0;
+  } else {
+    fprintf(pOut->pFile," ");
+  }
+}
+
+void OutEnd(tsOut* pOut)
+{
+  if (pOut->nCnt > 0) {
+    fprintf(pOut->pFile,"\n");
+  }
+  pOut->nCnt = 0;
+}
+
+// Write a pixel value of an RLE image
+void OutRlePixel(tsOut* pOut,uint16_t nCol565,const uint16_t* anPal,int nPalCnt)
+{
+  int nInd;
+  if (anPal == NULL) {
+    OutVal(pOut,nCol565 >> 8,false);
+    OutVal(pOut,nCol565 & 0xFF,false);
+    return;
+  }
+  for (nInd=0;nInd<nPalCnt;nInd++) {
+    if (anPal[nInd] == nCol565) {
+      OutVal(pOut,nInd,false);
+      return;
+    }
+  }
+}
+
+// Encode the pixels as runs (a value repeated at least twice)
+// and blocks of literal pixels, as decoded by gslc_ImgRleDecode()
+void OutRle(tsOut* pOut,const tsImg* pImg,const uint16_t* anPal,int nPalCnt)
+{
+  int nPixCnt = pImg->nW * pImg->nH;
+  int nPos = 0;
+  int nEnd,nInd;
+  while (nPos < nPixCnt) {
+    nEnd = nPos+1;
+    while ((nEnd < nPixCnt) && (nEnd-nPos < IMGCONV_RLE_PKT) && (GetPixel565(pImg,nEnd) == GetPixel565(pImg,nPos))) {
+      nEnd++;
+    }
+    if (nEnd-nPos >= 2) {
+      OutVal(pOut,0x80 | (nEnd-nPos-1),false);
+      OutRlePixel(pOut,GetPixel565(pImg,nPos),anPal,nPalCnt);
+    } else {
+      // Gather literal pixels until the next run starts
+      nEnd = nPos+1;
+      while ((nEnd < nPixCnt) && (nEnd-nPos < IMGCONV_RLE_PKT) &&
+             !((nEnd+1 < nPixCnt) && (GetPixel565(pImg,nEnd+1) == GetPixel565(pImg,nEnd)))) {
+        nEnd++;
+      }
+      OutVal(pOut,nEnd-nPos-1,false);
+      for (nInd=nPos;nInd<nEnd;nInd++) {
+        OutRlePixel(pOut,GetPixel565(pImg,nInd),anPal,nPalCnt);
+      }
+    }
+    nPos = nEnd;
+  }
+}
+
+int main(int argc,char* argv[])
+{
+  const char* pFmt    = "rgb565";
+  const char* pName   = NULL;
+  const char* pFnIn   = NULL;
+  const char* pFnOut  = NULL;
+  uint32_t    nColMono = 0xFFFFFF;
+  char        acName[64];
+  tsImg       sImg;
+  tsOut       sOut = {stdout,0};
+  const char* pStrFmt;
+  const char* pStrType;
+  const char* pStrCast;
+  uint16_t    anPal[256];
+  int         nPalCnt = 0;
+  int         nPalMax = IMGCONV_PAL_DEF;
+  int         nArg,nInd,nRow,nCol;
+
+  for (nArg=1;nArg<argc;nArg++) {
+    if ((strcmp(argv[nArg],"-f") == 0) && (nArg+1 < argc)) {
+      pFmt = argv[++nArg];
+    } else if ((strcmp(argv[nArg],"-n") == 0) && (nArg+1 < argc)) {
+      pName = argv[++nArg];
+    } else if ((strcmp(argv[nArg],"-c") == 0) && (nArg+1 < argc)) {
+      nColMono = strtoul(argv[++nArg],NULL,16);
+    } else if ((strcmp(argv[nArg],"-p") == 0) && (nArg+1 < argc)) {
+      nPalMax = atoi(argv[++nArg]);
+      if ((nPalMax < 1) || (nPalMax > 256)) {
+        fprintf(stderr,"ERROR: Palette size must be 1..256\n");
+        return 1;
+      }
+    } else if ((strcmp(argv[nArg],"-o") == 0) && (nArg+1 < argc)) {
+      pFnOut = argv[++nArg];
+    } else if ((argv[nArg][0] != '-') && (pFnIn == NULL)) {
+      pFnIn = argv[nArg];
+    } else {
+      pFnIn = NULL;
+      break;
+    }
+  }
+  if (pFnIn == NULL) {
+    fprintf(stderr,"Usage: %s [-f rgb565|rgb888|mono|rle16|rle8] [-n name] [-c RRGGBB] [-p colors] [-o output.c] input.bmp\n",argv[0]);
+    return 1;
+  }
+
+  if (strcmp(pFmt,"rgb565") == 0) {
+    pStrFmt = "GSLC_IMGREF_FMT_RAW16";
+  } else if (strcmp(pFmt,"rgb888") == 0) {
+    pStrFmt = "GSLC_IMGREF_FMT_RAW24";
+  } else if (strcmp(pFmt,"mono") == 0) {
+    pStrFmt = "GSLC_IMGREF_FMT_RAW1";
+  } else if (strcmp(pFmt,"rle16") == 0) {
+    pStrFmt = "GSLC_IMGREF_FMT_RLE16";
+  } else if (strcmp(pFmt,"rle8") == 0) {
+    pStrFmt = "GSLC_IMGREF_FMT_RLE8";
+  } else {
+    fprintf(stderr,"ERROR: Unknown format [%s]\n",pFmt);
+    return 1;
+  }
+  pStrType = (strcmp(pFmt,"rgb565") == 0)? "uint16_t" : "unsigned char";
+  pStrCast = (strcmp(pFmt,"rgb565") == 0)? "(const unsigned char*)" : "";
+
+  // Derive the array name from the file name
+  if (pName == NULL) {
+    const char* pBase = strrchr(pFnIn,'/');
+    pBase = (pBase)? pBase+1 : pFnIn;
+    snprintf(acName,sizeof(acName),"img_%s",pBase);
+    for (nInd=0;acName[nInd];nInd++) {
+      if (acName[nInd] == '.') {
+        acName[nInd] = 0;
+        break;
+      }
+      if (!isalnum((unsigned char)acName[nInd])) {
+        acName[nInd] = '_';
+      }
+    }
+    pName = acName;
+  }
+
+  if (!LoadBmp(pFnIn,&sImg)) {
+    return 1;
+  }
+
+  // Collect the palette
+  // - The decoder rejects a palette larger than GSLC_IMG_RLE_PAL_MAX,
+  //   so an image with more colors is written as rle16 instead
+  if (strcmp(pFmt,"rle8") == 0) {
+    for (nInd=0;nInd<sImg.nW*sImg.nH;nInd++) {
+      uint16_t nCol565 = GetPixel565(&sImg,nInd);
+      int      nPal;
+      for (nPal=0;nPal<nPalCnt;nPal++) {
+        if (anPal[nPal] == nCol565) break;
+      }
+      if (nPal < nPalCnt) continue;
+      if (nPalCnt >= nPalMax) {
+        fprintf(stderr,"NOTE: [%s] has more than %d colors, writing rle16 instead (see -p)\n",
+          pFnIn,nPalMax);
+        pFmt    = "rle16";
+        pStrFmt = "GSLC_IMGREF_FMT_RLE16";
+        nPalCnt = 0;
+        break;
+      }
+      anPal[nPalCnt++] = nCol565;
+    }
+  }
+
+  if (pFnOut) {
+    sOut.pFile = fopen(pFnOut,"w");
+    if (sOut.pFile == NULL) {
+      fprintf(stderr,"ERROR: Can't create [%s]\n",pFnOut);
+      return 1;
+    }
+  }
+
+  fprintf(sOut.pFile,"//\n// Generated by gslc-imgconv from %s\n",pFnIn);
+  fprintf(sOut.pFile,"// - Format: %s (%d x %d)\n",pStrFmt,sImg.nW,sImg.nH);
+  fprintf(sOut.pFile,"// - Usage:  gslc_GetImageFromProg(%s%s,%s)\n//\n\n",pStrCast,pName,pStrFmt);
+  fprintf(sOut.pFile,"#include <stdint.h>\n");
+  fprintf(sOut.pFile,"#if defined(__AVR__)\n  #include <avr/pgmspace.h>\n#elif !defined(PROGMEM)\n  #define PROGMEM\n#endif\n\n");
+  fprintf(sOut.pFile,"const %s %s[] PROGMEM = {\n",pStrType,pName);
+
+  if (strcmp(pFmt,"rgb565") == 0) {
+    OutVal(&sOut,sImg.nW,true);
+    OutVal(&sOut,sImg.nH,true);
+    OutEnd(&sOut);
+    for (nInd=0;nInd<sImg.nW*sImg.nH;nInd++) {
+      OutVal(&sOut,GetPixel565(&sImg,nInd),true);
+    }
+  } else {
+    OutVal(&sOut,sImg.nW >> 8,false);
+    OutVal(&sOut,sImg.nW & 0xFF,false);
+    OutVal(&sOut,sImg.nH >> 8,false);
+    OutVal(&sOut,sImg.nH & 0xFF,false);
+    if (strcmp(pFmt,"rgb888") == 0) {
+      OutEnd(&sOut);
+      for (nInd=0;nInd<sImg.nW*sImg.nH*3;nInd++) {
+        OutVal(&sOut,sImg.pRgb[nInd],false);
+      }
+    } else if (strcmp(pFmt,"mono") == 0) {
+      OutVal(&sOut,(nColMono >> 16) & 0xFF,false);
+      OutVal(&sOut,(nColMono >> 8) & 0xFF,false);
+      OutVal(&sOut,nColMono & 0xFF,false);
+      OutVal(&sOut,0x00,false);
+      OutEnd(&sOut);
+      for (nRow=0;nRow<sImg.nH;nRow++) {
+        uint8_t nByte = 0;
+        for (nCol=0;nCol<sImg.nW;nCol++) {
+          const uint8_t* pPix = &sImg.pRgb[((size_t)nRow*sImg.nW + nCol)*3];
+          bool bTrans = (pPix[0] == IMGCONV_TRANS_R) && (pPix[1] == IMGCONV_TRANS_G) && (pPix[2] == IMGCONV_TRANS_B);
+          if ((!bTrans) && (pPix[0] + pPix[1] + pPix[2] >= 3*128)) {
+            nByte |= 0x80 >> (nCol % 8);
+          }
+          if (((nCol % 8) == 7) || (nCol == sImg.nW-1)) {
+            OutVal(&sOut,nByte,false);
+            nByte = 0;
+          }
+        }
+      }
+    } else if (strcmp(pFmt,"rle16") == 0) {
+      OutEnd(&sOut);
+      OutRle(&sOut,&sImg,NULL,0);
+    } else {
+      OutVal(&sOut,nPalCnt & 0xFF,false);
+      OutEnd(&sOut);
+      for (nInd=0;nInd<nPalCnt;nInd++) {
+        OutVal(&sOut,anPal[nInd] >> 8,false);
+        OutVal(&sOut,anPal[nInd] & 0xFF,false);
+      }
+      OutEnd(&sOut);
+      OutRle(&sOut,&sImg,anPal,nPalCnt);
+    }
+  }
+  OutEnd(&sOut);
+  fprintf(sOut.pFile,"};\n");
+
+  if (pFnOut) {
+    fclose(sOut.pFile);
+  }
+  free(sImg.pRgb);
+  return 0;
+}